@@ -4,6 +4,8 @@
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "NativeGameplayTags.h"
 #include "UObject/ScriptMacros.h"
 #include "UObject/Stack.h"
 
@@ -19,6 +21,11 @@ namespace UE
 		static FAutoConsoleVariableRef CVarShouldLogMessages(TEXT("GameplayMessageSubsystem.LogMessages"),
 			ShouldLogMessages,
 			TEXT("Should messages broadcast through the gameplay message subsystem be logged?"));
+
+		static int32 UseDispatchCache = 1;
+		static FAutoConsoleVariableRef CVarUseDispatchCache(TEXT("GameplayMessageSubsystem.UseDispatchCache"),
+			UseDispatchCache,
+			TEXT("Should broadcasts use the cached per-channel listener lists (1) or walk and copy the listener lists on every broadcast (0)?"));
 	}
 }
 
@@ -58,6 +65,9 @@ bool UGameplayMessageSubsystem::HasInstance(const UObject* WorldContextObject)
 void UGameplayMessageSubsystem::Deinitialize()
 {
 	ListenerMap.Reset();
+	DispatchCache.Reset();
+	PendingRemovals.Reset();
+	bDispatchCacheDirty = false;
 
 	Super::Deinitialize();
 }
@@ -81,39 +91,143 @@ void UGameplayMessageSubsystem::BroadcastMessageInternal(FGameplayTag Channel, c
 		UE_LOG(LogGameplayMessageSubsystem, Log, TEXT("BroadcastMessage(%s, %s, %s)"), pContextString ? **pContextString : *GetPathNameSafe(this), *Channel.ToString(), *HumanReadableMessage);
 	}
 
-	// Broadcast the message
+	// Nested broadcasts can't add cache entries (the outer broadcast is iterating one) or use a stale cache
+	if ((UE::GameplayMessageSubsystem::UseDispatchCache == 0) || (BroadcastDepth > 0 && bDispatchCacheDirty))
+	{
+		BroadcastMessageUncached(Channel, StructType, MessageBytes);
+		return;
+	}
+
+	FChannelDispatchList* pDispatch = DispatchCache.Find(Channel);
+	if (pDispatch == nullptr)
+	{
+		if (BroadcastDepth > 0)
+		{
+			BroadcastMessageUncached(Channel, StructType, MessageBytes);
+			return;
+		}
+
+		pDispatch = &DispatchCache.Add(Channel);
+		BuildDispatchList(Channel, *pDispatch);
+	}
+
+	if (pDispatch->Listeners.Num() == 0)
+	{
+		return;
+	}
+
+	// Nothing below modifies DispatchCache or frees listeners until the outermost broadcast returns, so no copy is needed
+	const bool bTypeAlreadyValidated = pDispatch->ValidatedStructType.Get() == StructType;
+	bool bAllListenersAcceptType = true;
+
+	++BroadcastDepth;
+	for (const FGameplayMessageListenerData* Listener : pDispatch->Listeners)
+	{
+		if (Listener->bPendingRemoval)
+		{
+			continue;
+		}
+
+		if (bTypeAlreadyValidated || CanListenerReceive(*Listener, Channel, StructType))
+		{
+			Listener->ReceivedCallback(Channel, StructType, MessageBytes);
+		}
+		else
+		{
+			bAllListenersAcceptType = false;
+		}
+	}
+	--BroadcastDepth;
+
+	if (!bTypeAlreadyValidated && bAllListenersAcceptType)
+	{
+		pDispatch->ValidatedStructType = StructType;
+	}
+
+	if (BroadcastDepth == 0)
+	{
+		FlushPendingRemovals();
+	}
+}
+
+void UGameplayMessageSubsystem::BroadcastMessageUncached(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes)
+{
+	++BroadcastDepth;
+
 	bool bOnInitialTag = true;
 	for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
 	{
 		if (const FChannelListenerList* pList = ListenerMap.Find(Tag))
 		{
 			// Copy in case there are removals while handling callbacks
-			TArray<FGameplayMessageListenerData> ListenerArray(pList->Listeners);
+			TArray<FGameplayMessageListenerData> ListenerArray;
+			ListenerArray.Reserve(pList->Listeners.Num());
+			for (const TUniquePtr<FGameplayMessageListenerData>& Listener : pList->Listeners)
+			{
+				if (!Listener->bPendingRemoval)
+				{
+					ListenerArray.Add(*Listener);
+				}
+			}
 
 			for (const FGameplayMessageListenerData& Listener : ListenerArray)
 			{
 				if (bOnInitialTag || (Listener.MatchType == EGameplayMessageMatch::PartialMatch))
 				{
-					if (Listener.bHadValidType && !Listener.ListenerStructType.IsValid())
-					{
-						UE_LOG(LogGameplayMessageSubsystem, Warning, TEXT("Listener struct type has gone invalid on Channel %s. Removing listener from list"), *Channel.ToString());
-						UnregisterListenerInternal(Channel, Listener.HandleID);
-						continue;
-					}
-
-					// The receiving type must be either a parent of the sending type or completely ambiguous (for internal use)
-					if (!Listener.bHadValidType || StructType->IsChildOf(Listener.ListenerStructType.Get()))
+					if (CanListenerReceive(Listener, Channel, StructType))
 					{
 						Listener.ReceivedCallback(Channel, StructType, MessageBytes);
 					}
-					else
-					{
-						UE_LOG(LogGameplayMessageSubsystem, Error, TEXT("Struct type mismatch on channel %s (broadcast type %s, listener at %s was expecting type %s)"),
-							*Channel.ToString(),
-							*StructType->GetPathName(),
-							*Tag.ToString(),
-							*Listener.ListenerStructType->GetPathName());
-					}
+				}
+			}
+		}
+		bOnInitialTag = false;
+	}
+
+	--BroadcastDepth;
+
+	if (BroadcastDepth == 0)
+	{
+		FlushPendingRemovals();
+	}
+}
+
+bool UGameplayMessageSubsystem::CanListenerReceive(const FGameplayMessageListenerData& Listener, FGameplayTag Channel, const UScriptStruct* StructType)
+{
+	if (Listener.bHadValidType && !Listener.ListenerStructType.IsValid())
+	{
+		UE_LOG(LogGameplayMessageSubsystem, Warning, TEXT("Listener struct type has gone invalid on Channel %s. Removing listener from list"), *Channel.ToString());
+		UnregisterListenerInternal(Listener.Channel, Listener.HandleID);
+		return false;
+	}
+
+	// The receiving type must be either a parent of the sending type or completely ambiguous (for internal use)
+	if (!Listener.bHadValidType || StructType->IsChildOf(Listener.ListenerStructType.Get()))
+	{
+		return true;
+	}
+
+	UE_LOG(LogGameplayMessageSubsystem, Error, TEXT("Struct type mismatch on channel %s (broadcast type %s, listener at %s was expecting type %s)"),
+		*Channel.ToString(),
+		*StructType->GetPathName(),
+		*Listener.Channel.ToString(),
+		*Listener.ListenerStructType->GetPathName());
+	return false;
+}
+
+void UGameplayMessageSubsystem::BuildDispatchList(FGameplayTag Channel, FChannelDispatchList& OutList) const
+{
+	// Same order as the uncached walk: the channel itself, then partial match listeners on each parent
+	bool bOnInitialTag = true;
+	for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	{
+		if (const FChannelListenerList* pList = ListenerMap.Find(Tag))
+		{
+			for (const TUniquePtr<FGameplayMessageListenerData>& Listener : pList->Listeners)
+			{
+				if (bOnInitialTag || (Listener->MatchType == EGameplayMessageMatch::PartialMatch))
+				{
+					OutList.Listeners.Add(Listener.Get());
 				}
 			}
 		}
@@ -148,12 +262,15 @@ FGameplayMessageListenerHandle UGameplayMessageSubsystem::RegisterListenerIntern
 {
 	FChannelListenerList& List = ListenerMap.FindOrAdd(Channel);
 
-	FGameplayMessageListenerData& Entry = List.Listeners.AddDefaulted_GetRef();
+	FGameplayMessageListenerData& Entry = *List.Listeners.Add_GetRef(MakeUnique<FGameplayMessageListenerData>());
 	Entry.ReceivedCallback = MoveTemp(Callback);
 	Entry.ListenerStructType = StructType;
 	Entry.bHadValidType = StructType != nullptr;
 	Entry.HandleID = ++List.HandleID;
 	Entry.MatchType = MatchType;
+	Entry.Channel = Channel;
+
+	InvalidateDispatchCache(Channel);
 
 	return FGameplayMessageListenerHandle(this, Channel, Entry.HandleID);
 }
@@ -176,10 +293,19 @@ void UGameplayMessageSubsystem::UnregisterListenerInternal(FGameplayTag Channel,
 {
 	if (FChannelListenerList* pList = ListenerMap.Find(Channel))
 	{
-		int32 MatchIndex = pList->Listeners.IndexOfByPredicate([ID = HandleID](const FGameplayMessageListenerData& Other) { return Other.HandleID == ID; });
+		int32 MatchIndex = pList->Listeners.IndexOfByPredicate([ID = HandleID](const TUniquePtr<FGameplayMessageListenerData>& Other) { return Other->HandleID == ID; });
 		if (MatchIndex != INDEX_NONE)
 		{
+			if (BroadcastDepth > 0)
+			{
+				// A broadcast may be iterating a cached list that points at this listener, so only mark it for now
+				pList->Listeners[MatchIndex]->bPendingRemoval = true;
+				PendingRemovals.Emplace(Channel, HandleID);
+				return;
+			}
+
 			pList->Listeners.RemoveAtSwap(MatchIndex);
+			InvalidateDispatchCache(Channel);
 		}
 
 		if (pList->Listeners.Num() == 0)
@@ -189,3 +315,126 @@ void UGameplayMessageSubsystem::UnregisterListenerInternal(FGameplayTag Channel,
 	}
 }
 
+void UGameplayMessageSubsystem::InvalidateDispatchCache(FGameplayTag Channel)
+{
+	if (BroadcastDepth > 0)
+	{
+		bDispatchCacheDirty = true;
+		return;
+	}
+
+	// Any broadcast channel at or below the changed channel may include its listeners
+	for (auto It = DispatchCache.CreateIterator(); It; ++It)
+	{
+		if (It.Key().MatchesTag(Channel))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UGameplayMessageSubsystem::FlushPendingRemovals()
+{
+	check(BroadcastDepth == 0);
+
+	if (bDispatchCacheDirty)
+	{
+		DispatchCache.Reset();
+		bDispatchCacheDirty = false;
+	}
+
+	if (PendingRemovals.Num() > 0)
+	{
+		TArray<TPair<FGameplayTag, int32>> Removals = MoveTemp(PendingRemovals);
+		for (const TPair<FGameplayTag, int32>& Removal : Removals)
+		{
+			UnregisterListenerInternal(Removal.Key, Removal.Value);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+// Benchmark
+
+#if !UE_BUILD_SHIPPING
+
+namespace UE
+{
+	namespace GameplayMessageSubsystem
+	{
+		UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GameplayMessage_Benchmark, "GameplayMessage.Benchmark");
+
+		// Usage: GameplayMessageSubsystem.Benchmark [Broadcasts]
+		// Times Broadcasts messages with 1, 10 and 100 listeners through the cached and uncached paths.
+		// Half of the listeners (rounded down) are partial match listeners on the parent tag so the parent walk is exercised as well.
+		static FAutoConsoleCommandWithWorldAndArgs CmdBenchmark(
+			TEXT("GameplayMessageSubsystem.Benchmark"),
+			TEXT("Compare cached and uncached gameplay message broadcasts. Args: [Broadcasts=10000]"),
+			FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+			{
+				if (!World || !UGameplayMessageSubsystem::HasInstance(World))
+				{
+					UE_LOG(LogGameplayMessageSubsystem, Warning, TEXT("GameplayMessageSubsystem.Benchmark: no gameplay message subsystem in this world"));
+					return;
+				}
+
+				UGameplayMessageSubsystem& Router = UGameplayMessageSubsystem::Get(World);
+				const int32 NumBroadcasts = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+				const FGameplayTag Channel = TAG_GameplayMessage_Benchmark;
+				const FGameplayTag ParentChannel = Channel.RequestDirectParent();
+				const int32 PreviousUseDispatchCache = UseDispatchCache;
+
+				const FVector Payload(1.f, 2.f, 3.f);
+				int64 Received = 0;
+
+				for (const int32 NumListeners : { 1, 10, 100 })
+				{
+					TArray<FGameplayMessageListenerHandle> Handles;
+					Handles.Reserve(NumListeners);
+					for (int32 Index = 0; Index < NumListeners; ++Index)
+					{
+						const bool bPartial = (Index % 2) == 1;
+						Handles.Add(Router.RegisterListener<FVector>(bPartial ? ParentChannel : Channel,
+							[&Received](FGameplayTag, const FVector& Message) { Received += (Message.X > 0.f) ? 1 : 0; },
+							bPartial ? EGameplayMessageMatch::PartialMatch : EGameplayMessageMatch::ExactMatch));
+					}
+
+					double Milliseconds[2] = { 0.0, 0.0 };
+					int64 Deliveries[2] = { 0, 0 };
+					for (int32 Mode = 0; Mode < 2; ++Mode)
+					{
+						UseDispatchCache = Mode;
+
+						// Warm up (builds the dispatch list in cached mode)
+						Router.BroadcastMessage(Channel, Payload);
+
+						Received = 0;
+						const double StartTime = FPlatformTime::Seconds();
+						for (int32 Index = 0; Index < NumBroadcasts; ++Index)
+						{
+							Router.BroadcastMessage(Channel, Payload);
+						}
+						Milliseconds[Mode] = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+						Deliveries[Mode] = Received;
+					}
+
+					for (FGameplayMessageListenerHandle& Handle : Handles)
+					{
+						Handle.Unregister();
+					}
+
+					UE_LOG(LogGameplayMessageSubsystem, Display, TEXT("[GameplayMessageBenchmark] Broadcasts=%d Listeners=%3d | Uncached: %8.3f ms (%.3f us/broadcast) | Cached: %8.3f ms (%.3f us/broadcast) | x%.2f%s"),
+						NumBroadcasts, NumListeners,
+						Milliseconds[0], Milliseconds[0] * 1000.0 / NumBroadcasts,
+						Milliseconds[1], Milliseconds[1] * 1000.0 / NumBroadcasts,
+						Milliseconds[1] > 0.0 ? Milliseconds[0] / Milliseconds[1] : 0.0,
+						Deliveries[0] == Deliveries[1] ? TEXT("") : TEXT(" (delivery count mismatch!)"));
+				}
+
+				UseDispatchCache = PreviousUseDispatchCache;
+			})
+		);
+	}
+}
+
+#endif
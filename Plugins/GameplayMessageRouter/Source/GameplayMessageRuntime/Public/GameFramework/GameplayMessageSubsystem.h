@@ -66,6 +66,12 @@ struct FGameplayMessageListenerData
 	// Adding some logging and extra variables around some potential problems with this
 	TWeakObjectPtr<const UScriptStruct> ListenerStructType = nullptr;
 	bool bHadValidType = false;
+
+	// Channel this listener was registered on (the key in the listener map)
+	FGameplayTag Channel;
+
+	// Set when the listener is unregistered during a broadcast; it is skipped and removed once the outermost broadcast returns
+	bool bPendingRemoval = false;
 };
 
 /**
@@ -81,6 +87,11 @@ struct FGameplayMessageListenerData
  *
  * Note that call order when there are multiple listeners for the same channel is
  * not guaranteed and can change over time!
+ *
+ * Broadcasts go through a per-channel dispatch list (the channel's listeners plus partial
+ * match listeners on its parents) that is rebuilt only after listeners are registered or
+ * unregistered. Listeners unregistered from inside a callback are skipped and removed once
+ * the outermost broadcast returns, so broadcasting does not copy or allocate.
  */
 UCLASS()
 class GAMEPLAYMESSAGERUNTIME_API UGameplayMessageSubsystem : public UGameInstanceSubsystem
@@ -214,6 +225,13 @@ private:
 	// Internal helper for broadcasting a message
 	void BroadcastMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes);
 
+	// Original broadcast path: walks the parent tags and copies each listener list before dispatching.
+	// Used when the dispatch cache can't be built (nested broadcast after a register/unregister) or is disabled by cvar
+	void BroadcastMessageUncached(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes);
+
+	// Checks that a listener can receive the broadcast struct type, logging (and removing stale listeners) if not
+	bool CanListenerReceive(const FGameplayMessageListenerData& Listener, FGameplayTag Channel, const UScriptStruct* StructType);
+
 	// Internal helper for registering a message listener
 	FGameplayMessageListenerHandle RegisterListenerInternal(
 		FGameplayTag Channel, 
@@ -223,14 +241,44 @@ private:
 
 	void UnregisterListenerInternal(FGameplayTag Channel, int32 HandleID);
 
+	// Drops cached dispatch lists affected by a listener change on Channel (deferred to the end of the outermost broadcast if one is in progress)
+	void InvalidateDispatchCache(FGameplayTag Channel);
+
+	// Removes listeners that were unregistered while a broadcast was in progress
+	void FlushPendingRemovals();
+
 private:
 	// List of all entries for a given channel
+	// Entries are heap allocated so cached dispatch lists can point at them across array growth
 	struct FChannelListenerList
 	{
-		TArray<FGameplayMessageListenerData> Listeners;
+		TArray<TUniquePtr<FGameplayMessageListenerData>> Listeners;
 		int32 HandleID = 0;
 	};
 
+	// Flattened listeners for one exact broadcast channel (exact match listeners on the channel + partial match listeners on its parents)
+	struct FChannelDispatchList
+	{
+		TArray<const FGameplayMessageListenerData*> Listeners;
+
+		// Broadcast struct type every listener in the list was last checked against; matching broadcasts skip the per-listener type check
+		TWeakObjectPtr<const UScriptStruct> ValidatedStructType;
+	};
+
+	void BuildDispatchList(FGameplayTag Channel, FChannelDispatchList& OutList) const;
+
 private:
 	TMap<FGameplayTag, FChannelListenerList> ListenerMap;
+
+	// Built lazily per broadcast channel, invalidated on register/unregister
+	TMap<FGameplayTag, FChannelDispatchList> DispatchCache;
+
+	// Listeners unregistered during a broadcast (channel, handle ID)
+	TArray<TPair<FGameplayTag, int32>> PendingRemovals;
+
+	// Number of broadcasts currently on the stack (callbacks may broadcast again)
+	int32 BroadcastDepth = 0;
+
+	// A register/unregister happened during a broadcast; the whole cache is dropped once the outermost broadcast returns
+	bool bDispatchCacheDirty = false;
 };
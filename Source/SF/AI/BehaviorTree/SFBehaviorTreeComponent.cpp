@@ -0,0 +1,31 @@
+#include "SFBehaviorTreeComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFBehaviorTreeComponent)
+
+USFBehaviorTreeComponent::USFBehaviorTreeComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void USFBehaviorTreeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Super가 ScheduleNextTick으로 정한 주기를 덮어씀. 건너뛴 시간은 다음 틱의 DeltaTime에 누적되어 서비스/태스크에 전달됨
+	ClampTickInterval();
+}
+
+void USFBehaviorTreeComponent::SetMinTickInterval(float InMinTickInterval)
+{
+	MinTickInterval = FMath::Max(0.f, InMinTickInterval);
+	ClampTickInterval();
+}
+
+void USFBehaviorTreeComponent::ClampTickInterval()
+{
+	// 틱이 꺼져 있으면(다음 틱이 필요 없음) 그대로 둠
+	if (MinTickInterval > 0.f && IsComponentTickEnabled() && GetComponentTickInterval() < MinTickInterval)
+	{
+		SetComponentTickIntervalAndCooldown(MinTickInterval);
+	}
+}
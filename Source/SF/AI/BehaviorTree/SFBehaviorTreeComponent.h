@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "SFBehaviorTreeComponent.generated.h"
+
+/**
+ * USFBehaviorTreeComponent
+ * AI LOD(USFAILODSubsystem)가 정한 최소 틱 주기를 지키는 BT 컴포넌트
+ * - 기본 BT는 매 틱 ScheduleNextTick으로 틱 주기를 덮어쓰므로 외부에서 SetComponentTickInterval을 걸어도 무시됨
+ * - 틱이 끝난 뒤 다음 틱 주기를 MinTickInterval 이상으로 올림 (태스크 완료/관찰자 중단 등 실행 요청은 그대로 즉시 처리)
+ */
+UCLASS()
+class SF_API USFBehaviorTreeComponent : public UBehaviorTreeComponent
+{
+	GENERATED_BODY()
+
+public:
+	USFBehaviorTreeComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// 0이면 BT가 요청한 주기 그대로
+	void SetMinTickInterval(float InMinTickInterval);
+	float GetMinTickInterval() const { return MinTickInterval; }
+
+private:
+	void ClampTickInterval();
+
+private:
+	float MinTickInterval = 0.f;
+};
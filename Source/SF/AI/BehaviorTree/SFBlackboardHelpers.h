@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BlackboardComponent.h"
+
+/**
+ * 값이 실제로 바뀐 경우에만 블랙보드에 기록하는 헬퍼
+ * 서비스가 매 틱 같은 값을 다시 쓰면서 발생하는 키 조회/옵저버 알림 비용을 줄인다
+ */
+namespace SFBlackboard
+{
+	inline void SetObject(UBlackboardComponent& Blackboard, const FName& KeyName, UObject* Value)
+	{
+		if (KeyName != NAME_None && Blackboard.GetValueAsObject(KeyName) != Value)
+		{
+			Blackboard.SetValueAsObject(KeyName, Value);
+		}
+	}
+
+	inline void SetBool(UBlackboardComponent& Blackboard, const FName& KeyName, bool bValue)
+	{
+		if (KeyName != NAME_None && Blackboard.GetValueAsBool(KeyName) != bValue)
+		{
+			Blackboard.SetValueAsBool(KeyName, bValue);
+		}
+	}
+
+	inline void SetFloat(UBlackboardComponent& Blackboard, const FName& KeyName, float Value, float Tolerance = KINDA_SMALL_NUMBER)
+	{
+		if (KeyName != NAME_None && !FMath::IsNearlyEqual(Blackboard.GetValueAsFloat(KeyName), Value, Tolerance))
+		{
+			Blackboard.SetValueAsFloat(KeyName, Value);
+		}
+	}
+
+	inline void SetVector(UBlackboardComponent& Blackboard, const FName& KeyName, const FVector& Value, float Tolerance = KINDA_SMALL_NUMBER)
+	{
+		if (KeyName != NAME_None && !Blackboard.GetValueAsVector(KeyName).Equals(Value, Tolerance))
+		{
+			Blackboard.SetValueAsVector(KeyName, Value);
+		}
+	}
+
+	inline void SetEnum(UBlackboardComponent& Blackboard, const FName& KeyName, uint8 Value)
+	{
+		if (KeyName != NAME_None && Blackboard.GetValueAsEnum(KeyName) != Value)
+		{
+			Blackboard.SetValueAsEnum(KeyName, Value);
+		}
+	}
+
+	// 값이 설정되어 있을 때만 초기화
+	inline void ClearObject(UBlackboardComponent& Blackboard, const FName& KeyName)
+	{
+		if (KeyName != NAME_None && Blackboard.GetValueAsObject(KeyName) != nullptr)
+		{
+			Blackboard.ClearValue(KeyName);
+		}
+	}
+}
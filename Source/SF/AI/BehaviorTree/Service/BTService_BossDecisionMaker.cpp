@@ -5,8 +5,8 @@
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
 // #include "AI/Controller/SFEnemyCombatComponent.h" // 더 이상 필요 없음
-#include "Perception/AIPerceptionComponent.h"
-#include "Perception/AISense_Sight.h"
+#include "AI/SFAITargetingSubsystem.h"
+#include "AI/BehaviorTree/SFBlackboardHelpers.h"
 
 UBTService_BossDecisionMaker::UBTService_BossDecisionMaker()
 {
@@ -21,10 +21,8 @@ UBTService_BossDecisionMaker::UBTService_BossDecisionMaker()
     // AbilityTagKey 필터 삭제
 }
 
-float UBTService_BossDecisionMaker::CalculateTargetScore(APawn* MyPawn, AActor* Target) const
+float UBTService_BossDecisionMaker::CalculateTargetScore(float Distance) const
 {
-	if (!MyPawn || !Target) return -1.f;
-	float Distance = FVector::Dist(MyPawn->GetActorLocation(), Target->GetActorLocation());
 	return FMath::Clamp(2000.f - (Distance / 5.f), 0.f, 2000.f);
 }
 
@@ -39,6 +37,17 @@ void UBTService_BossDecisionMaker::TickNode(UBehaviorTreeComponent& OwnerComp, u
 	APawn* MyPawn = AIC->GetPawn();
 	if (!MyPawn) return;
 
+	// 거리/시야는 타겟팅 서브시스템 캐시에서 읽음
+	USFAITargetingSubsystem* TargetingSubsystem = USFAITargetingSubsystem::Get(MyPawn);
+	const FSFAITargetingRow* Row = TargetingSubsystem ? TargetingSubsystem->GetTargetingRow(AIC) : nullptr;
+	if (!Row) return;
+
+	auto GetDistanceTo = [Row, MyPawn](const AActor* Target)
+	{
+		const FSFAITargetCandidate* Candidate = Row->FindCandidate(Target);
+		return Candidate ? Candidate->Distance : FVector::Dist(MyPawn->GetActorLocation(), Target->GetActorLocation());
+	};
+
 	// =========================================================
 	// [Part 1] 타겟 관리 (Target Selection) - 유지!
 	// =========================================================
@@ -46,27 +55,21 @@ void UBTService_BossDecisionMaker::TickNode(UBehaviorTreeComponent& OwnerComp, u
 	
 	if (CurrentTarget)
 	{
-		float Dist = FVector::Dist(MyPawn->GetActorLocation(), CurrentTarget->GetActorLocation());
-		if (Dist > BossChaseDistance || !IsValid(CurrentTarget))
+		if (!IsValid(CurrentTarget) || GetDistanceTo(CurrentTarget) > BossChaseDistance)
 		{
 			CurrentTarget = nullptr; 
 		}
 	}
 
-	TArray<AActor*> PerceivedActors;
-	if (auto* PerceptionComp = AIC->GetPerceptionComponent())
-	{
-		PerceptionComp->GetCurrentlyPerceivedActors(UAISense_Sight::StaticClass(), PerceivedActors);
-	}
-
 	AActor* BestTarget = nullptr;
 	float BestScore = -1.f;
 
-	for (AActor* Actor : PerceivedActors)
+	for (const FSFAITargetCandidate& Candidate : Row->Candidates)
 	{
-		if (Actor && Actor->ActorHasTag("Player")) 
+		AActor* Actor = Candidate.Actor.Get();
+		if (Actor && Candidate.bVisible && Actor->ActorHasTag("Player")) 
 		{
-			float Score = CalculateTargetScore(MyPawn, Actor);
+			const float Score = CalculateTargetScore(Candidate.Distance);
 			if (Score > BestScore)
 			{
 				BestScore = Score;
@@ -77,25 +80,30 @@ void UBTService_BossDecisionMaker::TickNode(UBehaviorTreeComponent& OwnerComp, u
 
 	if (BestTarget)
 	{
-		if (!CurrentTarget || (CurrentTarget && BestTarget != CurrentTarget && (BestScore - CalculateTargetScore(MyPawn, CurrentTarget)) >= ScoreDifferenceThreshold))
+		if (!CurrentTarget || (BestTarget != CurrentTarget && (BestScore - CalculateTargetScore(GetDistanceTo(CurrentTarget))) >= ScoreDifferenceThreshold))
 		{
 			CurrentTarget = BestTarget;
 		}
 	}
 
-	// 결과 저장
+	// 결과 저장 (값이 바뀐 키만 기록)
 	if (CurrentTarget)
 	{
-		Blackboard->SetValueAsObject(TargetActorKey.SelectedKeyName, CurrentTarget);
-		Blackboard->SetValueAsBool(HasTargetKey.SelectedKeyName, true);
-		float DistToTarget = FVector::Dist(MyPawn->GetActorLocation(), CurrentTarget->GetActorLocation());
-		Blackboard->SetValueAsFloat(DistanceToTargetKey.SelectedKeyName, DistToTarget);
-		AIC->SetFocus(CurrentTarget);
+		if (Blackboard->GetValueAsObject(TargetActorKey.SelectedKeyName) != CurrentTarget)
+		{
+			Blackboard->SetValueAsObject(TargetActorKey.SelectedKeyName, CurrentTarget);
+		}
+		if (AIC->GetFocusActor() != CurrentTarget)
+		{
+			AIC->SetFocus(CurrentTarget);
+		}
+		SFBlackboard::SetBool(*Blackboard, HasTargetKey.SelectedKeyName, true);
+		SFBlackboard::SetFloat(*Blackboard, DistanceToTargetKey.SelectedKeyName, GetDistanceTo(CurrentTarget), DistanceWriteTolerance);
 	}
 	else
 	{
-		Blackboard->ClearValue(TargetActorKey.SelectedKeyName);
-		Blackboard->SetValueAsBool(HasTargetKey.SelectedKeyName, false);
+		SFBlackboard::ClearObject(*Blackboard, TargetActorKey.SelectedKeyName);
+		SFBlackboard::SetBool(*Blackboard, HasTargetKey.SelectedKeyName, false);
 		// 거리값도 초기화해주면 좋음 (선택 사항)
 		// Blackboard->ClearValue(DistanceToTargetKey.SelectedKeyName); 
 		AIC->ClearFocus(EAIFocusPriority::Gameplay);
@@ -105,4 +113,4 @@ void UBTService_BossDecisionMaker::TickNode(UBehaviorTreeComponent& OwnerComp, u
 	// [Part 2] 스킬 선택 로직 -> 완전히 삭제됨!
 	// 이제 비헤이비어 트리의 Selector와 Cooldown Decorator가 결정합니다.
 	// =========================================================
-}
\ No newline at end of file
+}
@@ -41,6 +41,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Config|Target")
 	float ScoreDifferenceThreshold = 50.f;
 
+	// 거리 키는 이 값(cm) 이상 변했을 때만 블랙보드에 기록
+	UPROPERTY(EditAnywhere, Category = "Config|Target", meta = (ClampMin = "0.0"))
+	float DistanceWriteTolerance = 10.f;
+
 private:
-	float CalculateTargetScore(APawn* MyPawn, AActor* Target) const;
+	float CalculateTargetScore(float Distance) const;
 };
\ No newline at end of file
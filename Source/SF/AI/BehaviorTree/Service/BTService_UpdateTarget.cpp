@@ -5,8 +5,6 @@
 // Engine & AI
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "Perception/AIPerceptionComponent.h"
-#include "Perception/AISense_Sight.h"
 #include "GameFramework/Pawn.h"
 
 // [중요] EnemyController의 SetTargetForce를 쓰기 위해 헤더 포함
@@ -17,6 +15,8 @@
 #include "AbilitySystemComponent.h"
 #include "GameplayTagAssetInterface.h"
 #include "SF/Character/SFCharacterGameplayTags.h"
+#include "AI/SFAITargetingSubsystem.h"
+#include "AI/BehaviorTree/SFBlackboardHelpers.h"
 
 UBTService_UpdateTarget::UBTService_UpdateTarget()
 {
@@ -50,10 +50,8 @@ bool UBTService_UpdateTarget::IsTargetValid(AActor* TargetActor) const
 	return true;
 }
 
-float UBTService_UpdateTarget::CalculateTargetScore(APawn* MyPawn, AActor* Target) const
+float UBTService_UpdateTarget::CalculateTargetScore(float Distance) const
 {
-	if (!MyPawn || !Target) return -1.f;
-	float Distance = FVector::Dist(MyPawn->GetActorLocation(), Target->GetActorLocation());
 	return FMath::Clamp(2000.f - (Distance / 5.f), 0.f, 2000.f);
 }
 
@@ -69,6 +67,18 @@ void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
 	APawn* MyPawn = AIController->GetPawn();
 	if (!MyPawn) return;
 
+	// 거리/시야/Hero 상태는 타겟팅 서브시스템 캐시에서 읽음 (서비스마다 Perception 조회 X)
+	USFAITargetingSubsystem* TargetingSubsystem = USFAITargetingSubsystem::Get(MyPawn);
+	const FSFAITargetingRow* Row = TargetingSubsystem ? TargetingSubsystem->GetTargetingRow(AIController) : nullptr;
+	if (!Row) return;
+
+	// 캐시에 없는 대상(Hero 외)은 직접 계산
+	auto GetDistanceTo = [Row, MyPawn](const AActor* Target)
+	{
+		const FSFAITargetCandidate* Candidate = Row->FindCandidate(Target);
+		return Candidate ? Candidate->Distance : FVector::Dist(MyPawn->GetActorLocation(), Target->GetActorLocation());
+	};
+
 	// [Check 0] 공격 중 처리 (거리 갱신만 수행)
 	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(MyPawn))
 	{
@@ -77,11 +87,7 @@ void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
 			AActor* LockedTarget = Cast<AActor>(Blackboard->GetValueAsObject(TargetActorKey.SelectedKeyName));
 			if (LockedTarget)
 			{
-				float Dist = FVector::Dist(MyPawn->GetActorLocation(), LockedTarget->GetActorLocation());
-				if (DistanceToTargetKey.SelectedKeyName != NAME_None)
-				{
-					Blackboard->SetValueAsFloat(DistanceToTargetKey.SelectedKeyName, Dist);
-				}
+				SFBlackboard::SetFloat(*Blackboard, DistanceToTargetKey.SelectedKeyName, GetDistanceTo(LockedTarget), DistanceWriteTolerance);
 			}
 			return; // 타겟 변경 로직 스킵
 		}
@@ -92,31 +98,29 @@ void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
 	
 	if (CurrentTarget)
 	{
-		float Dist = FVector::Dist(MyPawn->GetActorLocation(), CurrentTarget->GetActorLocation());
+		const FSFAITargetCandidate* Candidate = Row->FindCandidate(CurrentTarget);
+		const bool bTargetable = Candidate ? Candidate->IsTargetable() : IsTargetValid(CurrentTarget);
 
-		if (Dist > MaxChaseDistance || !IsTargetValid(CurrentTarget))
+		if (GetDistanceTo(CurrentTarget) > MaxChaseDistance || !bTargetable)
 		{
 			CurrentTarget = nullptr; 
 		}
 	}
 
-	// [Check 2] Perception으로 감지된 적 탐색
-	TArray<AActor*> PerceivedActors;
-	if (UAIPerceptionComponent* PerceptionComp = AIController->GetPerceptionComponent())
-	{
-		PerceptionComp->GetCurrentlyPerceivedActors(UAISense_Sight::StaticClass(), PerceivedActors);
-	}
-
+	// [Check 2] 캐시된 Hero 중 추격 거리 안 + 시야로 감지된 대상만 채택
 	AActor* BestTarget = nullptr;
 	float BestScore = -1.f;
 
-	for (AActor* Actor : PerceivedActors)
+	for (const FSFAITargetCandidate& Candidate : Row->Candidates)
 	{
+		AActor* Actor = Candidate.Actor.Get();
 		if (!Actor) continue;
+		if (Candidate.Distance > MaxChaseDistance) continue;
+		if (!Candidate.bVisible) continue;
+		if (!Candidate.IsTargetable()) continue;
 		if (!Actor->ActorHasTag(TargetTag)) continue;
-		if (!IsTargetValid(Actor)) continue;
 
-		float Score = CalculateTargetScore(MyPawn, Actor);
+		const float Score = CalculateTargetScore(Candidate.Distance);
 		if (Score > BestScore)
 		{
 			BestScore = Score;
@@ -125,38 +129,29 @@ void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
 	}
 
 	// [Check 3] 타겟 교체 판단
-	bool bShouldUpdate = false;
-
 	if (BestTarget)
 	{
 		if (!CurrentTarget)
 		{
 			CurrentTarget = BestTarget;
-			bShouldUpdate = true;
 		}
 		else if (CurrentTarget != BestTarget)
 		{
-			float CurrentScore = CalculateTargetScore(MyPawn, CurrentTarget);
+			const float CurrentScore = CalculateTargetScore(GetDistanceTo(CurrentTarget));
 			if ((BestScore - CurrentScore) >= ScoreDifferenceThreshold)
 			{
 				CurrentTarget = BestTarget;
-				bShouldUpdate = true;
 			}
 		}
 	}
-	else if (!CurrentTarget)
-	{
-		bShouldUpdate = true; 
-	}
 
-	// [Check 4] 블랙보드 및 컨트롤러 업데이트
+	// [Check 4] 블랙보드 및 컨트롤러 업데이트 (값이 바뀐 키만 기록)
 	if (CurrentTarget)
 	{
 		// 타겟 변경 시
 		if (Blackboard->GetValueAsObject(TargetActorKey.SelectedKeyName) != CurrentTarget)
 		{
 			Blackboard->SetValueAsObject(TargetActorKey.SelectedKeyName, CurrentTarget);
-			Blackboard->SetValueAsBool(HasTargetKey.SelectedKeyName, true);
 			AIController->SetFocus(CurrentTarget);
 			
 			// ★ [핵심] 컨트롤러의 SetTargetForce 직접 호출
@@ -165,22 +160,22 @@ void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
 				EnemyController->SetTargetForce(CurrentTarget);
 			}
 		}
+		SFBlackboard::SetBool(*Blackboard, HasTargetKey.SelectedKeyName, true);
 		
-		// 위치와 거리 정보는 매 프레임(Tick) 갱신
-		float DistToTarget = FVector::Dist(MyPawn->GetActorLocation(), CurrentTarget->GetActorLocation());
-		Blackboard->SetValueAsVector(LastKnownPositionKey.SelectedKeyName, CurrentTarget->GetActorLocation());
-		
-		if (DistanceToTargetKey.SelectedKeyName != NAME_None)
-		{
-			Blackboard->SetValueAsFloat(DistanceToTargetKey.SelectedKeyName, DistToTarget);
-		}
+		// 위치와 거리 정보는 허용 오차 이상 변했을 때만 갱신
+		const FSFAITargetCandidate* Candidate = Row->FindCandidate(CurrentTarget);
+		const FVector TargetLocation = Candidate ? Candidate->Location : CurrentTarget->GetActorLocation();
+		SFBlackboard::SetVector(*Blackboard, LastKnownPositionKey.SelectedKeyName, TargetLocation, DistanceWriteTolerance);
+		SFBlackboard::SetFloat(*Blackboard, DistanceToTargetKey.SelectedKeyName, GetDistanceTo(CurrentTarget), DistanceWriteTolerance);
 	}
-	else if (bShouldUpdate) // 타겟 잃음
+	else // 타겟 없음
 	{
-		Blackboard->ClearValue(TargetActorKey.SelectedKeyName);
-		Blackboard->SetValueAsBool(HasTargetKey.SelectedKeyName, false);
+		const bool bHadTarget = Blackboard->GetValueAsObject(TargetActorKey.SelectedKeyName) != nullptr;
+
+		SFBlackboard::ClearObject(*Blackboard, TargetActorKey.SelectedKeyName);
+		SFBlackboard::SetBool(*Blackboard, HasTargetKey.SelectedKeyName, false);
 		
-		if (DistanceToTargetKey.SelectedKeyName != NAME_None)
+		if (bHadTarget && DistanceToTargetKey.SelectedKeyName != NAME_None)
 		{
 			Blackboard->ClearValue(DistanceToTargetKey.SelectedKeyName);
 		}
@@ -190,4 +185,4 @@ void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
 		// 컨트롤러 타겟 해제 시도 (필요하다면 CombatComponent 직접 접근 등 추가 가능하나 SetTargetForce는 null 체크로 리턴됨)
 		// 일반적인 경우 여기서 ClearFocus만으로 충분할 수 있습니다.
 	}
-}
\ No newline at end of file
+}
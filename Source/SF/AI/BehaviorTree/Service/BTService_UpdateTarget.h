@@ -10,6 +10,7 @@
  * [통합 타겟팅 서비스]
  * - 일반 몬스터: 시야 기반 추적, 죽으면 해제.
  * - 보스 몬스터: 거리 정보(Distance) 실시간 갱신 (패턴용), 공격 중에도 거리 갱신.
+ * - 거리/시야는 USFAITargetingSubsystem 캐시를 사용하고, 블랙보드는 값이 바뀐 키만 기록.
  */
 UCLASS()
 class SF_API UBTService_UpdateTarget : public UBTService
@@ -54,10 +55,14 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Target Priority")
 	FName TargetTag = FName("Player");
 
+	/** 거리/위치 키는 이 값(cm) 이상 변했을 때만 블랙보드에 기록 */
+	UPROPERTY(EditAnywhere, Category = "Blackboard", meta = (ClampMin = "0.0"))
+	float DistanceWriteTolerance = 10.0f;
+
 private:
 	/** 거리 기반 점수 계산 */
-	float CalculateTargetScore(APawn* MyPawn, AActor* Target) const;
+	float CalculateTargetScore(float Distance) const;
 
-	/** 타겟 상태(죽음/무적) 확인 */
+	/** 타겟 상태(죽음/무적) 확인 (타겟팅 캐시에 없는 대상용) */
 	bool IsTargetValid(AActor* TargetActor) const;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
 #include "AI/Controller/SFBaseAIController.h"
+#include "AI/BehaviorTree/SFBlackboardHelpers.h"
 
 USFBTS_UpdateTargetData::USFBTS_UpdateTargetData()
 {
@@ -28,6 +29,8 @@ void USFBTS_UpdateTargetData::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
 {
     Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 
+    const FSFBTUpdateTargetDataMemory* Memory = CastInstanceNodeMemory<FSFBTUpdateTargetDataMemory>(NodeMemory);
+    const USFDragonCombatComponent* CombatComponent = Memory->CombatComponent.Get();
     if (!CombatComponent) return;
 
     UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
@@ -37,17 +40,17 @@ void USFBTS_UpdateTargetData::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
     
     if (NewTarget)
     {
-        BB->SetValueAsObject(GetSelectedBlackboardKey(), NewTarget);
-        BB->SetValueAsFloat(DistanceKey.SelectedKeyName, CombatComponent->GetDistanceToTarget());
-        BB->SetValueAsFloat(AngleKey.SelectedKeyName, CombatComponent->GetAngleToTarget());
-        BB->SetValueAsEnum(ZoneKey.SelectedKeyName, static_cast<uint8>(CombatComponent->GetTargetLocationZone()));
+        SFBlackboard::SetObject(*BB, GetSelectedBlackboardKey(), NewTarget);
+        SFBlackboard::SetFloat(*BB, DistanceKey.SelectedKeyName, CombatComponent->GetDistanceToTarget(), DistanceWriteTolerance);
+        SFBlackboard::SetFloat(*BB, AngleKey.SelectedKeyName, CombatComponent->GetAngleToTarget(), AngleWriteTolerance);
+        SFBlackboard::SetEnum(*BB, ZoneKey.SelectedKeyName, static_cast<uint8>(CombatComponent->GetTargetLocationZone()));
     }
     else
     {
-        BB->SetValueAsObject(BlackboardKey.SelectedKeyName, nullptr);
-        BB->SetValueAsFloat(DistanceKey.SelectedKeyName, 0.f);
-        BB->SetValueAsFloat(AngleKey.SelectedKeyName, 0.f);
-        BB->SetValueAsEnum(ZoneKey.SelectedKeyName, static_cast<uint8>(EBossAttackZone::None));
+        SFBlackboard::SetObject(*BB, GetSelectedBlackboardKey(), nullptr);
+        SFBlackboard::SetFloat(*BB, DistanceKey.SelectedKeyName, 0.f);
+        SFBlackboard::SetFloat(*BB, AngleKey.SelectedKeyName, 0.f);
+        SFBlackboard::SetEnum(*BB, ZoneKey.SelectedKeyName, static_cast<uint8>(EBossAttackZone::None));
     }
 }
 
@@ -55,15 +58,29 @@ void USFBTS_UpdateTargetData::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp
 {
     Super::OnBecomeRelevant(OwnerComp, NodeMemory);
     
+    FSFBTUpdateTargetDataMemory* Memory = CastInstanceNodeMemory<FSFBTUpdateTargetDataMemory>(NodeMemory);
     AAIController* AIC = OwnerComp.GetAIOwner();
-    if (AIC)
-    {
-        CombatComponent = AIC->FindComponentByClass<USFDragonCombatComponent>();
-    }
+    Memory->CombatComponent = AIC ? AIC->FindComponentByClass<USFDragonCombatComponent>() : nullptr;
 }
 
 void USFBTS_UpdateTargetData::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
     Super::OnCeaseRelevant(OwnerComp, NodeMemory);
     
-}
\ No newline at end of file
+    CastInstanceNodeMemory<FSFBTUpdateTargetDataMemory>(NodeMemory)->CombatComponent.Reset();
+}
+
+uint16 USFBTS_UpdateTargetData::GetInstanceMemorySize() const
+{
+    return sizeof(FSFBTUpdateTargetDataMemory);
+}
+
+void USFBTS_UpdateTargetData::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+    InitializeNodeMemory<FSFBTUpdateTargetDataMemory>(NodeMemory, InitType);
+}
+
+void USFBTS_UpdateTargetData::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+    CleanupNodeMemory<FSFBTUpdateTargetDataMemory>(NodeMemory, CleanupType);
+}
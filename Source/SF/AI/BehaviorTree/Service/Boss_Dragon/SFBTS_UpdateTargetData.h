@@ -8,8 +8,16 @@
 
 class USFDragonCombatComponent;
 class USFEnemyCombatComponent;
+
+struct FSFBTUpdateTargetDataMemory
+{
+	// 노드 인스턴스(AI)별 전투 컴포넌트
+	TWeakObjectPtr<USFDragonCombatComponent> CombatComponent;
+};
+
 /**
- * 
+ * 드래곤 전투 컴포넌트가 캐시한 타겟/거리/각도/존을 블랙보드로 복사
+ * 값이 바뀐 키만 기록
  */
 UCLASS()
 class SF_API USFBTS_UpdateTargetData : public UBTService_BlackboardBase
@@ -23,6 +31,9 @@ protected:
 	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 	virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
 
 
@@ -36,11 +47,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category= "Blackboard")
 	FBlackboardKeySelector ZoneKey;
 
-	
-private:
-	UPROPERTY()
-	USFDragonCombatComponent* CombatComponent;
-	
-	
-	
+	// 거리 키는 이 값(cm) 이상, 각도 키는 이 값(도) 이상 변했을 때만 기록
+	UPROPERTY(EditAnywhere, Category= "Blackboard", meta = (ClampMin = "0.0"))
+	float DistanceWriteTolerance = 10.f;
+
+	UPROPERTY(EditAnywhere, Category= "Blackboard", meta = (ClampMin = "0.0"))
+	float AngleWriteTolerance = 1.f;
 };
@@ -192,59 +192,26 @@ bool USFDragonCombatComponent::SelectAbility(const FEnemyAbilitySelectContext& C
     if (!ASC || SearchTags.IsEmpty()) return false;
 
     FEnemyAbilitySelectContext ContextWithSpatialData = DragonContext;
-    
+
+    GatherScoredAbilities(ASC, ContextWithSpatialData, SearchTags, ScoredAbilityScratch);
+
     TArray<FGameplayTag> Candidates;
     TArray<float> Weights;
-    float TotalWeight = 0.f;
+    Candidates.Reserve(ScoredAbilityScratch.Num());
+    Weights.Reserve(ScoredAbilityScratch.Num());
 
-    for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+    for (const FSFScoredAbility& Scored : ScoredAbilityScratch)
     {
-        UGameplayAbility* Ability = Spec.Ability;
-        if (!Ability) continue;
-
-        FGameplayTagContainer AllTags;
-        AllTags.AppendTags(Ability->AbilityTags);
-        AllTags.AppendTags(Ability->GetAssetTags());
-        
-        if (!AllTags.HasAny(SearchTags)) continue;
-
-        const FGameplayAbilityActorInfo* ActorInfo = ASC->AbilityActorInfo.Get();
-        if (!Ability->CheckCooldown(Spec.Handle, ActorInfo)) continue;
-
-        ISFEnemyAbilityInterface* AIInterface = Cast<ISFEnemyAbilityInterface>(Ability);
-        if (!AIInterface) continue;
-
-        FEnemyAbilitySelectContext ContextWithSpec = ContextWithSpatialData;
-        ContextWithSpec.AbilitySpec = &Spec;
-
-        float Score = AIInterface->CalcAIScore(ContextWithSpec);
-        
-        if (Score > 0.f)
+        float Score = Scored.Score;
+        if (RecentAbilityHistory.Contains(Scored.Tag))
         {
-            FGameplayTag UniqueTag;
-            for (const FGameplayTag& Tag : AllTags)
-            {
-                if (SearchTags.HasTagExact(Tag)) { UniqueTag = Tag; break; }
-            }
-            
-            if (!UniqueTag.IsValid())
-            {
-                UniqueTag = Ability->AbilityTags.Num() > 0 ? Ability->AbilityTags.First() : Ability->GetAssetTags().First();
-            }
-
-            if (UniqueTag.IsValid())
-            {
-                if (RecentAbilityHistory.Contains(UniqueTag))
-                {
-                    Score *= 0.3f;
-                }
-                
-                Score *= FMath::FRandRange(0.8f, 1.2f);
-
-                Candidates.Add(UniqueTag);
-                Weights.Add(Score);
-            }
+            Score *= 0.3f;
         }
+
+        Score *= FMath::FRandRange(0.8f, 1.2f);
+
+        Candidates.Add(Scored.Tag);
+        Weights.Add(Score);
     }
 
     if (Candidates.Num() == 0) return false;
@@ -2,6 +2,8 @@
 #include "SFBaseAIController.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
+#include "AI/SFAITargetingSubsystem.h"
+#include "AI/BehaviorTree/SFBehaviorTreeComponent.h"
 #include "AI/StateMachine/SFStateMachine.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
@@ -30,6 +32,9 @@ ASFBaseAIController::ASFBaseAIController(const FObjectInitializer& ObjectInitial
     
     CurrentRotationMode = EAIRotationMode::MovementDirection;
     RotationInterpSpeed = 5.f;
+
+    // RunBehaviorTree가 기존 BrainComponent를 재사용 → AI LOD 틱 주기를 지키는 BT 컴포넌트 사용
+    BrainComponent = CreateDefaultSubobject<USFBehaviorTreeComponent>(TEXT("BTComponent"));
 }
 
 void ASFBaseAIController::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -115,6 +120,12 @@ void ASFBaseAIController::BeginPlay()
 void ASFBaseAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     UGameFrameworkComponentManager::RemoveGameFrameworkComponentReceiver(this);
+
+    if (USFAITargetingSubsystem* TargetingSubsystem = USFAITargetingSubsystem::Get(this))
+    {
+        TargetingSubsystem->UnregisterController(this);
+    }
+
     Super::EndPlay(EndPlayReason);
 }
 
@@ -127,6 +138,13 @@ void ASFBaseAIController::OnPossess(APawn* InPawn)
 void ASFBaseAIController::OnUnPossess()
 {
     UnBindingStateMachine();
+
+    // 폰을 잃은 컨트롤러의 타겟팅 행 제거 (다시 빙의하면 BT 서비스가 첫 요청 때 재등록)
+    if (USFAITargetingSubsystem* TargetingSubsystem = USFAITargetingSubsystem::Get(this))
+    {
+        TargetingSubsystem->UnregisterController(this);
+    }
+
     Super::OnUnPossess();
 }
 
@@ -5,6 +5,7 @@
 #include "AbilitySystemGlobals.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AbilitySystem/SFAbilitySystemComponent.h"
+#include "AbilitySystem/Abilities/Enemy/Combat/SFGA_Enemy_BaseAttack.h"
 #include "AI/SFAIGameplayTags.h"
 #include "AI/Controller/SFBaseAIController.h"
 #include "Character/SFCharacterBase.h"
@@ -23,11 +24,21 @@ void USFCombatComponentBase::InitializeCombatComponent()
     APawn* Pawn = AIC->GetPawn();
     if (!Pawn) return;
 
+    // 빙의 대상이 바뀌었을 수 있으므로 후보 테이블은 다음 선택 때 새 ASC 기준으로 재구성
+    ResetAbilityCandidates();
+
     CachedASC = Cast<USFAbilitySystemComponent>(
         UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Pawn));
     
 }
 
+void USFCombatComponentBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ResetAbilityCandidates();
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void USFCombatComponentBase::UpdateTargetActor(AActor* NewTarget)
 {
     if (CurrentTarget == NewTarget) return;
@@ -100,106 +111,258 @@ bool USFCombatComponentBase::SelectAbility(
         }
     }
 
-    
-    TArray<FGameplayTag> Candidates;
-    TArray<float> Weights;
+    GatherScoredAbilities(ASC, ContextWithSpatialData, SearchTags, ScoredAbilityScratch);
+
+    // No candidates
+    if (ScoredAbilityScratch.Num() == 0)
+    {
+        return false;
+    }
+
     float TotalWeight = 0.f;
+    for (const FSFScoredAbility& Scored : ScoredAbilityScratch)
+    {
+        TotalWeight += Scored.Score;
+    }
 
-    for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+    // Weighted random selection
+    float RandomValue = FMath::FRandRange(0.f, TotalWeight);
+
+    for (const FSFScoredAbility& Scored : ScoredAbilityScratch)
     {
-        UGameplayAbility* Ability = Spec.Ability;
-        if (!Ability)
+        if (RandomValue <= Scored.Score)
+        {
+            OutSelectedTag = Scored.Tag;
+            return true;
+        }
+        RandomValue -= Scored.Score;
+    }
+
+    // Fallback to last candidate
+    OutSelectedTag = ScoredAbilityScratch.Last().Tag;
+    return true;
+}
+
+void USFCombatComponentBase::GatherScoredAbilities(
+    UAbilitySystemComponent* ASC,
+    const FEnemyAbilitySelectContext& Context,
+    const FGameplayTagContainer& SearchTags,
+    TArray<FSFScoredAbility>& OutScored)
+{
+    OutScored.Reset();
+
+    if (!ASC)
+    {
+        return;
+    }
+
+    if (bAbilityCandidatesDirty || CandidateASC.Get() != ASC)
+    {
+        RebuildAbilityCandidates(ASC);
+    }
+
+    USFAbilitySystemComponent* SFASC = Cast<USFAbilitySystemComponent>(ASC);
+    const uint64 FrameNumber = GFrameCounter;
+    const TObjectKey<AActor> TargetKey(Context.Target);
+
+    // 쿨다운이 끝난 후보만 순회
+    for (TConstSetBitIterator<> It(CooldownReadyBits); It; ++It)
+    {
+        FSFAbilityCandidate& Candidate = AbilityCandidates[It.GetIndex()];
+
+        if (!Candidate.AllTags.HasAny(SearchTags) || !Candidate.Ability.IsValid())
         {
             continue;
         }
-        
-        FGameplayTagContainer AllTags;
-        AllTags.AppendTags(Ability->AbilityTags);
-        AllTags.AppendTags(Ability->GetAssetTags());
 
-        
-        if (!AllTags.HasAny(SearchTags))
+        const bool bScoreCached =
+            Candidate.ScoreFrame == FrameNumber &&
+            Candidate.ScoreTarget == TargetKey &&
+            Candidate.ScoreDistance == Context.DistanceToTarget &&
+            Candidate.ScoreAngle == Context.AngleToTarget &&
+            Candidate.bScoreMustFirst == Context.bMustFirst;
+
+        if (!bScoreCached)
+        {
+            const FGameplayAbilitySpec* Spec = SFASC
+                ? SFASC->FindAbilitySpecFromHandleCached(Candidate.Handle)
+                : ASC->FindAbilitySpecFromHandle(Candidate.Handle);
+            if (!Spec)
+            {
+                bAbilityCandidatesDirty = true;
+                continue;
+            }
+
+            FEnemyAbilitySelectContext ContextWithSpec = Context;
+            ContextWithSpec.AbilitySpec = Spec;
+
+            Candidate.CachedScore = Candidate.AIInterface->CalcAIScore(ContextWithSpec);
+            Candidate.ScoreFrame = FrameNumber;
+            Candidate.ScoreTarget = TargetKey;
+            Candidate.ScoreDistance = Context.DistanceToTarget;
+            Candidate.ScoreAngle = Context.AngleToTarget;
+            Candidate.bScoreMustFirst = Context.bMustFirst;
+        }
+
+        if (Candidate.CachedScore <= 0.f)
         {
             continue;
         }
 
-        const FGameplayAbilityActorInfo* ActorInfo = ASC->AbilityActorInfo.Get();
+        FGameplayTag UniqueTag;
+        for (const FGameplayTag& Tag : Candidate.AllTags)
+        {
+            if (SearchTags.HasTagExact(Tag))
+            {
+                UniqueTag = Tag;
+                break;
+            }
+        }
+
+        if (!UniqueTag.IsValid())
+        {
+            UniqueTag = Candidate.FallbackTag;
+        }
 
-        
-        if (!Ability->CheckCooldown(Spec.Handle, ActorInfo))
+        if (UniqueTag.IsValid())
+        {
+            OutScored.Add({ UniqueTag, Candidate.CachedScore });
+        }
+    }
+}
+
+void USFCombatComponentBase::RebuildAbilityCandidates(UAbilitySystemComponent* ASC)
+{
+    ResetAbilityCandidates();
+
+    CandidateASC = ASC;
+    bAbilityCandidatesDirty = false;
+
+    // SF ASC가 아니면 부여/제거 알림이 없으므로 매 선택마다 재구성
+    if (USFAbilitySystemComponent* SFASC = Cast<USFAbilitySystemComponent>(ASC))
+    {
+        AbilityChangedHandle = SFASC->AbilityChangedDelegate.AddUObject(this, &ThisClass::HandleAbilityChanged);
+    }
+    else
+    {
+        bAbilityCandidatesDirty = true;
+    }
+
+    for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+    {
+        UGameplayAbility* Ability = Spec.Ability;
+        if (!Ability)
         {
             continue;
         }
 
-        
         ISFEnemyAbilityInterface* AIInterface = Cast<ISFEnemyAbilityInterface>(Ability);
         if (!AIInterface)
         {
             continue;
         }
 
-        
-        FEnemyAbilitySelectContext ContextWithSpec = ContextWithSpatialData;
-        ContextWithSpec.AbilitySpec = &Spec;
+        FSFAbilityCandidate& Candidate = AbilityCandidates.AddDefaulted_GetRef();
+        Candidate.Handle = Spec.Handle;
+        Candidate.Ability = Ability;
+        Candidate.AIInterface = AIInterface;
 
-        float Score = AIInterface->CalcAIScore(ContextWithSpec);
+        Candidate.AllTags.AppendTags(Ability->AbilityTags);
+        Candidate.AllTags.AppendTags(Ability->GetAssetTags());
 
-        if (Score > 0.f)
+        if (Ability->AbilityTags.Num() > 0)
         {
-           
-            FGameplayTag UniqueTag;
-            for (const FGameplayTag& Tag : AllTags)
-            {
-                if (SearchTags.HasTagExact(Tag))
-                {
-                    UniqueTag = Tag;
-                    break;
-                }
-            }
+            Candidate.FallbackTag = Ability->AbilityTags.First();
+        }
+        else if (Ability->GetAssetTags().Num() > 0)
+        {
+            Candidate.FallbackTag = Ability->GetAssetTags().First();
+        }
 
-            if (!UniqueTag.IsValid())
+        if (const FGameplayTagContainer* CooldownTags = Ability->GetCooldownTags())
+        {
+            Candidate.CooldownTags.AppendTags(*CooldownTags);
+        }
+        if (const USFGA_Enemy_BaseAttack* Attack = Cast<USFGA_Enemy_BaseAttack>(Ability))
+        {
+            if (Attack->GetCoolDownTag().IsValid())
             {
-                if (Ability->AbilityTags.Num() > 0)
-                {
-                    UniqueTag = Ability->AbilityTags.First();
-                }
-                else if (Ability->GetAssetTags().Num() > 0)
-                {
-                    UniqueTag = Ability->GetAssetTags().First();
-                }
+                Candidate.CooldownTags.AddTag(Attack->GetCoolDownTag());
             }
+        }
 
-            if (UniqueTag.IsValid())
-            {
-                Candidates.Add(UniqueTag);
-                Weights.Add(Score);
-                TotalWeight += Score;
-            }
+        const int32 CandidateIndex = AbilityCandidates.Num() - 1;
+        for (const FGameplayTag& CooldownTag : Candidate.CooldownTags)
+        {
+            CooldownTagToCandidates.FindOrAdd(CooldownTag).Add(CandidateIndex);
         }
     }
 
-    // No candidates
-    if (Candidates.Num() == 0)
+    // 쿨다운 태그는 후보 간에 공유될 수 있으므로 태그당 한 번만 등록
+    for (const TPair<FGameplayTag, TArray<int32>>& Pair : CooldownTagToCandidates)
     {
-        return false;
+        CooldownTagEventHandles.Add(Pair.Key,
+            ASC->RegisterGameplayTagEvent(Pair.Key, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &ThisClass::HandleCooldownTagChanged));
     }
 
-    // Weighted random selection
-    float RandomValue = FMath::FRandRange(0.f, TotalWeight);
+    CooldownReadyBits.Init(false, AbilityCandidates.Num());
+    for (int32 Index = 0; Index < AbilityCandidates.Num(); ++Index)
+    {
+        RefreshCooldownReady(Index);
+    }
+}
 
-    for (int32 i = 0; i < Candidates.Num(); ++i)
+void USFCombatComponentBase::ResetAbilityCandidates()
+{
+    if (UAbilitySystemComponent* ASC = CandidateASC.Get())
     {
-        if (RandomValue <= Weights[i])
+        for (const TPair<FGameplayTag, FDelegateHandle>& Pair : CooldownTagEventHandles)
         {
-            OutSelectedTag = Candidates[i];
-            return true;
+            ASC->RegisterGameplayTagEvent(Pair.Key, EGameplayTagEventType::NewOrRemoved).Remove(Pair.Value);
+        }
+
+        if (USFAbilitySystemComponent* SFASC = Cast<USFAbilitySystemComponent>(ASC))
+        {
+            SFASC->AbilityChangedDelegate.Remove(AbilityChangedHandle);
         }
-        RandomValue -= Weights[i];
     }
 
-    // Fallback to last candidate
-    OutSelectedTag = Candidates.Last();
-    return true;
+    AbilityCandidates.Reset();
+    CooldownReadyBits.Empty();
+    CooldownTagToCandidates.Reset();
+    CooldownTagEventHandles.Reset();
+    AbilityChangedHandle.Reset();
+    CandidateASC.Reset();
+    bAbilityCandidatesDirty = true;
+}
+
+void USFCombatComponentBase::RefreshCooldownReady(int32 CandidateIndex)
+{
+    const UAbilitySystemComponent* ASC = CandidateASC.Get();
+    if (!ASC || !AbilityCandidates.IsValidIndex(CandidateIndex))
+    {
+        return;
+    }
+
+    // CheckCooldown과 같은 판정: 쿨다운 태그 중 하나라도 보유 중이면 사용 불가
+    const bool bReady = !ASC->HasAnyMatchingGameplayTags(AbilityCandidates[CandidateIndex].CooldownTags);
+    CooldownReadyBits[CandidateIndex] = bReady;
+}
+
+void USFCombatComponentBase::HandleAbilityChanged(FGameplayAbilitySpecHandle Handle, bool bGiven)
+{
+    bAbilityCandidatesDirty = true;
+}
+
+void USFCombatComponentBase::HandleCooldownTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+    if (const TArray<int32>* CandidateIndices = CooldownTagToCandidates.Find(Tag))
+    {
+        for (const int32 CandidateIndex : *CandidateIndices)
+        {
+            RefreshCooldownReady(CandidateIndex);
+        }
+    }
 }
 
 void USFCombatComponentBase::SetGameplayTagStatus(const FGameplayTag& Tag, bool bActive)
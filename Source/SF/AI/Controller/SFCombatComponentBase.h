@@ -3,10 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayAbilitySpec.h"
 #include "GameplayTagContainer.h"
 #include "Components/ControllerComponent.h"
+#include "UObject/ObjectKey.h"
 #include "SFCombatComponentBase.generated.h"
 
+class ISFEnemyAbilityInterface;
+class UAbilitySystemComponent;
+class UGameplayAbility;
 class USFAbilitySystemComponent;
 struct FEnemyAbilitySelectContext;
 
@@ -40,6 +45,74 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Combat")
     FOnCombatStateChanged OnCombatStateChanged;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+    // SelectAbility 후보 (점수 > 0, 쿨다운 준비 완료)
+    struct FSFScoredAbility
+    {
+        FGameplayTag Tag;
+        float Score = 0.f;
+    };
+
+    // 캐시된 후보 테이블에서 SearchTags에 맞고 쿨다운이 끝난 어빌리티만 점수 계산
+    // Context는 거리/각도가 채워진 상태여야 함 (AbilitySpec은 여기서 설정)
+    void GatherScoredAbilities(
+        UAbilitySystemComponent* ASC,
+        const FEnemyAbilitySelectContext& Context,
+        const FGameplayTagContainer& SearchTags,
+        TArray<FSFScoredAbility>& OutScored);
+
+    // 후보 테이블을 비우고 쿨다운 태그 이벤트 해제 (다음 선택 때 재구성)
+    void ResetAbilityCandidates();
+
+private:
+    // 부여된 어빌리티 하나에 대해 미리 계산해 둔 선택 정보
+    struct FSFAbilityCandidate
+    {
+        FGameplayAbilitySpecHandle Handle;
+        TWeakObjectPtr<UGameplayAbility> Ability;
+        ISFEnemyAbilityInterface* AIInterface = nullptr;
+
+        // AbilityTags + AssetTags
+        FGameplayTagContainer AllTags;
+
+        // SearchTags와 정확히 일치하는 태그가 없을 때 사용할 태그
+        FGameplayTag FallbackTag;
+
+        // 쿨다운 GE 부여 태그 + 적 공격의 CoolDownTag
+        FGameplayTagContainer CooldownTags;
+
+        // 같은 프레임, 같은 컨텍스트에서 다시 선택할 때 CalcAIScore 재사용
+        uint64 ScoreFrame = MAX_uint64;
+        TObjectKey<AActor> ScoreTarget;
+        float ScoreDistance = 0.f;
+        float ScoreAngle = 0.f;
+        bool bScoreMustFirst = false;
+        float CachedScore = 0.f;
+    };
+
+    void RebuildAbilityCandidates(UAbilitySystemComponent* ASC);
+    void RefreshCooldownReady(int32 CandidateIndex);
+
+    void HandleAbilityChanged(FGameplayAbilitySpecHandle Handle, bool bGiven);
+    void HandleCooldownTagChanged(const FGameplayTag Tag, int32 NewCount);
+
+    TArray<FSFAbilityCandidate> AbilityCandidates;
+
+    // 후보별 쿨다운 준비 여부 (쿨다운 태그 이벤트로 갱신)
+    TBitArray<> CooldownReadyBits;
+
+    // 쿨다운 태그 → 해당 태그를 쓰는 후보 인덱스
+    TMap<FGameplayTag, TArray<int32>> CooldownTagToCandidates;
+    TMap<FGameplayTag, FDelegateHandle> CooldownTagEventHandles;
+
+    TWeakObjectPtr<UAbilitySystemComponent> CandidateASC;
+    FDelegateHandle AbilityChangedHandle;
+
+    // 어빌리티 부여/제거 시 true → 다음 선택 때 재구성
+    bool bAbilityCandidatesDirty = true;
+
 protected:
     
     virtual void EvaluateTarget() PURE_VIRTUAL(USFCombatComponentBase::EvaluateTarget, );
@@ -61,5 +134,8 @@ protected:
     
     UPROPERTY(EditDefaultsOnly, Category = "Combat")
     float ScoreDifferenceThreshold = 100.f;
+
+    // 선택마다 재사용하는 후보 버퍼
+    TArray<FSFScoredAbility> ScoredAbilityScratch;
 };
 
@@ -0,0 +1,28 @@
+#include "SFAILODSettings.h"
+
+USFAILODSettings::USFAILODSettings()
+{
+	EngagedTier.MaxHeroDistance = 2000.f;
+	EngagedTier.NetUpdateFrequency = 100.f;
+
+	NearTier.MaxHeroDistance = 5000.f;
+	NearTier.BehaviorTreeTickInterval = 0.1f;
+	NearTier.StateMachineTickInterval = 0.1f;
+	NearTier.AnimTickInterval = 1.f / 30.f;
+	NearTier.NetUpdateFrequency = 30.f;
+
+	FarTier.BehaviorTreeTickInterval = 0.5f;
+	FarTier.StateMachineTickInterval = 0.5f;
+	FarTier.AnimTickInterval = 0.1f;
+	FarTier.NetUpdateFrequency = 5.f;
+}
+
+const FSFAILODTierSettings& USFAILODSettings::GetTierSettings(ESFAILODTier Tier) const
+{
+	switch (Tier)
+	{
+	case ESFAILODTier::Engaged:	return EngagedTier;
+	case ESFAILODTier::Near:	return NearTier;
+	default:					return FarTier;
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "SFAILODSettings.generated.h"
+
+/**
+ * 적 AI LOD 단계
+ */
+UENUM(BlueprintType)
+enum class ESFAILODTier : uint8
+{
+	Engaged,	// Hero 근처, 전투 중일 수 있음 → 전체 갱신
+	Near,		// 가까이 있거나 플레이어 시야 안
+	Far			// 모든 Hero와 멀고 보이지 않음
+};
+
+/**
+ * 단계별 갱신 주기 (0이면 매 프레임)
+ */
+USTRUCT()
+struct FSFAILODTierSettings
+{
+	GENERATED_BODY()
+
+	// 가장 가까운 Hero와의 거리가 이 값 이하이면 이 단계 (Far는 무시)
+	UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+	float MaxHeroDistance = 0.f;
+
+	UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+	float BehaviorTreeTickInterval = 0.f;
+
+	UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+	float StateMachineTickInterval = 0.f;
+
+	// 메시(애니메이션) 틱 주기
+	UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+	float AnimTickInterval = 0.f;
+
+	UPROPERTY(EditAnywhere, Category = "LOD", meta = (ClampMin = "1.0"))
+	float NetUpdateFrequency = 100.f;
+};
+
+/**
+ * 적 AI LOD(USFAILODSubsystem) 설정
+ */
+UCLASS(Config=Game, DefaultConfig, meta = (DisplayName = "SF AI LOD Settings"))
+class SF_API USFAILODSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	USFAILODSettings();
+
+	const FSFAILODTierSettings& GetTierSettings(ESFAILODTier Tier) const;
+
+public:
+	UPROPERTY(Config, EditAnywhere, Category = "LOD")
+	bool bEnableAILOD = true;
+
+	// 모든 적이 이 주기 안에 한 번씩 재분류되도록 프레임마다 분산 처리
+	UPROPERTY(Config, EditAnywhere, Category = "LOD", meta = (ClampMin = "0.05"))
+	float EvaluationInterval = 0.25f;
+
+	// 먼 단계로 내려갈 때만 추가로 요구하는 거리 (경계에서 단계가 튀는 것 방지)
+	UPROPERTY(Config, EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+	float HysteresisDistance = 300.f;
+
+	// 플레이어 시야(카메라 전방 원뿔) 판정 반각(도)과 최대 거리
+	UPROPERTY(Config, EditAnywhere, Category = "LOD", meta = (ClampMin = "1.0", ClampMax = "90.0"))
+	float PlayerViewHalfAngle = 60.f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "LOD", meta = (ClampMin = "0.0"))
+	float PlayerViewDistance = 6000.f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Tiers")
+	FSFAILODTierSettings EngagedTier;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Tiers")
+	FSFAILODTierSettings NearTier;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Tiers")
+	FSFAILODTierSettings FarTier;
+};
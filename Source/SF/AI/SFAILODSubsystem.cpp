@@ -0,0 +1,254 @@
+#include "SFAILODSubsystem.h"
+
+#include "AIController.h"
+#include "AI/BehaviorTree/SFBehaviorTreeComponent.h"
+#include "AI/StateMachine/SFStateMachine.h"
+#include "Character/Enemy/SFEnemy.h"
+#include "Character/Enemy/SFEnemyGameplayTags.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameModes/SFEnemyManagerComponent.h"
+#include "GameModes/SFGameState.h"
+#include "System/SFSpatialHashSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFAILODSubsystem)
+
+DECLARE_STATS_GROUP(TEXT("SF AI LOD"), STATGROUP_SFAILOD, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("AILOD Tick"), STAT_SFAILOD_Tick, STATGROUP_SFAILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Engaged Enemies"), STAT_SFAILOD_Engaged, STATGROUP_SFAILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Near Enemies"), STAT_SFAILOD_Near, STATGROUP_SFAILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Far Enemies"), STAT_SFAILOD_Far, STATGROUP_SFAILOD);
+
+USFAILODSubsystem* USFAILODSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<USFAILODSubsystem>() : nullptr;
+}
+
+void USFAILODSubsystem::Deinitialize()
+{
+	Viewers.Empty();
+	EnemyTiers.Empty();
+
+	Super::Deinitialize();
+}
+
+bool USFAILODSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USFAILODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USFAILODSubsystem, STATGROUP_Tickables);
+}
+
+ESFAILODTier USFAILODSubsystem::GetTier(const ASFEnemy* Enemy) const
+{
+	const ESFAILODTier* Tier = EnemyTiers.Find(TObjectKey<ASFEnemy>(Enemy));
+	return Tier ? *Tier : ESFAILODTier::Engaged;
+}
+
+void USFAILODSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SFAILOD_Tick);
+
+	UWorld* World = GetWorld();
+	const USFAILODSettings* Settings = GetDefault<USFAILODSettings>();
+	if (!Settings->bEnableAILOD || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	const ASFGameState* GameState = World->GetGameState<ASFGameState>();
+	const USFEnemyManagerComponent* EnemyManager = GameState ? GameState->GetEnemyManager() : nullptr;
+	if (!EnemyManager)
+	{
+		return;
+	}
+
+	const TArray<FSFEnemyRegistryEntry>& Enemies = EnemyManager->GetAliveEnemies();
+	if (Enemies.Num() == 0)
+	{
+		EnemyTiers.Reset();
+		NextEnemyIndex = 0;
+		return;
+	}
+
+	GatherViewers();
+
+	// EvaluationInterval 안에 모든 적을 한 번씩 평가하도록 이번 프레임 몫만 처리
+	PendingEvaluationBudget += Enemies.Num() * DeltaTime / Settings->EvaluationInterval;
+	const int32 NumToEvaluate = FMath::Min(FMath::FloorToInt32(PendingEvaluationBudget), Enemies.Num());
+	PendingEvaluationBudget = FMath::Min(PendingEvaluationBudget - NumToEvaluate, static_cast<float>(Enemies.Num()));
+
+	for (int32 Step = 0; Step < NumToEvaluate; ++Step)
+	{
+		if (NextEnemyIndex >= Enemies.Num())
+		{
+			// 한 바퀴 돌 때마다 사라진 적의 상태 정리
+			NextEnemyIndex = 0;
+			PruneStates();
+		}
+
+		const FSFEnemyRegistryEntry& Entry = Enemies[NextEnemyIndex++];
+		ASFEnemy* Enemy = Entry.Enemy.Get();
+		if (!Enemy)
+		{
+			continue;
+		}
+
+		const TObjectKey<ASFEnemy> Key(Enemy);
+		const ESFAILODTier* CurrentTier = EnemyTiers.Find(Key);
+		const ESFAILODTier NewTier = EvaluateTier(Enemy, Entry.Location, CurrentTier ? *CurrentTier : ESFAILODTier::Engaged, *Settings);
+
+		// 단계가 바뀐 경우(또는 첫 분류)에만 적용
+		if (!CurrentTier || *CurrentTier != NewTier)
+		{
+			ApplyTier(Enemy, NewTier, *Settings);
+			EnemyTiers.Add(Key, NewTier);
+		}
+	}
+
+#if STATS
+	int32 NumPerTier[3] = { 0, 0, 0 };
+	for (const TPair<TObjectKey<ASFEnemy>, ESFAILODTier>& Pair : EnemyTiers)
+	{
+		++NumPerTier[static_cast<int32>(Pair.Value)];
+	}
+	SET_DWORD_STAT(STAT_SFAILOD_Engaged, NumPerTier[static_cast<int32>(ESFAILODTier::Engaged)]);
+	SET_DWORD_STAT(STAT_SFAILOD_Near, NumPerTier[static_cast<int32>(ESFAILODTier::Near)]);
+	SET_DWORD_STAT(STAT_SFAILOD_Far, NumPerTier[static_cast<int32>(ESFAILODTier::Far)]);
+#endif
+}
+
+void USFAILODSubsystem::GatherViewers()
+{
+	Viewers.Reset();
+
+	USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this);
+	if (!SpatialHash)
+	{
+		return;
+	}
+
+	TArray<AActor*> HeroActors;
+	SpatialHash->GetActorsOfCategory(FSFSpatialQueryParams(ESFSpatialCategory::Hero), HeroActors);
+
+	for (const AActor* HeroActor : HeroActors)
+	{
+		const APawn* HeroPawn = Cast<APawn>(HeroActor);
+		if (!HeroPawn)
+		{
+			continue;
+		}
+
+		FViewerInfo& Viewer = Viewers.AddDefaulted_GetRef();
+		Viewer.Location = HeroPawn->GetActorLocation();
+
+		// 서버에서는 복제된 ControlRotation 기준 시점 (카메라 위치는 폰 시점으로 근사)
+		FRotator ViewRotation = HeroPawn->GetActorRotation();
+		Viewer.ViewLocation = Viewer.Location;
+		if (const APlayerController* PC = Cast<APlayerController>(HeroPawn->GetController()))
+		{
+			PC->GetPlayerViewPoint(Viewer.ViewLocation, ViewRotation);
+		}
+		Viewer.ViewDirection = ViewRotation.Vector();
+	}
+}
+
+ESFAILODTier USFAILODSubsystem::EvaluateTier(const ASFEnemy* Enemy, const FVector& EnemyLocation, ESFAILODTier CurrentTier, const USFAILODSettings& Settings) const
+{
+	if (Enemy->GetEnemyType() == SFGameplayTags::Enemy_Type_Boss)
+	{
+		return ESFAILODTier::Engaged;
+	}
+
+	float NearestDistSq = TNumericLimits<float>::Max();
+	bool bSeenByPlayer = false;
+
+	const float ViewCos = FMath::Cos(FMath::DegreesToRadians(Settings.PlayerViewHalfAngle));
+	const float ViewDistSq = FMath::Square(Settings.PlayerViewDistance);
+
+	for (const FViewerInfo& Viewer : Viewers)
+	{
+		NearestDistSq = FMath::Min(NearestDistSq, FVector::DistSquared(Viewer.Location, EnemyLocation));
+
+		if (!bSeenByPlayer)
+		{
+			const FVector ToEnemy = EnemyLocation - Viewer.ViewLocation;
+			const float DistSq = ToEnemy.SizeSquared();
+			bSeenByPlayer = DistSq <= ViewDistSq && FVector::DotProduct(ToEnemy.GetSafeNormal(), Viewer.ViewDirection) >= ViewCos;
+		}
+	}
+
+	const float NearestDist = FMath::Sqrt(NearestDistSq);
+
+	// 현재보다 먼 단계로 내려갈 때만 히스테리시스 적용
+	auto FitsTier = [&](ESFAILODTier Tier)
+	{
+		const float Margin = Tier < CurrentTier ? 0.f : Settings.HysteresisDistance;
+		return NearestDist <= Settings.GetTierSettings(Tier).MaxHeroDistance + Margin;
+	};
+
+	ESFAILODTier NewTier = ESFAILODTier::Far;
+	if (FitsTier(ESFAILODTier::Engaged))
+	{
+		NewTier = ESFAILODTier::Engaged;
+	}
+	else if (FitsTier(ESFAILODTier::Near))
+	{
+		NewTier = ESFAILODTier::Near;
+	}
+
+	// 플레이어 화면 안이면 최소 Near (애니메이션/복제가 눈에 띄게 끊기지 않도록)
+	if (bSeenByPlayer && NewTier == ESFAILODTier::Far)
+	{
+		NewTier = ESFAILODTier::Near;
+	}
+
+	return NewTier;
+}
+
+void USFAILODSubsystem::ApplyTier(ASFEnemy* Enemy, ESFAILODTier Tier, const USFAILODSettings& Settings) const
+{
+	const FSFAILODTierSettings& TierSettings = Settings.GetTierSettings(Tier);
+
+	Enemy->SetNetUpdateFrequency(TierSettings.NetUpdateFrequency);
+
+	if (USkeletalMeshComponent* Mesh = Enemy->GetMesh())
+	{
+		Mesh->SetComponentTickInterval(TierSettings.AnimTickInterval);
+	}
+
+	if (USFStateMachine* StateMachine = USFStateMachine::FindStateMachineComponent(Enemy))
+	{
+		StateMachine->SetComponentTickInterval(TierSettings.StateMachineTickInterval);
+	}
+
+	if (const AAIController* AIController = Cast<AAIController>(Enemy->GetController()))
+	{
+		// 기본 BT 컴포넌트는 틱 주기를 매 틱 덮어쓰므로 최소 주기를 지키는 컴포넌트에만 적용
+		if (USFBehaviorTreeComponent* BehaviorTreeComponent = Cast<USFBehaviorTreeComponent>(AIController->GetBrainComponent()))
+		{
+			BehaviorTreeComponent->SetMinTickInterval(TierSettings.BehaviorTreeTickInterval);
+		}
+	}
+}
+
+void USFAILODSubsystem::PruneStates()
+{
+	for (auto It = EnemyTiers.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/SFAILODSettings.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SFAILODSubsystem.generated.h"
+
+class ASFEnemy;
+
+/**
+ * USFAILODSubsystem
+ * 서버에서 적을 가장 가까운 Hero와의 거리 + 플레이어 시야 여부로 단계(ESFAILODTier) 분류하고
+ * 단계별 BT/StateMachine/애니메이션 틱 주기와 NetUpdateFrequency를 적용하는 월드 서브시스템
+ * - 대상 목록은 USFEnemyManagerComponent 레지스트리를 사용
+ * - EvaluationInterval 안에 모든 적이 한 번씩 재분류되도록 프레임마다 분산 처리
+ * - 먼 단계로 내려갈 때는 HysteresisDistance만큼 더 멀어져야 함
+ * - 보스는 항상 Engaged
+ */
+UCLASS()
+class SF_API USFAILODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFAILODSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of UTickableWorldSubsystem interface
+
+	// 현재 단계 (분류 전이면 Engaged)
+	ESFAILODTier GetTier(const ASFEnemy* Enemy) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FViewerInfo
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector ViewLocation = FVector::ZeroVector;
+		FVector ViewDirection = FVector::ForwardVector;
+	};
+
+	void GatherViewers();
+	ESFAILODTier EvaluateTier(const ASFEnemy* Enemy, const FVector& EnemyLocation, ESFAILODTier CurrentTier, const USFAILODSettings& Settings) const;
+	void ApplyTier(ASFEnemy* Enemy, ESFAILODTier Tier, const USFAILODSettings& Settings) const;
+	void PruneStates();
+
+private:
+	// Hero 위치 + 플레이어 시점 (프레임당 한 번 수집)
+	TArray<FViewerInfo> Viewers;
+
+	// 적별 현재 단계
+	TMap<TObjectKey<ASFEnemy>, ESFAILODTier> EnemyTiers;
+
+	// 다음 프레임에 평가를 시작할 레지스트리 인덱스 (라운드 로빈)
+	int32 NextEnemyIndex = 0;
+	float PendingEvaluationBudget = 0.f;
+};
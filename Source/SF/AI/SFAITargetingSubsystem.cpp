@@ -0,0 +1,217 @@
+#include "SFAITargetingSubsystem.h"
+
+#include "AIController.h"
+#include "Engine/World.h"
+#include "GameplayTagAssetInterface.h"
+#include "Character/SFCharacterGameplayTags.h"
+#include "Perception/AIPerceptionComponent.h"
+#include "Perception/AISense_Sight.h"
+#include "System/SFSpatialHashSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFAITargetingSubsystem)
+
+DECLARE_STATS_GROUP(TEXT("SF AI Targeting"), STATGROUP_SFAITargeting, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("AITargeting Tick"), STAT_SFAITargeting_Tick, STATGROUP_SFAITargeting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targeting Rows"), STAT_SFAITargeting_NumRows, STATGROUP_SFAITargeting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rows Updated Per Frame"), STAT_SFAITargeting_RowsUpdated, STATGROUP_SFAITargeting);
+
+USFAITargetingSubsystem* USFAITargetingSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<USFAITargetingSubsystem>() : nullptr;
+}
+
+void USFAITargetingSubsystem::Deinitialize()
+{
+	Heroes.Empty();
+	Rows.Empty();
+	RowIndexMap.Empty();
+
+	Super::Deinitialize();
+}
+
+bool USFAITargetingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USFAITargetingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USFAITargetingSubsystem, STATGROUP_Tickables);
+}
+
+void USFAITargetingSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SFAITargeting_Tick);
+
+	if (Rows.Num() == 0)
+	{
+		SET_DWORD_STAT(STAT_SFAITargeting_NumRows, 0);
+		return;
+	}
+
+	RefreshHeroes();
+
+	// 모든 행이 UpdateInterval 안에 한 번씩 갱신되도록 이번 프레임 몫만 처리
+	PendingRowBudget += Rows.Num() * DeltaTime / FMath::Max(UpdateInterval, KINDA_SMALL_NUMBER);
+	const int32 NumToUpdate = FMath::Min(FMath::FloorToInt32(PendingRowBudget), Rows.Num());
+	PendingRowBudget = FMath::Min(PendingRowBudget - NumToUpdate, static_cast<float>(Rows.Num()));
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+	int32 NumUpdated = 0;
+
+	for (int32 Step = 0; Step < NumToUpdate && Rows.Num() > 0; ++Step)
+	{
+		if (NextRowIndex >= Rows.Num())
+		{
+			NextRowIndex = 0;
+		}
+
+		FSFAITargetingRow& Row = Rows[NextRowIndex];
+		if (!Row.Controller.IsValid() || !Row.Controller->GetPawn())
+		{
+			// 제거 시 마지막 행이 이 자리로 오므로 인덱스는 그대로 둠
+			RemoveRowAt(NextRowIndex);
+			continue;
+		}
+
+		RefreshRow(Row, CurrentTime);
+		++NextRowIndex;
+		++NumUpdated;
+	}
+
+	SET_DWORD_STAT(STAT_SFAITargeting_NumRows, Rows.Num());
+	SET_DWORD_STAT(STAT_SFAITargeting_RowsUpdated, NumUpdated);
+}
+
+const FSFAITargetingRow* USFAITargetingSubsystem::GetTargetingRow(AAIController* Controller)
+{
+	if (!Controller || !Controller->GetPawn())
+	{
+		return nullptr;
+	}
+
+	const TObjectKey<AAIController> Key(Controller);
+	if (const int32* RowIndex = RowIndexMap.Find(Key))
+	{
+		return &Rows[*RowIndex];
+	}
+
+	// 첫 요청: 등록 후 즉시 채워서 첫 틱부터 유효한 데이터 제공
+	RefreshHeroes();
+
+	const int32 RowIndex = Rows.AddDefaulted();
+	FSFAITargetingRow& Row = Rows[RowIndex];
+	Row.Controller = Controller;
+	Row.Key = Key;
+	RowIndexMap.Add(Key, RowIndex);
+
+	RefreshRow(Row, GetWorld()->GetTimeSeconds());
+	return &Row;
+}
+
+void USFAITargetingSubsystem::UnregisterController(const AAIController* Controller)
+{
+	if (const int32* RowIndex = RowIndexMap.Find(TObjectKey<AAIController>(Controller)))
+	{
+		RemoveRowAt(*RowIndex);
+	}
+}
+
+void USFAITargetingSubsystem::RefreshHeroes()
+{
+	// 같은 프레임 안에서는 한 번만 수집
+	if (HeroesFrame == GFrameCounter)
+	{
+		return;
+	}
+	HeroesFrame = GFrameCounter;
+
+	Heroes.Reset();
+
+	USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this);
+	if (!SpatialHash)
+	{
+		return;
+	}
+
+	TArray<AActor*> HeroActors;
+	SpatialHash->GetActorsOfCategory(FSFSpatialQueryParams(ESFSpatialCategory::Hero), HeroActors);
+
+	Heroes.Reserve(HeroActors.Num());
+	for (AActor* HeroActor : HeroActors)
+	{
+		if (!IsValid(HeroActor))
+		{
+			continue;
+		}
+
+		FHeroInfo& Info = Heroes.AddDefaulted_GetRef();
+		Info.Actor = HeroActor;
+		Info.Location = HeroActor->GetActorLocation();
+
+		if (const IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(HeroActor))
+		{
+			Info.bDead = TagInterface->HasMatchingGameplayTag(SFGameplayTags::Character_State_Dead);
+			Info.bInvulnerable = TagInterface->HasMatchingGameplayTag(SFGameplayTags::Character_State_Invulnerable);
+		}
+	}
+}
+
+void USFAITargetingSubsystem::RefreshRow(FSFAITargetingRow& Row, double CurrentTime) const
+{
+	Row.Candidates.Reset();
+	Row.LastUpdateTime = CurrentTime;
+
+	const AAIController* Controller = Row.Controller.Get();
+	const APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+	if (!Pawn)
+	{
+		return;
+	}
+
+	const FVector PawnLocation = Pawn->GetActorLocation();
+	const UAIPerceptionComponent* PerceptionComp = Controller->GetPerceptionComponent();
+	const FAISenseID SightSenseID = UAISense::GetSenseID<UAISense_Sight>();
+
+	Row.Candidates.Reserve(Heroes.Num());
+	for (const FHeroInfo& Hero : Heroes)
+	{
+		const AActor* HeroActor = Hero.Actor.Get();
+		if (!HeroActor || HeroActor == Pawn)
+		{
+			continue;
+		}
+
+		FSFAITargetCandidate& Candidate = Row.Candidates.AddDefaulted_GetRef();
+		Candidate.Actor = Hero.Actor;
+		Candidate.Location = Hero.Location;
+		Candidate.Distance = FVector::Dist(PawnLocation, Hero.Location);
+		Candidate.bDead = Hero.bDead;
+		Candidate.bInvulnerable = Hero.bInvulnerable;
+
+		if (PerceptionComp)
+		{
+			const FActorPerceptionInfo* Info = PerceptionComp->GetActorInfo(*HeroActor);
+			Candidate.bVisible = Info && Info->IsSenseActive(SightSenseID);
+		}
+	}
+}
+
+void USFAITargetingSubsystem::RemoveRowAt(int32 RowIndex)
+{
+	RowIndexMap.Remove(Rows[RowIndex].Key);
+
+	const int32 LastIndex = Rows.Num() - 1;
+	if (RowIndex != LastIndex)
+	{
+		RowIndexMap.Add(Rows[LastIndex].Key, RowIndex);
+	}
+
+	Rows.RemoveAtSwap(RowIndex, 1, EAllowShrinking::No);
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SFAITargetingSubsystem.generated.h"
+
+class AAIController;
+
+/**
+ * AI 한 명 기준 Hero 하나의 캐시된 타겟팅 정보
+ */
+struct FSFAITargetCandidate
+{
+	TWeakObjectPtr<AActor> Actor;
+	FVector Location = FVector::ZeroVector;
+	float Distance = 0.f;
+
+	// Perception 시야(Sight)로 현재 감지 중
+	bool bVisible = false;
+
+	bool bDead = false;
+	bool bInvulnerable = false;
+
+	bool IsTargetable() const { return !bDead && !bInvulnerable; }
+};
+
+/**
+ * AI 한 명의 Hero 거리/시야 행 (UpdateInterval마다 분산 갱신)
+ */
+struct FSFAITargetingRow
+{
+	TWeakObjectPtr<AAIController> Controller;
+	TObjectKey<AAIController> Key;
+
+	TArray<FSFAITargetCandidate> Candidates;
+
+	double LastUpdateTime = 0.0;
+
+	const FSFAITargetCandidate* FindCandidate(const AActor* Actor) const
+	{
+		return Candidates.FindByPredicate([Actor](const FSFAITargetCandidate& Candidate) { return Candidate.Actor.Get() == Actor; });
+	}
+};
+
+/**
+ * USFAITargetingSubsystem
+ * 적 AI × Hero 거리/시야 행렬을 서버에서 한 곳에 캐시하는 월드 서브시스템
+ * - Hero 목록과 상태(사망/무적)는 프레임당 한 번만 조회
+ * - 각 AI 행은 UpdateInterval 주기로 갱신하되, 프레임마다 일부만 처리하도록 분산(time-slicing)
+ * - BT 서비스는 GetTargetingRow로 캐시를 읽기만 함 (첫 요청 시 자동 등록)
+ * - ASFBaseAIController가 빙의 해제/EndPlay 때 UnregisterController로 해제. 그 외 경로로 사라진 행은 Tick에서 정리
+ */
+UCLASS(Config = Game)
+class SF_API USFAITargetingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFAITargetingSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of UTickableWorldSubsystem interface
+
+	// Controller의 캐시된 행. 미등록이면 등록 후 즉시 채워서 반환
+	// 반환 포인터는 다음 등록/갱신 전까지만 유효
+	const FSFAITargetingRow* GetTargetingRow(AAIController* Controller);
+
+	// 빙의 해제/EndPlay 시 호출
+	void UnregisterController(const AAIController* Controller);
+
+	int32 GetNumRows() const { return Rows.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FHeroInfo
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector Location = FVector::ZeroVector;
+		bool bDead = false;
+		bool bInvulnerable = false;
+	};
+
+	void RefreshHeroes();
+	void RefreshRow(FSFAITargetingRow& Row, double CurrentTime) const;
+	void RemoveRowAt(int32 RowIndex);
+
+private:
+	// AI 한 명의 행 갱신 주기(초). 모든 행이 이 주기 안에 한 번씩 갱신되도록 프레임마다 분산
+	UPROPERTY(Config)
+	float UpdateInterval = 0.1f;
+
+	TArray<FHeroInfo> Heroes;
+	uint64 HeroesFrame = 0;
+
+	TArray<FSFAITargetingRow> Rows;
+	TMap<TObjectKey<AAIController>, int32> RowIndexMap;
+
+	// 다음 프레임에 갱신을 시작할 행 (라운드 로빈)
+	int32 NextRowIndex = 0;
+
+	// 분산 갱신 시 소수점 이하 몫 누적
+	float PendingRowBudget = 0.f;
+};
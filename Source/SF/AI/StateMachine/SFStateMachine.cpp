@@ -3,6 +3,8 @@
 
 #include "AI/StateMachine/SFStateMachine.h"
 
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
 #include "Character/Enemy/SFEnemyData.h"
 
 #include  UE_INLINE_GENERATED_CPP_BY_NAME(SFStateMachine)
@@ -11,17 +13,29 @@ USFStateMachine::USFStateMachine(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer)
 {
 	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true;
+	// State 진입 / 전환 이벤트가 있을 때만 깨어남 (UpdateTickEnabled)
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void USFStateMachine::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	if (bTransitionEvaluationPending || bPollTransitions)
+	{
+		bTransitionEvaluationPending = false;
+		EvaluateTransitions();
+	}
+
 	if (FSFStateSpec* CurrentSpec = FindStateSpec(CurrentStateHandle))
 	{
-		CurrentSpec->Update(DeltaTime);
+		if (CurrentSpec->GetStateInstance() && CurrentSpec->GetStateInstance()->WantsUpdate())
+		{
+			CurrentSpec->Update(DeltaTime);
+		}
 	}
+
+	UpdateTickEnabled();
 }
 
 void USFStateMachine::RegisterStates(FSTStateWrapperContainer StateContainer)
@@ -41,16 +55,20 @@ FSFStateHandle USFStateMachine::RegisterState(TSubclassOf<USFState> StateClass,
 	{
 		return FSFStateHandle();
 	}
-	for (FSFStateSpec& Spec : RegisterStateSpecs)
+	if (const int32* ExistingIndex = SpecIndexByClass.Find(StateClass.Get()))
 	{
-		if (Spec.GetStateClass() == StateClass)  
-		{
-			return Spec.GetHandle();  
-		}
+		return RegisterStateSpecs[*ExistingIndex].GetHandle();
 	}
     
 	FSFStateSpec NewSpec(StateClass, StateTag);
-	RegisterStateSpecs.Add(NewSpec);
+	const int32 NewIndex = RegisterStateSpecs.Add(NewSpec);
+
+	SpecIndexByHandle.Add(NewSpec.GetHandle(), NewIndex);
+	SpecIndexByClass.Add(StateClass.Get(), NewIndex);
+	if (StateTag.IsValid() && !SpecIndexByTag.Contains(StateTag))
+	{
+		SpecIndexByTag.Add(StateTag, NewIndex);
+	}
 	return NewSpec.GetHandle();
 }
 
@@ -163,6 +181,10 @@ bool USFStateMachine::PopState()
 		return false;
 	}
 
+	// 복귀한 State 기준으로 전환 재평가
+	RequestTransitionEvaluation();
+	UpdateTickEnabled();
+
 	return true;
 }
 
@@ -180,42 +202,54 @@ void USFStateMachine::BeginPlay()
 	Super::BeginPlay();
 }
 
-FSFStateSpec* USFStateMachine::FindStateSpec(FSFStateHandle Handle)
+void USFStateMachine::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (!Handle.IsValid())
-	{
-		return nullptr;
-	}
+	UnbindTransitionWakeEvents();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USFStateMachine::SetTransitions(const TArray<FSFStateTransition>& InTransitions)
+{
+	UnbindTransitionWakeEvents();
+
+	Transitions = InTransitions;
+
+	BindTransitionWakeEvents();
+	RequestTransitionEvaluation();
+}
 
-	// RegisterStateSpecs에서 Handle로 검색
-	for (FSFStateSpec& Spec : RegisterStateSpecs)
+void USFStateMachine::RequestTransitionEvaluation()
+{
+	if (Transitions.IsEmpty())
 	{
-		if (Spec.GetHandle() == Handle)
-		{
-			return &Spec;
-		}
+		return;
 	}
 
-	return nullptr;
+	bTransitionEvaluationPending = true;
+	SetComponentTickEnabled(true);
 }
 
-const FSFStateSpec* USFStateMachine::FindStateSpec(FSFStateHandle Handle) const
+FSFStateSpec* USFStateMachine::FindStateSpec(FSFStateHandle Handle)
 {
 	if (!Handle.IsValid())
 	{
 		return nullptr;
 	}
 
-	// RegisterStateSpecs에서 Handle로 검색
-	for (const FSFStateSpec& Spec : RegisterStateSpecs)
+	const int32* Index = SpecIndexByHandle.Find(Handle);
+	return Index ? &RegisterStateSpecs[*Index] : nullptr;
+}
+
+const FSFStateSpec* USFStateMachine::FindStateSpec(FSFStateHandle Handle) const
+{
+	if (!Handle.IsValid())
 	{
-		if (Spec.GetHandle() == Handle)
-		{
-			return &Spec;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	const int32* Index = SpecIndexByHandle.Find(Handle);
+	return Index ? &RegisterStateSpecs[*Index] : nullptr;
 }
 
 FSFStateSpec* USFStateMachine::FindStateSpecByClass(TSubclassOf<USFState> StateClass)
@@ -225,16 +259,8 @@ FSFStateSpec* USFStateMachine::FindStateSpecByClass(TSubclassOf<USFState> StateC
 		return nullptr;
 	}
 
-	// RegisterStateSpecs에서 Class로 검색
-	for (FSFStateSpec& Spec : RegisterStateSpecs)
-	{
-		if (Spec.GetStateClass() == StateClass)
-		{
-			return &Spec;
-		}
-	}
-
-	return nullptr;
+	const int32* Index = SpecIndexByClass.Find(StateClass.Get());
+	return Index ? &RegisterStateSpecs[*Index] : nullptr;
 }
 
 FSFStateSpec* USFStateMachine::FindStateSpecByTag(FGameplayTag StateTag)
@@ -244,15 +270,8 @@ FSFStateSpec* USFStateMachine::FindStateSpecByTag(FGameplayTag StateTag)
 		return nullptr;
 	}
 
-	// RegisterStateSpecs에서 Tag로 검색
-	for (FSFStateSpec& Spec : RegisterStateSpecs)
-	{
-		if (Spec.GetStateTag() == StateTag)
-		{
-			return &Spec;
-		}
-	}
-	return nullptr;
+	const int32* Index = SpecIndexByTag.Find(StateTag);
+	return Index ? &RegisterStateSpecs[*Index] : nullptr;
 }
 
 bool USFStateMachine::TransitionToState(FSFStateHandle NewStateHandle)
@@ -298,6 +317,7 @@ bool USFStateMachine::TransitionToState(FSFStateHandle NewStateHandle)
 
     return true;
 }
+
 void USFStateMachine::EnterState(FSFStateSpec* Spec)
 {
 	if (!Spec)
@@ -314,8 +334,15 @@ void USFStateMachine::EnterState(FSFStateSpec* Spec)
 
 	Spec->Enter();
 
-	// Tick 활성화 (State가 Update를 필요로 할 수 있음)
-	SetComponentTickEnabled(true);
+	// OnUpdate를 쓰지 않는 State는 첫 틱을 기다리지 않고 Running (Tick을 재우므로)
+	if (!Spec->GetStateInstance() || !Spec->GetStateInstance()->WantsUpdate())
+	{
+		Spec->MarkRunning();
+	}
+
+	// 새 State에서 나가는 전환이 이미 만족되어 있을 수 있음
+	RequestTransitionEvaluation();
+	UpdateTickEnabled();
 }
 
 void USFStateMachine::ExitState(FSFStateSpec* Spec)
@@ -327,9 +354,136 @@ void USFStateMachine::ExitState(FSFStateSpec* Spec)
 
 	Spec->Exit();
 
-	// 모든 State가 종료되면 Tick 비활성화
-	if (!CurrentStateHandle.IsValid() && ActiveStateHandles.Num() == 0)
+	UpdateTickEnabled();
+}
+
+void USFStateMachine::EvaluateTransitions()
+{
+	if (Transitions.IsEmpty())
+	{
+		return;
+	}
+
+	const FSFStateSpec* CurrentSpec = FindStateSpec(CurrentStateHandle);
+	const FGameplayTag CurrentTag = CurrentSpec ? CurrentSpec->GetStateTag() : FGameplayTag();
+
+	UAbilitySystemComponent* ASC = WakeASC.Get();
+	AActor* Owner = GetOwner();
+
+	for (const FSFStateTransition& Transition : Transitions)
+	{
+		if (Transition.FromStateTag.IsValid() && Transition.FromStateTag != CurrentTag)
+		{
+			continue;
+		}
+
+		if (!Transition.ToStateTag.IsValid() || Transition.ToStateTag == CurrentTag)
+		{
+			continue;
+		}
+
+		if (!Transition.AreConditionsMet(ASC, Owner))
+		{
+			continue;
+		}
+
+		// 연쇄 전환은 EnterState가 다음 틱 평가를 예약
+		if (ActivateStateByTag(Transition.ToStateTag))
+		{
+			return;
+		}
+	}
+}
+
+void USFStateMachine::BindTransitionWakeEvents()
+{
+	bPollTransitions = false;
+
+	if (Transitions.IsEmpty())
+	{
+		return;
+	}
+
+	FGameplayTagContainer WakeTags;
+	TArray<FGameplayAttribute> WakeAttributes;
+	for (const FSFStateTransition& Transition : Transitions)
+	{
+		for (const USFPhaseCondition* Condition : Transition.Conditions)
+		{
+			if (Condition && !Condition->GetWakeEvents(WakeTags, WakeAttributes))
+			{
+				bPollTransitions = true;
+			}
+		}
+	}
+
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner());
+	if (!ASC)
+	{
+		// 이벤트를 받을 수 없으므로 매 틱 평가로 대체
+		bPollTransitions = true;
+		return;
+	}
+
+	WakeASC = ASC;
+
+	for (const FGameplayTag& Tag : WakeTags)
+	{
+		WakeTagHandles.Add(Tag, ASC->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &ThisClass::HandleWakeTagChanged));
+	}
+
+	for (const FGameplayAttribute& Attribute : WakeAttributes)
+	{
+		WakeAttributeHandles.Add(Attribute, ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &ThisClass::HandleWakeAttributeChanged));
+	}
+}
+
+void USFStateMachine::UnbindTransitionWakeEvents()
+{
+	if (UAbilitySystemComponent* ASC = WakeASC.Get())
+	{
+		for (const TPair<FGameplayTag, FDelegateHandle>& Pair : WakeTagHandles)
+		{
+			ASC->RegisterGameplayTagEvent(Pair.Key, EGameplayTagEventType::NewOrRemoved).Remove(Pair.Value);
+		}
+
+		for (const TPair<FGameplayAttribute, FDelegateHandle>& Pair : WakeAttributeHandles)
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(Pair.Key).Remove(Pair.Value);
+		}
+	}
+
+	WakeTagHandles.Reset();
+	WakeAttributeHandles.Reset();
+	WakeASC.Reset();
+	bPollTransitions = false;
+	bTransitionEvaluationPending = false;
+}
+
+void USFStateMachine::HandleWakeTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	RequestTransitionEvaluation();
+}
+
+void USFStateMachine::HandleWakeAttributeChanged(const FOnAttributeChangeData& ChangeData)
+{
+	RequestTransitionEvaluation();
+}
+
+void USFStateMachine::UpdateTickEnabled()
+{
+	bool bWantsTick = bTransitionEvaluationPending || bPollTransitions;
+
+	if (!bWantsTick)
+	{
+		if (const FSFStateSpec* CurrentSpec = FindStateSpec(CurrentStateHandle))
+		{
+			bWantsTick = CurrentSpec->GetStateInstance() && CurrentSpec->GetStateInstance()->WantsUpdate();
+		}
+	}
+
+	if (IsComponentTickEnabled() != bWantsTick)
 	{
-		SetComponentTickEnabled(false);
+		SetComponentTickEnabled(bWantsTick);
 	}
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "State/SFState.h"  
+#include "State/Boss_Dragon/SFPhaseCondition.h"
+#include "UObject/ObjectKey.h"
 #include "SFStateMachine.generated.h"
 
 // PlayerController에게 Tree교체 Order
@@ -11,6 +13,7 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FChangeTreeDelegate, FGameplayTag);
 //현재 Behaviour를 멈추라는 Tree
 DECLARE_MULTICAST_DELEGATE(FStopTreeDelegate);
 
+struct FOnAttributeChangeData;
 struct FSTStateWrapperContainer;
 
 
@@ -73,12 +76,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "State Machine")
     bool PopState();
 
+    // 전환 테이블 설정. 조건에 필요한 태그/어트리뷰트 이벤트를 ASC에 등록하고, 이벤트가 올 때만 전환 평가
+    UFUNCTION(BlueprintCallable, Category = "State Machine")
+    void SetTransitions(const TArray<FSFStateTransition>& InTransitions);
+
+    // 다음 틱에 전환 테이블을 한 번 평가
+    void RequestTransitionEvaluation();
+
 public:
     FChangeTreeDelegate OnChangeTreeDelegate;
     FStopTreeDelegate OnStopTreeDelegate;
     
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     
 private:
     
@@ -102,6 +113,18 @@ private:
     // State 종료
     void ExitState(FSFStateSpec* Spec);
 
+    // 현재 State에서 나갈 수 있는 전환을 테이블 순서대로 평가 (한 번에 하나만 전환)
+    void EvaluateTransitions();
+
+    void BindTransitionWakeEvents();
+    void UnbindTransitionWakeEvents();
+
+    void HandleWakeTagChanged(const FGameplayTag Tag, int32 NewCount);
+    void HandleWakeAttributeChanged(const FOnAttributeChangeData& ChangeData);
+
+    // OnUpdate가 필요한 State이거나 전환 평가가 남아 있을 때만 Tick
+    void UpdateTickEnabled();
+
 
 private:
 
@@ -117,4 +140,21 @@ private:
     UPROPERTY()
     TArray<FSFStateHandle> ActiveStateHandles;
 
+    // RegisterStateSpecs 인덱스 (State는 추가만 되므로 인덱스가 바뀌지 않음)
+    TMap<FSFStateHandle, int32> SpecIndexByHandle;
+    TMap<FGameplayTag, int32> SpecIndexByTag;
+    TMap<TObjectKey<UClass>, int32> SpecIndexByClass;
+
+    UPROPERTY()
+    TArray<FSFStateTransition> Transitions;
+
+    // 전환 조건을 깨우는 이벤트 등록 정보
+    TWeakObjectPtr<UAbilitySystemComponent> WakeASC;
+    TMap<FGameplayTag, FDelegateHandle> WakeTagHandles;
+    TMap<FGameplayAttribute, FDelegateHandle> WakeAttributeHandles;
+
+    bool bTransitionEvaluationPending = false;
+
+    // 이벤트로 표현할 수 없는 조건이 있으면 매 틱 평가
+    bool bPollTransitions = false;
 };
\ No newline at end of file
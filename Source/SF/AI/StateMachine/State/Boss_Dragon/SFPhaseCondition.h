@@ -14,6 +14,10 @@ class USFPhaseCondition : public UObject
 public:
 	
 	virtual bool IsMet(UAbilitySystemComponent* ASC, AActor* Owner) const { return false; }
+
+	// 조건 결과를 바꿀 수 있는 태그/어트리뷰트 (StateMachine은 이 이벤트에만 깨어나 전환을 평가)
+	// false면 이벤트로 표현할 수 없는 조건 → StateMachine이 매 틱 평가
+	virtual bool GetWakeEvents(FGameplayTagContainer& OutTags, TArray<FGameplayAttribute>& OutAttributes) const { return false; }
 };
 
 
@@ -32,6 +36,39 @@ public:
 		float MaxHP = ASC->GetNumericAttribute(USFPrimarySet_Enemy::GetMaxHealthAttribute());
 		return (HP / MaxHP) <= HealthRatio;
 	}
+
+	virtual bool GetWakeEvents(FGameplayTagContainer& OutTags, TArray<FGameplayAttribute>& OutAttributes) const override
+	{
+		OutAttributes.AddUnique(USFPrimarySet_Enemy::GetHealthAttribute());
+		OutAttributes.AddUnique(USFPrimarySet_Enemy::GetMaxHealthAttribute());
+		return true;
+	}
+};
+
+
+UCLASS()
+class USFTagPhaseCondition : public USFPhaseCondition
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere)
+	FGameplayTag Tag;
+
+	// false면 태그가 없을 때 만족
+	UPROPERTY(EditAnywhere)
+	bool bRequirePresent = true;
+
+	virtual bool IsMet(UAbilitySystemComponent* ASC, AActor* Owner) const override
+	{
+		if (!ASC || !Tag.IsValid()) return false;
+		return ASC->HasMatchingGameplayTag(Tag) == bRequirePresent;
+	}
+
+	virtual bool GetWakeEvents(FGameplayTagContainer& OutTags, TArray<FGameplayAttribute>& OutAttributes) const override
+	{
+		OutTags.AddTag(Tag);
+		return true;
+	}
 };
 
 
@@ -52,3 +89,33 @@ struct FSFPhaseData
 	}
 	
 };
+
+
+// 전환 테이블 한 줄: From 상태에서 Conditions가 모두 만족되면 To 상태로 전환
+USTRUCT(BlueprintType)
+struct FSFStateTransition
+{
+	GENERATED_BODY()
+
+	// 비어 있으면 모든 상태에서 평가
+	UPROPERTY(EditAnywhere, Category = "Transition")
+	FGameplayTag FromStateTag;
+
+	UPROPERTY(EditAnywhere, Instanced, Category = "Transition")
+	TArray<TObjectPtr<USFPhaseCondition>> Conditions;
+
+	UPROPERTY(EditAnywhere, Category = "Transition")
+	FGameplayTag ToStateTag;
+
+	bool AreConditionsMet(UAbilitySystemComponent* ASC, AActor* Owner) const
+	{
+		for (const USFPhaseCondition* Condition : Conditions)
+		{
+			if (Condition && !Condition->IsMet(ASC, Owner))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
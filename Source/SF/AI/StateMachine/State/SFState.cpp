@@ -137,6 +137,14 @@ void FSFStateSpec::Update(float DeltaTime)
 	
 }
 
+void FSFStateSpec::MarkRunning()
+{
+	if (Status == EStateStatus::Begin)
+	{
+		Status = EStateStatus::Running;
+	}
+}
+
 bool FSFStateSpec::CanTransitionTo(TSubclassOf<USFState> ToStateClass) const
 {
 	if (StateInstance)
@@ -154,6 +162,8 @@ void USFState::Initialize(USFStateMachine* InStateMachine, AActor* InOwner)
 {
 	OwnerActor =  InOwner;
 	StateMachine = InStateMachine;
+
+	bWantsUpdate = bRequiresUpdate || GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(USFState, OnUpdate));
 }
 
 void USFState::OnEnter_Implementation()
@@ -47,6 +47,10 @@ public:
 	{
 		return Handle != Other.Handle;
 	}
+	friend uint32 GetTypeHash(const FSFStateHandle& InHandle)
+	{
+		return ::GetTypeHash(InHandle.Handle);
+	}
 	void GenerateNewHandle();
 
 private:
@@ -85,6 +89,9 @@ struct FSFStateSpec
     void Resume();
 	
     void Update(float DeltaTime);
+
+	// OnUpdate가 필요 없는 State는 첫 틱을 기다리지 않고 Begin → Running
+	void MarkRunning();
 	
     bool CanTransitionTo(TSubclassOf<USFState> ToStateClass) const;
 
@@ -163,6 +170,9 @@ public:
 	
     // State 초기화 
     virtual void Initialize(USFStateMachine* InStateMachine, AActor* InOwner);
+
+	// OnUpdate를 위해 StateMachine Tick이 필요한지 (아니면 전환 이벤트가 올 때까지 Tick을 재움)
+	bool WantsUpdate() const { return bWantsUpdate; }
 	
     UFUNCTION(BlueprintPure, Category = "State")
     USFStateMachine* GetStateMachine() const { return StateMachine; }
@@ -179,6 +189,13 @@ protected:
     //OwnerActor
     UPROPERTY(BlueprintReadOnly, Category = "State")
     TObjectPtr<AActor> OwnerActor;
+
+	// 네이티브에서 OnUpdate_Implementation을 구현하면 true로 설정 (블루프린트 OnUpdate 구현은 자동 감지)
+	UPROPERTY(EditDefaultsOnly, Category = "State")
+	bool bRequiresUpdate = false;
+
+private:
+	bool bWantsUpdate = false;
 	
 	
 };
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "Character/Enemy/Component/Boss_Dragon/SFDragonGameplayTags.h"
 #include "Character/SFCharacterBase.h"
 #include "Components/CapsuleComponent.h"
+#include "System/SFProjectilePoolSubsystem.h"
 
 USFGA_Dragon_AerialBarrage::USFGA_Dragon_AerialBarrage()
 {
@@ -290,18 +291,18 @@ void USFGA_Dragon_AerialBarrage::OnFireballEventReceived(FGameplayEventData Payl
     FRotator LookRot = UKismetMathLibrary::FindLookAtRotation(SpawnLoc, TargetPos);
     FTransform SpawnTM(LookRot, SpawnLoc);
     
-    ASFDragonFireballProjectile* Projectile = GetWorld()->SpawnActorDeferred<ASFDragonFireballProjectile>(
+    USFProjectilePoolSubsystem* ProjectilePool = USFProjectilePoolSubsystem::Get(OwnerChar);
+    ASFDragonFireballProjectile* Projectile = ProjectilePool ? Cast<ASFDragonFireballProjectile>(ProjectilePool->BeginAcquireActor(
         ProjectileClass, 
         SpawnTM, 
         OwnerChar, 
-        OwnerChar, 
-        ESpawnActorCollisionHandlingMethod::AlwaysSpawn
-    );
+        OwnerChar
+    )) : nullptr;
 
     if (Projectile)
     {
         Projectile->SetOwner(GetAvatarActorFromActorInfo());
-        Projectile->FinishSpawning(SpawnTM);
+        ProjectilePool->FinishAcquireActor(Projectile, SpawnTM);
     }
 
     CurrentFireballCount++;
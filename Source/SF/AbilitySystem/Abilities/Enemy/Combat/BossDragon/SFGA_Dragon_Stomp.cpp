@@ -125,31 +125,38 @@ void USFGA_Dragon_Stomp::EmitShockWave(FGameplayEventData Payload)
 		FGameplayEffectContextHandle EffectContext =
 			MakeEffectContext(CurrentSpecHandle, CurrentActorInfo);
 
+		// 한 캐릭터가 여러 콜리전으로 겹칠 수 있으므로 중복 제거 후 데미지는 Spec 하나로 일괄 적용
+		TArray<AActor*> HitActors;
 		for (const FOverlapResult& Overlap : OverlapResults)
 		{
 			AActor* HitActor = Overlap.GetActor();
-
 			if (HitActor && GetAttitudeTowards(HitActor) == ETeamAttitude::Hostile)
 			{
-				ApplyDamageToTarget(HitActor, EffectContext);
-				ApplyKnockBackToTarget(HitActor, StompLoc);
-
-				// Pressure 적용
-				ApplyPressureToTarget(HitActor);
-				
-				if (bIsDebug)
-				{
-					DrawDebugLine(
-						Dragon->GetWorld(),
-						StompLoc,
-						HitActor->GetActorLocation(),
-						FColor::Green,
-						false,
-						3.0f,
-						0,
-						2.0f
-					);
-				}
+				HitActors.AddUnique(HitActor);
+			}
+		}
+
+		ApplyDamageToTargets(HitActors, EffectContext);
+
+		for (AActor* HitActor : HitActors)
+		{
+			ApplyKnockBackToTarget(HitActor, StompLoc);
+
+			// Pressure 적용
+			ApplyPressureToTarget(HitActor);
+			
+			if (bIsDebug)
+			{
+				DrawDebugLine(
+					Dragon->GetWorld(),
+					StompLoc,
+					HitActor->GetActorLocation(),
+					FColor::Green,
+					false,
+					3.0f,
+					0,
+					2.0f
+				);
 			}
 		}
 	}
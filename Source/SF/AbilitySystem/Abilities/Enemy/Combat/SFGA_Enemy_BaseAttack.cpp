@@ -7,6 +7,7 @@
 #include "Character/SFCharacterBase.h"
 #include "Character/SFCharacterGameplayTags.h"
 #include "AbilitySystem/GameplayCues/Data/SFGameplayCueCosmeticData.h"
+#include "Libraries/SFAbilitySystemLibrary.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SFGA_Enemy_BaseAttack)
 
@@ -233,6 +234,44 @@ void USFGA_Enemy_BaseAttack::ApplyDamageToTarget(
 	SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
 }
 
+void USFGA_Enemy_BaseAttack::ApplyDamageToTargets(
+	const TArray<AActor*>& Targets,
+	const FGameplayEffectContextHandle& ContextHandle)
+{
+	if (Targets.Num() == 0 || !DamageGameplayEffectClass)
+		return;
+
+	UAbilitySystemComponent* SourceASC = GetAbilitySystemComponentFromActorInfo();
+	if (!SourceASC)
+		return;
+
+	TArray<UAbilitySystemComponent*, TInlineAllocator<16>> TargetASCs;
+	for (AActor* Target : Targets)
+	{
+		if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Target))
+		{
+			TargetASCs.Add(TargetASC);
+		}
+	}
+
+	if (TargetASCs.Num() == 0)
+		return;
+
+	FGameplayEffectSpecHandle SpecHandle =
+		MakeOutgoingGameplayEffectSpec(DamageGameplayEffectClass, GetAbilityLevel());
+
+	if (!SpecHandle.IsValid())
+		return;
+
+	SpecHandle.Data->SetContext(ContextHandle);
+	SpecHandle.Data->SetSetByCallerMagnitude(
+		SFGameplayTags::Data_Damage_BaseDamage,
+		GetBaseDamage()
+	);
+
+	USFAbilitySystemLibrary::ApplyGameplayEffectSpecToTargets(SourceASC, *SpecHandle.Data.Get(), TargetASCs);
+}
+
 void USFGA_Enemy_BaseAttack::ApplyRawDamageToTarget(
 	AActor* Target,
 	float RawDamage,
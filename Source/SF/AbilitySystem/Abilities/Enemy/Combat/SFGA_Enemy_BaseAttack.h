@@ -85,6 +85,9 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Attack")
     void ApplyDamageToTarget(AActor* Target, const FGameplayEffectContextHandle& ContextHandle);
 
+    // 다중 타겟 데미지 적용 (Spec 하나를 모든 타겟에 적용)
+    void ApplyDamageToTargets(const TArray<AActor*>& Targets, const FGameplayEffectContextHandle& ContextHandle);
+
     // Raw 데미지 적용
     UFUNCTION(BlueprintCallable, Category = "Attack")
     void ApplyRawDamageToTarget(AActor* Target, float RawDamage, const FGameplayEffectContextHandle& ContextHandle);
@@ -101,6 +104,9 @@ protected:
 
     virtual bool CheckCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, FGameplayTagContainer* OptionalRelevantTags = nullptr) const override;
 
+    // CheckCooldown에서 추가로 확인하는 쿨다운 태그 (AI 후보 캐시의 태그 이벤트 등록용)
+    const FGameplayTag& GetCoolDownTag() const { return CoolDownTag; }
+
 protected:
     UPROPERTY(EditDefaultsOnly, Category = "Animation Montage")
     FTaggedMontage AttackTypeMontage;
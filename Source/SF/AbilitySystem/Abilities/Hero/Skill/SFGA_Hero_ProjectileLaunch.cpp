@@ -6,6 +6,7 @@
 #include "Character/SFCharacterBase.h"
 #include "Equipment/EquipmentComponent/SFEquipmentComponent.h"
 #include "Actors/SFAttackProjectile.h"
+#include "System/SFProjectilePoolSubsystem.h"
 
 #include "Components/MeshComponent.h"
 #include "GameFramework/PlayerController.h"
@@ -120,32 +121,29 @@ void USFGA_Hero_ProjectileLaunch::SpawnProjectile_Server(const FTransform& Spawn
 		return;
 	}
 
-	FActorSpawnParameters Params;
-	Params.Owner = Character;
-	Params.Instigator = Cast<APawn>(Character);
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	USFProjectilePoolSubsystem* ProjectilePool = USFProjectilePoolSubsystem::Get(World);
+	if (!ProjectilePool)
+	{
+		return;
+	}
 
-	ASFAttackProjectile* Projectile = World->SpawnActorDeferred<ASFAttackProjectile>(
+	// 풀에서 꺼내거나 지연 스폰 → 초기화 → 활성화(BeginPlay/재사용) 순서 유지
+	ASFAttackProjectile* Projectile = ProjectilePool->BeginAcquire<ASFAttackProjectile>(
 		ProjectileClass,
 		SpawnTM,
-		Params.Owner,
-		Params.Instigator,
-		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+		Character,
+		Cast<APawn>(Character)
 	);
 	
-	const float Damage = GetScaledBaseDamage();
-	Projectile->InitProjectile(SourceASC, Damage, Character);
-	
-	if (Projectile)
-	{
-		Projectile->FinishSpawning(SpawnTM);
-	}
-	
 	if (!Projectile)
 	{
 		return;
 	}
 	
+	const float Damage = GetScaledBaseDamage();
+	Projectile->InitProjectile(SourceASC, Damage, Character);
+	ProjectilePool->FinishAcquireActor(Projectile, SpawnTM);
+	
 	Projectile->Launch(LaunchDir);
 }
 
@@ -12,6 +12,7 @@
 #include "Player/SFPlayerController.h"
 #include "Actors/SFAttackProjectile.h"
 #include "Character/SFCharacterBase.h"
+#include "System/SFProjectilePoolSubsystem.h"
 
 USFGA_Projectile_Charged::USFGA_Projectile_Charged(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -276,24 +277,23 @@ void USFGA_Projectile_Charged::OnProjectileSpawnEventReceived(FGameplayEventData
 	    ASFCharacterBase* Character = GetSFCharacterFromActorInfo();
 	    USFAbilitySystemComponent* SourceASC = GetSFAbilitySystemComponentFromActorInfo();
         
-        if (World && Character && SourceASC && ProjectileClass)
+        USFProjectilePoolSubsystem* ProjectilePool = USFProjectilePoolSubsystem::Get(World);
+        if (World && Character && SourceASC && ProjectileClass && ProjectilePool)
         {
-            FActorSpawnParameters Params;
-            Params.Owner = Character;
-            Params.Instigator = Cast<APawn>(Character);
-            Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            const FTransform ProjectileTM(LaunchDir.Rotation(), SpawnTM.GetLocation());
 
-            ASFAttackProjectile* Projectile = World->SpawnActor<ASFAttackProjectile>(
+            ASFAttackProjectile* Projectile = ProjectilePool->BeginAcquire<ASFAttackProjectile>(
                 ProjectileClass,
-                SpawnTM.GetLocation(),
-                LaunchDir.Rotation(),
-                Params
+                ProjectileTM,
+                Character,
+                Cast<APawn>(Character)
             );
 
             if (Projectile)
             {
                 // [수정] InitProjectileCharged 호출
                 Projectile->InitProjectileCharged(SourceASC, FinalDamage, Character, FinalScale, bFinalExplode);
+                ProjectilePool->FinishAcquireActor(Projectile, ProjectileTM);
                 Projectile->Launch(LaunchDir);
             }
         }
@@ -3,8 +3,8 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "Components/SceneComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
+#include "System/SFSpatialHashSubsystem.h"
 
 ASFBuffArea::ASFBuffArea()
 {
@@ -85,14 +85,12 @@ bool ASFBuffArea::IsValidTarget(AActor* Target) const
 //================ TickInterval마다 범위 체크 =================
 void ASFBuffArea::OnTickArea()
 {
-	UWorld* World = GetWorld();
-	if (!World) return;
+	USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this);
+	if (!SpatialHash) return;
 
+	//공간 해시에서 반경 안의 캐릭터만 후보로 가져옴 (월드 전체 스캔 X)
 	TArray<AActor*> Candidates;
-	UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), Candidates);
-
-	const FVector Origin = GetActorLocation();
-	const float RadiusSq = Radius * Radius;
+	SpatialHash->QueryRadius(GetActorLocation(), Radius, FSFSpatialQueryParams(ESFSpatialCategory::Character, this), Candidates);
 
 	//이번 Tick에서 범위 안에 있는 대상들
 	TSet<TWeakObjectPtr<AActor>> InsideSet;
@@ -101,15 +99,7 @@ void ASFBuffArea::OnTickArea()
 	{
 		if (!IsValidTarget(Candidate)) continue;
 
-		const float DistSq = FVector::DistSquared(
-			Origin,
-			Candidate->GetActorLocation()
-		);
-
-		if (DistSq <= RadiusSq)
-		{
-			InsideSet.Add(Candidate);
-		}
+		InsideSet.Add(Candidate);
 	}
 
 	//1) 범위 안인데 아직 GE 안 걸려 있으면 Apply
@@ -9,6 +9,7 @@
 #include "Character/SFCharacterBase.h"
 #include "Engine/OverlapResult.h"
 #include "Net/UnrealNetwork.h"
+#include "Libraries/SFAbilitySystemLibrary.h"
 
 ASFGroundAOE::ASFGroundAOE(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -227,6 +228,7 @@ void ASFGroundAOE::ApplyDamageToTargets(float DamageAmount, float EffectRadius)
 	if (!DamageGE) return;
 
 	TSet<AActor*> ProcessedActors;
+	TArray<UAbilitySystemComponent*> TargetASCs;
 
 	for (const FOverlapResult& Overlap : Overlaps)
 	{
@@ -247,30 +249,34 @@ void ASFGroundAOE::ApplyDamageToTargets(float DamageAmount, float EffectRadius)
 			}
 		}
 
-		UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
-		if (TargetASC)
+		if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor))
 		{
-			FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
-			ContextHandle.AddInstigator(SourceActor.Get(), this);
-			
-			FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(DamageGE, 1.0f, ContextHandle);
-			if (SpecHandle.IsValid())
-			{
-				if (SetByCallerDamageTag.IsValid())
-				{
-					SpecHandle.Data->SetSetByCallerMagnitude(SetByCallerDamageTag, DamageAmount);
-				}
-				SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-			}
+			TargetASCs.Add(TargetASC);
+		}
+	}
 
-			if (DebuffGameplayEffectClass)
-			{
-				FGameplayEffectSpecHandle DebuffSpec = SourceASC->MakeOutgoingSpec(DebuffGameplayEffectClass, 1.0f, ContextHandle);
-				if (DebuffSpec.IsValid())
-				{
-					SourceASC->ApplyGameplayEffectSpecToTarget(*DebuffSpec.Data.Get(), TargetASC);
-				}
-			}
+	if (TargetASCs.Num() == 0) return;
+
+	// 틱마다 Context/Spec을 하나만 만들어 모든 타겟에 적용
+	FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
+	ContextHandle.AddInstigator(SourceActor.Get(), this);
+
+	FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(DamageGE, 1.0f, ContextHandle);
+	if (SpecHandle.IsValid())
+	{
+		if (SetByCallerDamageTag.IsValid())
+		{
+			SpecHandle.Data->SetSetByCallerMagnitude(SetByCallerDamageTag, DamageAmount);
+		}
+		USFAbilitySystemLibrary::ApplyGameplayEffectSpecToTargets(SourceASC.Get(), *SpecHandle.Data.Get(), TargetASCs);
+	}
+
+	if (DebuffGameplayEffectClass)
+	{
+		FGameplayEffectSpecHandle DebuffSpec = SourceASC->MakeOutgoingSpec(DebuffGameplayEffectClass, 1.0f, ContextHandle);
+		if (DebuffSpec.IsValid())
+		{
+			USFAbilitySystemLibrary::ApplyGameplayEffectSpecToTargets(SourceASC.Get(), *DebuffSpec.Data.Get(), TargetASCs);
 		}
 	}
 }
@@ -2,6 +2,7 @@
 #include "Actors/SFAttackProjectile.h"
 #include "AbilitySystem/SFAbilitySystemComponent.h"
 #include "Character/SFCharacterBase.h"
+#include "System/SFProjectilePoolSubsystem.h"
 #include "Algo/Sort.h"                 // 정렬 알고리즘
 #include "Kismet/KismetSystemLibrary.h" // LineTrace
 #include "GameFramework/PlayerController.h" // PlayerController 헤더 필요
@@ -154,22 +155,26 @@ void USFGA_Hero_ProjectileMultiSummon::SpawnProjectileAt(const FTransform& Spawn
 	// [수렴] 목표 지점(CachedTargetLocation)을 향하는 방향 벡터
 	FVector FinalLaunchDir = (CachedTargetLocation - SpawnTM.GetLocation()).GetSafeNormal();
 
-	FActorSpawnParameters Params;
-	Params.Owner = Character;
-	Params.Instigator = Cast<APawn>(Character);
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	USFProjectilePoolSubsystem* ProjectilePool = USFProjectilePoolSubsystem::Get(World);
+	if (!ProjectilePool)
+	{
+		return;
+	}
+
+	const FTransform ProjectileTM(FinalLaunchDir.Rotation(), SpawnTM.GetLocation());
 
-	ASFAttackProjectile* Projectile = World->SpawnActor<ASFAttackProjectile>(
+	ASFAttackProjectile* Projectile = ProjectilePool->BeginAcquire<ASFAttackProjectile>(
 		ProjectileClass,
-		SpawnTM.GetLocation(),
-		FinalLaunchDir.Rotation(), 
-		Params
+		ProjectileTM,
+		Character,
+		Cast<APawn>(Character)
 	);
 
 	if (Projectile)
 	{
 		const float Damage = GetScaledBaseDamage();
 		Projectile->InitProjectile(SourceASC, Damage, Character);
+		ProjectilePool->FinishAcquireActor(Projectile, ProjectileTM);
 		
 		Projectile->Launch(FinalLaunchDir);
 	}
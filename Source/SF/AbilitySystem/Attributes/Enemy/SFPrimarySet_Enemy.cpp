@@ -21,6 +21,13 @@ void USFPrimarySet_Enemy::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 	DOREPLIFETIME_CONDITION_NOTIFY(ThisClass, MaxStagger, COND_None, REPNOTIFY_Always);
 }
 
+void USFPrimarySet_Enemy::GetRestoreDependencies(TArray<FSFAttributeRestoreDependency>& OutDependencies) const
+{
+	Super::GetRestoreDependencies(OutDependencies);
+
+	OutDependencies.Add({ GetMaxStaggerAttribute(), GetStaggerAttribute() });
+}
+
 bool USFPrimarySet_Enemy::PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data)
 {
 	if (Data.EvaluatedData.Attribute == GetDamageAttribute())
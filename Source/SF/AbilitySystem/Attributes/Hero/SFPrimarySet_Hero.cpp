@@ -27,6 +27,14 @@ void USFPrimarySet_Hero::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 	DOREPLIFETIME_CONDITION_NOTIFY(ThisClass, ManaReduction, COND_None, REPNOTIFY_Always);
 }
 
+void USFPrimarySet_Hero::GetRestoreDependencies(TArray<FSFAttributeRestoreDependency>& OutDependencies) const
+{
+	Super::GetRestoreDependencies(OutDependencies);
+
+	OutDependencies.Add({ GetMaxManaAttribute(), GetManaAttribute() });
+	OutDependencies.Add({ GetMaxStaminaAttribute(), GetStaminaAttribute() });
+}
+
 bool USFPrimarySet_Hero::PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data)
 {
 	if (!Super::PreGameplayEffectExecute(Data))
@@ -17,6 +17,8 @@ public:
 	USFPrimarySet_Hero();
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	virtual void GetRestoreDependencies(TArray<FSFAttributeRestoreDependency>& OutDependencies) const override;
 	
 protected:
 	virtual bool PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data) override;
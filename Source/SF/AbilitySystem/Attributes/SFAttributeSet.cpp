@@ -19,6 +19,10 @@ USFAbilitySystemComponent* USFAttributeSet::GetSFAbilitySystemComponent() const
 	return Cast<USFAbilitySystemComponent>(GetOwningAbilitySystemComponent());
 }
 
+void USFAttributeSet::GetRestoreDependencies(TArray<FSFAttributeRestoreDependency>& OutDependencies) const
+{
+}
+
 void USFAttributeSet::ClampAttribute(const FGameplayAttribute& Attribute, float& NewValue) const
 {
 	
@@ -14,6 +14,13 @@ GAMEPLAYATTRIBUTE_VALUE_INITTER(PropertyName)
 
 class USFAbilitySystemComponent;
 
+// 복원 순서 의존성: Prerequisite를 먼저 복원해야 Dependent가 이전 상한으로 Clamp되지 않음 (예: MaxHealth → Health)
+struct FSFAttributeRestoreDependency
+{
+	FGameplayAttribute Prerequisite;
+	FGameplayAttribute Dependent;
+};
+
 /**
  * 
  */
@@ -29,6 +36,9 @@ public:
 
 	USFAbilitySystemComponent* GetSFAbilitySystemComponent() const;
 
+	// 스냅샷 스키마 컴파일 시 CDO에서 한 번 호출 (FSFAttributeSnapshotCodec)
+	virtual void GetRestoreDependencies(TArray<FSFAttributeRestoreDependency>& OutDependencies) const;
+
 protected:
 	virtual void ClampAttribute(const FGameplayAttribute& Attribute, float& NewValue) const;
 };
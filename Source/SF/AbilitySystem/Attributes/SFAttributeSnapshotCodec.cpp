@@ -0,0 +1,246 @@
+#include "SFAttributeSnapshotCodec.h"
+
+#include "AbilitySystemComponent.h"
+#include "SFAttributeSet.h"
+#include "SFLogChannels.h"
+#include "Player/Save/SFPersistentDataType.h"
+#include "UObject/UObjectIterator.h"
+
+void FSFAttributeSnapshotCodec::CompileAllSchemas()
+{
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->IsChildOf(USFAttributeSet::StaticClass()) && !It->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			FindOrCompileSchema(*It);
+		}
+	}
+
+	UE_LOG(LogSF, Log, TEXT("FSFAttributeSnapshotCodec: Compiled %d attribute set schemas"), GetSchemas().Num());
+}
+
+const FSFAttributeSetSchema* FSFAttributeSnapshotCodec::FindOrCompileSchema(const UClass* SetClass)
+{
+	check(IsInGameThread());
+
+	if (!SetClass || !SetClass->IsChildOf(UAttributeSet::StaticClass()))
+	{
+		return nullptr;
+	}
+
+	TMap<TObjectKey<UClass>, FSFAttributeSetSchema>& Schemas = GetSchemas();
+	const TObjectKey<UClass> Key(SetClass);
+	if (const FSFAttributeSetSchema* Found = Schemas.Find(Key))
+	{
+		return Found;
+	}
+
+	return &Schemas.Add(Key, CompileSchema(SetClass));
+}
+
+FSFAttributeSetSchema FSFAttributeSnapshotCodec::CompileSchema(const UClass* SetClass)
+{
+	FSFAttributeSetSchema Schema;
+
+	for (TFieldIterator<FProperty> It(SetClass); It; ++It)
+	{
+		FProperty* Property = *It;
+		const FStructProperty* StructProp = CastField<FStructProperty>(Property);
+		if (!StructProp || StructProp->Struct != FGameplayAttributeData::StaticStruct())
+		{
+			continue;
+		}
+
+		FGameplayAttribute Attribute(Property);
+		if (!Attribute.IsValid())
+		{
+			continue;
+		}
+
+		Schema.IndexByName.Add(Property->GetFName(), Schema.Attributes.Num());
+		Schema.Attributes.Add(Attribute);
+		Schema.LayoutHash = FCrc::StrCrc32(*Property->GetName(), Schema.LayoutHash);
+	}
+
+	const int32 NumAttributes = Schema.Attributes.Num();
+
+	// 선행 → 후행 간선 구성
+	TArray<FSFAttributeRestoreDependency> Dependencies;
+	if (const USFAttributeSet* SetCDO = Cast<USFAttributeSet>(SetClass->GetDefaultObject()))
+	{
+		SetCDO->GetRestoreDependencies(Dependencies);
+	}
+
+	TArray<int32> InDegree;
+	InDegree.Init(0, NumAttributes);
+	TArray<TArray<int32>> Dependents;
+	Dependents.SetNum(NumAttributes);
+
+	for (const FSFAttributeRestoreDependency& Dependency : Dependencies)
+	{
+		const int32 PrerequisiteIndex = Schema.Attributes.IndexOfByKey(Dependency.Prerequisite);
+		const int32 DependentIndex = Schema.Attributes.IndexOfByKey(Dependency.Dependent);
+		if (PrerequisiteIndex == INDEX_NONE || DependentIndex == INDEX_NONE)
+		{
+			UE_LOG(LogSF, Warning, TEXT("FSFAttributeSnapshotCodec: %s has a restore dependency on an attribute outside the set (%s -> %s)"),
+				*SetClass->GetName(), *Dependency.Prerequisite.GetName(), *Dependency.Dependent.GetName());
+			continue;
+		}
+
+		Dependents[PrerequisiteIndex].Add(DependentIndex);
+		++InDegree[DependentIndex];
+	}
+
+	// 위상 정렬 (의존성이 없는 어트리뷰트끼리는 선언 순서 유지)
+	TBitArray<> Emitted(false, NumAttributes);
+	Schema.RestoreOrder.Reserve(NumAttributes);
+
+	bool bProgress = true;
+	while (bProgress && Schema.RestoreOrder.Num() < NumAttributes)
+	{
+		bProgress = false;
+		for (int32 Index = 0; Index < NumAttributes; ++Index)
+		{
+			if (Emitted[Index] || InDegree[Index] > 0)
+			{
+				continue;
+			}
+
+			Emitted[Index] = true;
+			Schema.RestoreOrder.Add(Index);
+			for (const int32 DependentIndex : Dependents[Index])
+			{
+				--InDegree[DependentIndex];
+			}
+			bProgress = true;
+		}
+	}
+
+	// 순환 의존성은 선언 순서로 마무리
+	if (Schema.RestoreOrder.Num() < NumAttributes)
+	{
+		UE_LOG(LogSF, Warning, TEXT("FSFAttributeSnapshotCodec: Cyclic restore dependencies in %s"), *SetClass->GetName());
+		for (int32 Index = 0; Index < NumAttributes; ++Index)
+		{
+			if (!Emitted[Index])
+			{
+				Schema.RestoreOrder.Add(Index);
+			}
+		}
+	}
+
+	return Schema;
+}
+
+void FSFAttributeSnapshotCodec::Encode(const UAbilitySystemComponent& ASC, FSFSavedAttributeSnapshot& OutSnapshot, bool bEmbedLayoutNames)
+{
+	OutSnapshot.Reset();
+	OutSnapshot.Version = SnapshotVersion;
+
+	const TArray<UAttributeSet*>& SpawnedSets = ASC.GetSpawnedAttributes();
+	OutSnapshot.Sets.Reserve(SpawnedSets.Num());
+
+	for (const UAttributeSet* Set : SpawnedSets)
+	{
+		if (!Set)
+		{
+			continue;
+		}
+
+		const FSFAttributeSetSchema* Schema = FindOrCompileSchema(Set->GetClass());
+		if (!Schema || Schema->Attributes.Num() == 0)
+		{
+			continue;
+		}
+
+		FSFSavedAttributeSet& SavedSet = OutSnapshot.Sets.AddDefaulted_GetRef();
+		SavedSet.SetClass = Set->GetClass();
+		SavedSet.LayoutHash = Schema->LayoutHash;
+		SavedSet.Values.SetNumUninitialized(Schema->Attributes.Num());
+
+		for (int32 Index = 0; Index < Schema->Attributes.Num(); ++Index)
+		{
+			SavedSet.Values[Index] = ASC.GetNumericAttributeBase(Schema->Attributes[Index]);
+		}
+
+		if (bEmbedLayoutNames)
+		{
+			SavedSet.LayoutNames.Reserve(Schema->Attributes.Num());
+			for (const FGameplayAttribute& Attribute : Schema->Attributes)
+			{
+				SavedSet.LayoutNames.Add(Attribute.GetUProperty()->GetFName());
+			}
+		}
+	}
+}
+
+int32 FSFAttributeSnapshotCodec::Decode(UAbilitySystemComponent& ASC, const FSFSavedAttributeSnapshot& Snapshot)
+{
+	if (Snapshot.Version != SnapshotVersion)
+	{
+		UE_LOG(LogSF, Warning, TEXT("FSFAttributeSnapshotCodec: Unsupported snapshot version %d (expected %d)"), Snapshot.Version, SnapshotVersion);
+		return 0;
+	}
+
+	int32 RestoredCount = 0;
+
+	for (const FSFSavedAttributeSet& SavedSet : Snapshot.Sets)
+	{
+		if (!SavedSet.SetClass || !ASC.GetAttributeSet(SavedSet.SetClass))
+		{
+			continue;
+		}
+
+		const FSFAttributeSetSchema* Schema = FindOrCompileSchema(SavedSet.SetClass);
+		if (!Schema)
+		{
+			continue;
+		}
+
+		// 같은 레이아웃: 인덱스 그대로 복원
+		if (SavedSet.LayoutHash == Schema->LayoutHash && SavedSet.Values.Num() == Schema->Attributes.Num())
+		{
+			for (const int32 Index : Schema->RestoreOrder)
+			{
+				ASC.SetNumericAttributeBase(Schema->Attributes[Index], SavedSet.Values[Index]);
+				++RestoredCount;
+			}
+			continue;
+		}
+
+		// 다른 레이아웃: 이름으로 매칭 (새로 추가된 어트리뷰트는 기본값 유지, 삭제된 어트리뷰트는 무시)
+		if (SavedSet.LayoutNames.Num() != SavedSet.Values.Num())
+		{
+			UE_LOG(LogSF, Warning, TEXT("FSFAttributeSnapshotCodec: Layout of %s changed and the snapshot has no layout names, skipping"), *SavedSet.SetClass->GetName());
+			continue;
+		}
+
+		TArray<int32, TInlineAllocator<32>> SavedIndexBySchemaIndex;
+		SavedIndexBySchemaIndex.Init(INDEX_NONE, Schema->Attributes.Num());
+		for (int32 SavedIndex = 0; SavedIndex < SavedSet.LayoutNames.Num(); ++SavedIndex)
+		{
+			if (const int32* SchemaIndex = Schema->IndexByName.Find(SavedSet.LayoutNames[SavedIndex]))
+			{
+				SavedIndexBySchemaIndex[*SchemaIndex] = SavedIndex;
+			}
+		}
+
+		for (const int32 Index : Schema->RestoreOrder)
+		{
+			const int32 SavedIndex = SavedIndexBySchemaIndex[Index];
+			if (SavedIndex != INDEX_NONE)
+			{
+				ASC.SetNumericAttributeBase(Schema->Attributes[Index], SavedSet.Values[SavedIndex]);
+				++RestoredCount;
+			}
+		}
+	}
+
+	return RestoredCount;
+}
+
+TMap<TObjectKey<UClass>, FSFAttributeSetSchema>& FSFAttributeSnapshotCodec::GetSchemas()
+{
+	static TMap<TObjectKey<UClass>, FSFAttributeSetSchema> Schemas;
+	return Schemas;
+}
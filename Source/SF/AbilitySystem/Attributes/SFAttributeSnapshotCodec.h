@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "UObject/ObjectKey.h"
+
+class UAbilitySystemComponent;
+struct FSFSavedAttributeSnapshot;
+
+/**
+ * 어트리뷰트 세트 클래스 하나의 스냅샷 레이아웃
+ */
+struct FSFAttributeSetSchema
+{
+	// 저장 순서 (FGameplayAttributeData 프로퍼티 선언 순서)
+	TArray<FGameplayAttribute> Attributes;
+
+	// 복원 순서 (Attributes 인덱스). GetRestoreDependencies의 선행 어트리뷰트가 항상 먼저 옴
+	TArray<int32> RestoreOrder;
+
+	// 레이아웃이 다른 스냅샷 복원용 (어트리뷰트 이름 → 인덱스)
+	TMap<FName, int32> IndexByName;
+
+	// 어트리뷰트 이름 순서로 계산한 해시 (실행 간 동일)
+	uint32 LayoutHash = 0;
+};
+
+/**
+ * FSFAttributeSnapshotCodec
+ * 스테이지 이동(CopyProperties) 시 ASC 어트리뷰트 Base Value를 저장/복원
+ * - 세트 클래스별 스키마를 한 번만 컴파일 (AssetManager 시작 시 + 처음 보는 클래스는 지연 컴파일)
+ * - 저장: 스키마 순서대로 float만 복사. 복원: 스키마의 의존성 순서대로 SetNumericAttributeBase
+ * - 레이아웃 해시가 다르면 LayoutNames로 이름 매칭 → 어트리뷰트가 추가/삭제된 저장 데이터도 복원 가능
+ */
+class SF_API FSFAttributeSnapshotCodec
+{
+public:
+	// 스냅샷 포맷 버전. 포맷 자체가 바뀔 때만 올림 (어트리뷰트 추가는 LayoutHash로 처리)
+	static constexpr uint16 SnapshotVersion = 1;
+
+	// 로드된 모든 SF 어트리뷰트 세트의 스키마 컴파일
+	static void CompileAllSchemas();
+
+	static const FSFAttributeSetSchema* FindOrCompileSchema(const UClass* SetClass);
+
+	// bEmbedLayoutNames: 디스크 저장처럼 이후 빌드에서 읽을 수 있어야 할 때 true
+	static void Encode(const UAbilitySystemComponent& ASC, FSFSavedAttributeSnapshot& OutSnapshot, bool bEmbedLayoutNames = false);
+
+	// 복원한 어트리뷰트 수 반환
+	static int32 Decode(UAbilitySystemComponent& ASC, const FSFSavedAttributeSnapshot& Snapshot);
+
+private:
+	static FSFAttributeSetSchema CompileSchema(const UClass* SetClass);
+
+	static TMap<TObjectKey<UClass>, FSFAttributeSetSchema>& GetSchemas();
+};
@@ -12,6 +12,7 @@
 #include "Character/SFCharacterBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Player/SFPlayerState.h"
+#include "Player/Components/SFHitAggregatorComponent.h"
 #include "Player/Components/SFPlayerStatsComponent.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
 #include "UI/InGame/UIDataStructs.h"
@@ -31,6 +32,11 @@ void USFPrimarySet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
     DOREPLIFETIME_CONDITION_NOTIFY(ThisClass, MoveSpeedPercent, COND_None, REPNOTIFY_Always);
 }
 
+void USFPrimarySet::GetRestoreDependencies(TArray<FSFAttributeRestoreDependency>& OutDependencies) const
+{
+    OutDependencies.Add({ GetMaxHealthAttribute(), GetHealthAttribute() });
+}
+
 bool USFPrimarySet::PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data)
 {
     if (!Super::PreGameplayEffectExecute(Data))
@@ -108,7 +114,8 @@ void USFPrimarySet::PostGameplayEffectExecute(const FGameplayEffectModCallbackDa
         }
 
         // [UI] 데미지 폰트 띄우기 메시지
-        if (DamageDone > 0.0f)
+        // 플레이어가 준 데미지는 서버 집계기에서 병합 후 배치 전송, 그 외는 GameplayCue
+        if (DamageDone > 0.0f && !USFHitAggregatorComponent::TryAggregateHit(Data.EffectSpec.GetContext(), GetOwningActor(), DamageDone))
         {
             FGameplayCueParameters Params;
             Params.RawMagnitude = DamageDone;
@@ -249,7 +256,12 @@ void USFPrimarySet::TrackDamageDealt(const FGameplayEffectModCallbackData& Data,
         return;
     }
 
-    if (USFPlayerStatsComponent* StatsComp = USFPlayerStatsComponent::FindPlayerStatsComponent(InstigatorPS))
+    // 집계기가 있으면 윈도우 단위로 모아서 반영 (Stats 복제 빈도 감소)
+    if (USFHitAggregatorComponent* Aggregator = USFHitAggregatorComponent::FindHitAggregator(InstigatorPS))
+    {
+        Aggregator->AddDamageDealt(DamageAmount);
+    }
+    else if (USFPlayerStatsComponent* StatsComp = USFPlayerStatsComponent::FindPlayerStatsComponent(InstigatorPS))
     {
         StatsComp->AddDamageDealt(DamageAmount);
     }
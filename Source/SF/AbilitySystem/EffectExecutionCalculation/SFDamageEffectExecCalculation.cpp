@@ -60,92 +60,81 @@ void USFDamageEffectExecCalculation::Execute_Implementation(
     if (!SourceActor || !TargetActor) return;
 
     const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
+
+    FSFDamageCapturedValues Captured;
+    CaptureDamageValues(ExecutionParams, Spec, Captured);
     
-    float FinalDamage = CalculateBaseDamage(ExecutionParams, Spec);
+    float FinalDamage = CalculateBaseDamage(Spec, Captured);
     
-    FinalDamage = ApplyCritical(ExecutionParams, Spec, FinalDamage);
+    FinalDamage = ApplyCritical(Spec, Captured, FinalDamage);
   
-    FinalDamage = ApplyDefense(ExecutionParams, FinalDamage);
+    FinalDamage = ApplyDefense(Captured, FinalDamage);
     
     OutputFinalDamage(FinalDamage, OutExecutionOutput);
 }
 
-
-float USFDamageEffectExecCalculation::CalculateBaseDamage(
+void USFDamageEffectExecCalculation::CaptureDamageValues(
     const FGameplayEffectCustomExecutionParameters& ExecutionParams,
-    const FGameplayEffectSpec& Spec) const
+    const FGameplayEffectSpec& Spec,
+    FSFDamageCapturedValues& OutValues) const
 {
-    // SetByCaller로 받은 기본 데미지
-    float BaseDamage = Spec.GetSetByCallerMagnitude(
-        SFGameplayTags::Data_Damage_BaseDamage, false, 0.f);
+    const SFDamageStatics& DamageStatics = GetDamageStatics();
 
-    // 공격력 가져오기
+    // 평가 파라미터는 한 번만 구성해서 모든 캡처에 재사용
     FAggregatorEvaluateParameters EvalParams;
     EvalParams.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
     EvalParams.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
 
-    const SFDamageStatics& DamageStatics = GetDamageStatics();
+    ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
+        DamageStatics.AttackPowerDef, EvalParams, OutValues.AttackPower);
 
-    float AttackPower = 0.f;
     ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
-        DamageStatics.AttackPowerDef, EvalParams, AttackPower);
+        DamageStatics.CriticalChanceDef, EvalParams, OutValues.CriticalChance);
 
-    return BaseDamage + AttackPower;
+    ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
+        DamageStatics.CriticalDamageDef, EvalParams, OutValues.CriticalDamage);
+
+    ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
+        DamageStatics.DefenseDef, EvalParams, OutValues.Defense);
 }
 
-float USFDamageEffectExecCalculation::ApplyCritical(
-    const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+float USFDamageEffectExecCalculation::CalculateBaseDamage(
     const FGameplayEffectSpec& Spec,
-    float InDamage) const
+    const FSFDamageCapturedValues& Captured) const
 {
-    const SFDamageStatics& DamageStatics = GetDamageStatics();
+    // SetByCaller로 받은 기본 데미지
+    float BaseDamage = Spec.GetSetByCallerMagnitude(
+        SFGameplayTags::Data_Damage_BaseDamage, false, 0.f);
 
-    FAggregatorEvaluateParameters EvalParams;
-    EvalParams.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
-    EvalParams.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
+    return BaseDamage + Captured.AttackPower;
+}
 
-    // 크리티컬 확률 가져오기
-    float CriticalChance = 0.f;
-    ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
-        DamageStatics.CriticalChanceDef, EvalParams, CriticalChance);
-    
-    bool bIsCritical = FMath::FRand() < CriticalChance;
+float USFDamageEffectExecCalculation::ApplyCritical(
+    const FGameplayEffectSpec& Spec,
+    const FSFDamageCapturedValues& Captured,
+    float InDamage) const
+{
+    bool bIsCritical = FMath::FRand() < Captured.CriticalChance;
 
     if (bIsCritical)
     {
-        float CriticalDamage = 0.f;
-        ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
-            DamageStatics.CriticalDamageDef, EvalParams, CriticalDamage);
-        
         FGameplayEffectContextHandle ContextHandle = Spec.GetEffectContext();
         if (FSFGameplayEffectContext* SFContext = static_cast<FSFGameplayEffectContext*>(ContextHandle.Get()))
         {
             SFContext->SetIsCriticalHit(true);
         }
 
-        return InDamage * CriticalDamage;
+        return InDamage * Captured.CriticalDamage;
     }
 
     return InDamage;
 }
 
 float USFDamageEffectExecCalculation::ApplyDefense(
-    const FGameplayEffectCustomExecutionParameters& ExecutionParams,
+    const FSFDamageCapturedValues& Captured,
     float InDamage) const
 {
-    const SFDamageStatics& DamageStatics = GetDamageStatics();
-    const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
-
-    FAggregatorEvaluateParameters EvalParams;
-    EvalParams.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
-    EvalParams.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
-
-    // 방어력 가져오기
-    float Defense = 0.f;
-    ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
-        DamageStatics.DefenseDef, EvalParams, Defense);
-
-    Defense = FMath::Max(Defense, 0.0f);
+    const float Defense = FMath::Max(Captured.Defense, 0.0f);
 
     // 방어력 공식: Defense / (Defense + 100)
     float DefenseReduction = Defense / (Defense + 100.0f);
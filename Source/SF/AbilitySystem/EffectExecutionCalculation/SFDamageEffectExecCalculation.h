@@ -6,6 +6,15 @@
 #include "GameplayEffectExecutionCalculation.h"
 #include "SFDamageEffectExecCalculation.generated.h"
 
+// 한 번의 Execute에서 사용하는 캡처 값 (실행당 한 번만 평가)
+struct FSFDamageCapturedValues
+{
+	float AttackPower = 0.f;
+	float Defense = 0.f;
+	float CriticalChance = 0.f;
+	float CriticalDamage = 0.f;
+};
+
 /**
  * 
  */
@@ -21,14 +30,17 @@ public:
 
 private:
 
+	// 공격력/방어력/크리티컬 캡처를 같은 평가 파라미터로 한 번에 계산
+	void CaptureDamageValues(const FGameplayEffectCustomExecutionParameters& ExecutionParams, const FGameplayEffectSpec& Spec, FSFDamageCapturedValues& OutValues) const;
+
 	// 기본 데미지 계산
-	float CalculateBaseDamage(const FGameplayEffectCustomExecutionParameters& ExecutionParams, const FGameplayEffectSpec& Spec) const;
+	float CalculateBaseDamage(const FGameplayEffectSpec& Spec, const FSFDamageCapturedValues& Captured) const;
 
 	// 크리티컬 적용
-	float ApplyCritical(const FGameplayEffectCustomExecutionParameters& ExecutionParams,const FGameplayEffectSpec& Spec,float InDamage) const;
+	float ApplyCritical(const FGameplayEffectSpec& Spec, const FSFDamageCapturedValues& Captured, float InDamage) const;
 
 	// 방어력 적용
-	float ApplyDefense(const FGameplayEffectCustomExecutionParameters& ExecutionParams,float InDamage) const;
+	float ApplyDefense(const FSFDamageCapturedValues& Captured, float InDamage) const;
 
 	//최종 데미지 
 	void OutputFinalDamage( float FinalDamage, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const;
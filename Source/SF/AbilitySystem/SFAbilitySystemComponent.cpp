@@ -7,6 +7,7 @@
 #include "Abilities/SFGameplayAbility.h"
 #include "Animation/Enemy/SFEnemyAnimInstance.h"
 #include "Animation/Hero/SFHeroAnimInstance.h"
+#include "Attributes/SFAttributeSnapshotCodec.h"
 #include "Attributes/SFPrimarySet.h"
 #include "Character/SFCharacterGameplayTags.h"
 #include "Character/Enemy/SFEnemy.h"
@@ -71,6 +72,18 @@ void USFAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
 {
 	Super::OnGiveAbility(AbilitySpec);
 
+	// GiveAbility는 Items 끝에 추가하므로 마지막 인덱스를 바로 기록, 아니면(복제 등) 다음 조회 때 재구성
+	const int32 LastIndex = ActivatableAbilities.Items.Num() - 1;
+	if (LastIndex >= 0 && ActivatableAbilities.Items[LastIndex].Handle == AbilitySpec.Handle)
+	{
+		SpecHandleToIndex.Add(AbilitySpec.Handle, LastIndex);
+	}
+	else
+	{
+		bSpecHandleIndexDirty = true;
+	}
+	AddToInputTagIndex(AbilitySpec);
+
 	if (AbilityChangedDelegate.IsBound())
 	{
 		AbilityChangedDelegate.Broadcast(AbilitySpec.Handle, true);
@@ -83,10 +96,129 @@ void USFAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpe
 	{
 		AbilityChangedDelegate.Broadcast(AbilitySpec.Handle, false);
 	}
+
+	// 제거 후 RemoveAtSwap으로 다른 스펙의 인덱스가 바뀌므로 Dirty 처리
+	RemoveFromInputTagIndex(AbilitySpec.Handle);
+	SpecHandleToIndex.Remove(AbilitySpec.Handle);
+	bSpecHandleIndexDirty = true;
+
+	// 제거된 스펙 핸들이 입력 큐에 남아 매 프레임 캐시 미스를 일으키지 않도록 정리
+	// ProcessAbilityInput 순회 중(활성화/입력 이벤트로 어빌리티가 제거되는 경우)에는 배열을 건드리지 않고 끝난 뒤 정리
+	if (bProcessingAbilityInput)
+	{
+		PendingRemovedInputSpecHandles.AddUnique(AbilitySpec.Handle);
+	}
+	else
+	{
+		RemoveFromInputQueues(AbilitySpec.Handle);
+	}
 	
 	Super::OnRemoveAbility(AbilitySpec);
 }
 
+void USFAbilitySystemComponent::RemoveFromInputQueues(FGameplayAbilitySpecHandle Handle)
+{
+	InputStartedSpecHandles.Remove(Handle);
+	InputPressedSpecHandles.Remove(Handle);
+	InputReleasedSpecHandles.Remove(Handle);
+	InputHeldSpecHandles.Remove(Handle);
+}
+
+void USFAbilitySystemComponent::OnRep_ActivateAbilities()
+{
+	Super::OnRep_ActivateAbilities();
+
+	// 복제로 배열 순서/DynamicTag가 바뀌었을 수 있음
+	bSpecHandleIndexDirty = true;
+	for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+	{
+		RefreshAbilityInputTagIndex(AbilitySpec);
+	}
+}
+
+void USFAbilitySystemComponent::RefreshAbilityInputTagIndex(const FGameplayAbilitySpec& AbilitySpec)
+{
+	const FGameplayTagContainer* IndexedTags = SpecHandleToInputTags.Find(AbilitySpec.Handle);
+	if (IndexedTags && *IndexedTags == AbilitySpec.GetDynamicSpecSourceTags())
+	{
+		return;
+	}
+
+	RemoveFromInputTagIndex(AbilitySpec.Handle);
+	AddToInputTagIndex(AbilitySpec);
+}
+
+void USFAbilitySystemComponent::AddToInputTagIndex(const FGameplayAbilitySpec& AbilitySpec)
+{
+	const FGameplayTagContainer& DynamicTags = AbilitySpec.GetDynamicSpecSourceTags();
+	SpecHandleToInputTags.Add(AbilitySpec.Handle, DynamicTags);
+
+	for (const FGameplayTag& Tag : DynamicTags)
+	{
+		InputTagToSpecHandles.FindOrAdd(Tag).AddUnique(AbilitySpec.Handle);
+	}
+}
+
+void USFAbilitySystemComponent::RemoveFromInputTagIndex(FGameplayAbilitySpecHandle Handle)
+{
+	FGameplayTagContainer IndexedTags;
+	if (!SpecHandleToInputTags.RemoveAndCopyValue(Handle, IndexedTags))
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : IndexedTags)
+	{
+		if (TArray<FGameplayAbilitySpecHandle>* Handles = InputTagToSpecHandles.Find(Tag))
+		{
+			// 부여 순서를 유지해야 입력 처리 순서가 기존과 동일
+			Handles->Remove(Handle);
+			if (Handles->Num() == 0)
+			{
+				InputTagToSpecHandles.Remove(Tag);
+			}
+		}
+	}
+}
+
+void USFAbilitySystemComponent::RebuildSpecHandleIndex()
+{
+	SpecHandleToIndex.Reset();
+	for (int32 Index = 0; Index < ActivatableAbilities.Items.Num(); ++Index)
+	{
+		SpecHandleToIndex.Add(ActivatableAbilities.Items[Index].Handle, Index);
+	}
+	bSpecHandleIndexDirty = false;
+}
+
+FGameplayAbilitySpec* USFAbilitySystemComponent::FindAbilitySpecFromHandleCached(FGameplayAbilitySpecHandle Handle)
+{
+	if (!Handle.IsValid())
+	{
+		return nullptr;
+	}
+
+	for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+	{
+		if (const int32* CachedIndex = SpecHandleToIndex.Find(Handle))
+		{
+			if (ActivatableAbilities.Items.IsValidIndex(*CachedIndex) && ActivatableAbilities.Items[*CachedIndex].Handle == Handle)
+			{
+				return &ActivatableAbilities.Items[*CachedIndex];
+			}
+		}
+		else if (!bSpecHandleIndexDirty)
+		{
+			// 인덱스가 최신인데 없음 → 제거된 스펙
+			return nullptr;
+		}
+
+		RebuildSpecHandleIndex();
+	}
+
+	return nullptr;
+}
+
 void USFAbilitySystemComponent::TryActivateAbilitiesOnSpawn()
 {
 	ABILITYLIST_SCOPE_LOCK();
@@ -146,11 +278,18 @@ void USFAbilitySystemComponent::AbilityInputTagStarted(const FGameplayTag& Input
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		const TArray<FGameplayAbilitySpecHandle>* SpecHandles = InputTagToSpecHandles.Find(InputTag);
+		if (!SpecHandles)
 		{
-			if (AbilitySpec.Ability && AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag))
+			return;
+		}
+
+		for (const FGameplayAbilitySpecHandle& SpecHandle : *SpecHandles)
+		{
+			const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle);
+			if (AbilitySpec && AbilitySpec->Ability)
 			{
-				InputStartedSpecHandles.AddUnique(AbilitySpec.Handle);
+				InputStartedSpecHandles.AddUnique(AbilitySpec->Handle);
 			}
 		}
 	}
@@ -160,17 +299,26 @@ void USFAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& Input
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		const TArray<FGameplayAbilitySpecHandle>* SpecHandles = InputTagToSpecHandles.Find(InputTag);
+		if (!SpecHandles)
 		{
-			if (AbilitySpec.Ability && AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag))
+			return;
+		}
+
+		// HandleGameplayEvent 도중 어빌리티가 부여/제거되어 버킷이 바뀔 수 있으므로 복사본으로 순회
+		const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<4>> HandlesToProcess(*SpecHandles);
+		for (const FGameplayAbilitySpecHandle& SpecHandle : HandlesToProcess)
+		{
+			const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle);
+			if (AbilitySpec && AbilitySpec->Ability)
 			{
 				// 입력을 큐에 넣어서 ProcessAbilityInput에서 처리하게 함
-				InputPressedSpecHandles.AddUnique(AbilitySpec.Handle);
-				InputHeldSpecHandles.AddUnique(AbilitySpec.Handle);
+				InputPressedSpecHandles.AddUnique(AbilitySpec->Handle);
+				InputHeldSpecHandles.AddUnique(AbilitySpec->Handle);
 
 				// 콤보 시스템을 위한 핵심 로직
 				// 만약 이 어빌리티가 이미 '활성화(Active)' 상태라면? -> 콤보 입력으로 간주
-				if (AbilitySpec.IsActive())
+				if (AbilitySpec->IsActive())
 				{
 					// "Input.Action.Attack" 같은 태그를 Payload에 담음
 					FGameplayEventData Payload;
@@ -190,12 +338,19 @@ void USFAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& Inpu
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		const TArray<FGameplayAbilitySpecHandle>* SpecHandles = InputTagToSpecHandles.Find(InputTag);
+		if (!SpecHandles)
 		{
-			if (AbilitySpec.Ability && AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag))
+			return;
+		}
+
+		for (const FGameplayAbilitySpecHandle& SpecHandle : *SpecHandles)
+		{
+			const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle);
+			if (AbilitySpec && AbilitySpec->Ability)
 			{
-				InputReleasedSpecHandles.AddUnique(AbilitySpec.Handle);
-				InputHeldSpecHandles.Remove(AbilitySpec.Handle);
+				InputReleasedSpecHandles.AddUnique(AbilitySpec->Handle);
+				InputHeldSpecHandles.Remove(AbilitySpec->Handle);
 			}
 		}
 	}
@@ -213,6 +368,9 @@ void USFAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGameP
 		return;
 	}
 
+	// 아래 순회 중 OnRemoveAbility가 입력 배열을 수정하지 않도록 (제거는 6단계에서 반영)
+	bProcessingAbilityInput = true;
+
 	// 이번 프레임에 활성화할 어빌리티들을 저장할 정적 배열
 	// 정적 변수로 선언하여 매 프레임마다 메모리 할당을 피함
 	static TArray<FGameplayAbilitySpecHandle> AbilitiesToActivate;
@@ -223,7 +381,7 @@ void USFAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGameP
 	//
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputHeldSpecHandles)
 	{
-		if (const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(SpecHandle))
+		if (const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle))
 		{
 			if (AbilitySpec->Ability && !AbilitySpec->IsActive())
 			{
@@ -242,7 +400,7 @@ void USFAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGameP
 	//
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputStartedSpecHandles)
 	{
-		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(SpecHandle))
+		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle))
 		{
 			if (AbilitySpec->Ability)
 			{
@@ -259,7 +417,7 @@ void USFAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGameP
 	// 입력 pressed 이벤트 처리 (Pressed 이벤트 → 활성화 vs 입력 이벤트 분기)
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputPressedSpecHandles)
 	{
-		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(SpecHandle))
+		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle))
 		{
 			if (AbilitySpec->Ability)
 			{
@@ -303,7 +461,7 @@ void USFAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGameP
 	//
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputReleasedSpecHandles)
 	{
-		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(SpecHandle))
+		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle))
 		{
 			if (AbilitySpec->Ability)
 			{
@@ -320,11 +478,19 @@ void USFAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGameP
 		}
 	}
 
+	bProcessingAbilityInput = false;
+
 	//
 	// 6단계: 캐시된 입력 핸들들 초기화
 	// 다음 프레임을 위해 모든 입력 상태 배열을 리셋
-	// InputHeldSpecHandles는 지속적으로 유지되므로 초기화하지 않음
+	// InputHeldSpecHandles는 지속적으로 유지되므로 초기화하지 않고, 순회 중 제거된 어빌리티만 빼냄
 	//
+	for (const FGameplayAbilitySpecHandle& RemovedHandle : PendingRemovedInputSpecHandles)
+	{
+		InputHeldSpecHandles.Remove(RemovedHandle);
+	}
+	PendingRemovedInputSpecHandles.Reset();
+
 	InputStartedSpecHandles.Reset();
 	InputPressedSpecHandles.Reset();
 	InputReleasedSpecHandles.Reset();
@@ -340,39 +506,7 @@ void USFAbilitySystemComponent::ClearAbilityInput()
 
 void USFAbilitySystemComponent::SaveAttributesToData(FSFSavedAbilitySystemData& OutData) const
 {
-	OutData.SavedAttributes.Reset();
-
-	// 모든 Spawned AttributeSet 순회
-	for (const UAttributeSet* Set : GetSpawnedAttributes())
-	{
-		if (!Set)
-		{
-			continue;
-		}
-
-		// AttributeSet의 모든 FGameplayAttributeData 프로퍼티 순회
-		for (TFieldIterator<FProperty> It(Set->GetClass()); It; ++It)
-		{
-			FProperty* Property = *It;
-			FStructProperty* StructProp = CastField<FStructProperty>(Property);
-            
-			if (!StructProp || StructProp->Struct != FGameplayAttributeData::StaticStruct())
-			{
-				continue;
-			}
-
-			FGameplayAttribute Attribute(Property);
-			if (!Attribute.IsValid())
-			{
-				continue;
-			}
-
-			FSFSavedAttribute SavedAttr;
-			SavedAttr.Attribute = Attribute;
-			SavedAttr.BaseValue = GetNumericAttributeBase(Attribute);
-			OutData.SavedAttributes.Add(SavedAttr);
-		}
-	}
+	FSFAttributeSnapshotCodec::Encode(*this, OutData.AttributeSnapshot);
 }
 
 void USFAbilitySystemComponent::RestoreAttributesFromData(const FSFSavedAbilitySystemData& InData)
@@ -382,46 +516,10 @@ void USFAbilitySystemComponent::RestoreAttributesFromData(const FSFSavedAbilityS
 		return;
 	}
 
-	// Max 계열 Attribute를 먼저 복원하기 위해 분류
-	TArray<const FSFSavedAttribute*> MaxAttributes;
-	TArray<const FSFSavedAttribute*> OtherAttributes;
-
-	for (const FSFSavedAttribute& SavedAttr : InData.SavedAttributes)
-	{
-		if (!SavedAttr.Attribute.IsValid())
-		{
-			continue;
-		}
-
-		// Attribute 이름에 Max가 포함되어 있으면 Max 계열로 분류
-		const FString AttrName = SavedAttr.Attribute.GetName();
-		if (AttrName.Contains(TEXT("Max")))
-		{
-			MaxAttributes.Add(&SavedAttr);
-		}
-		else
-		{
-			OtherAttributes.Add(&SavedAttr);
-		}
-	}
-
-	int32 RestoredCount = 0;
-	
-	// Max 계열 먼저 복원 (MaxHealth, MaxMana, MaxStamina 등)
-	for (const FSFSavedAttribute* SavedAttr : MaxAttributes)
-	{
-		SetNumericAttributeBase(SavedAttr->Attribute, SavedAttr->BaseValue);
-		RestoredCount++;
-	}
-
-	// 나머지 Attribute 복원 (Health, Mana, Stamina 등)
-	for (const FSFSavedAttribute* SavedAttr : OtherAttributes)
-	{
-		SetNumericAttributeBase(SavedAttr->Attribute, SavedAttr->BaseValue);
-		RestoredCount++;
-	}
+	// 세트별 스키마의 의존성 순서(MaxHealth → Health 등)대로 복원
+	const int32 RestoredCount = FSFAttributeSnapshotCodec::Decode(*this, InData.AttributeSnapshot);
 
-	UE_LOG(LogSF, Log, TEXT("RestoreAttributesFromData: Restored %d/%d attributes"), RestoredCount, InData.SavedAttributes.Num());
+	UE_LOG(LogSF, Log, TEXT("RestoreAttributesFromData: Restored %d attributes from %d sets"), RestoredCount, InData.AttributeSnapshot.Sets.Num());
 }
 
 void USFAbilitySystemComponent::SaveAbilitiesToData(FSFSavedAbilitySystemData& OutData) const
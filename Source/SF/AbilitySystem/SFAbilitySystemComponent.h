@@ -24,6 +24,15 @@ public:
 	// 어빌리티 제거 시 AbilityChangedDelegate를 통해 UI 등에 변경사항 알림
 	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
 
+	// 클라이언트에서 스펙 DynamicTag가 복제로 바뀐 경우 입력 태그 인덱스 갱신
+	virtual void OnRep_ActivateAbilities() override;
+
+	// 부여 이후 스펙의 DynamicSpecSourceTags를 직접 변경했다면 호출하여 입력 태그 인덱스 갱신
+	void RefreshAbilityInputTagIndex(const FGameplayAbilitySpec& AbilitySpec);
+
+	// Handle → ActivatableAbilities 인덱스 캐시를 사용하는 스펙 조회 (캐시 미스 시 인덱스 재구성)
+	FGameplayAbilitySpec* FindAbilitySpecFromHandleCached(FGameplayAbilitySpecHandle Handle);
+
 	// InitAbilityActorInfo 호출 시 자동으로 활성화되어야 하는 어빌리티들을 처리
 	void TryActivateAbilitiesOnSpawn();
 
@@ -89,6 +98,17 @@ protected:
 	// ProcessAbilityInput에서 활성화된 어빌리티에 InputReleased 이벤트 전달
 	virtual void AbilitySpecInputReleased(FGameplayAbilitySpec& Spec) override;
 
+private:
+	// 입력 태그 인덱스에 스펙 추가/제거
+	void AddToInputTagIndex(const FGameplayAbilitySpec& AbilitySpec);
+	void RemoveFromInputTagIndex(FGameplayAbilitySpecHandle Handle);
+
+	// 입력 큐(Started/Pressed/Released/Held)에서 핸들 제거
+	void RemoveFromInputQueues(FGameplayAbilitySpecHandle Handle);
+
+	// ActivatableAbilities 전체를 훑어 Handle → 인덱스 맵 재구성
+	void RebuildSpecHandleIndex();
+
 public:
 	 // 어빌리티가 추가되거나 제거될 때 UI 등에 알림을 보내는 델리게이트(OnGiveAbility/OnRemoveAbility에서 브로드캐스트됨)
 	FAbilityChangedDelegate AbilityChangedDelegate;
@@ -106,6 +126,22 @@ protected:
 	// 현재 입력이 지속적으로 눌려있는 어빌리티들의 핸들.
 	TArray<FGameplayAbilitySpecHandle> InputHeldSpecHandles;
 
+	// ProcessAbilityInput이 입력 배열을 순회 중인지 / 그 사이 제거된 어빌리티 (순회가 끝난 뒤 InputHeldSpecHandles에서 제거)
+	bool bProcessingAbilityInput = false;
+	TArray<FGameplayAbilitySpecHandle> PendingRemovedInputSpecHandles;
+
+	// 입력 태그 → 해당 태그를 DynamicSpecSourceTags로 가진 스펙 핸들 (부여 순서 유지)
+	// AbilityInputTag* 에서 ActivatableAbilities 전체 순회 없이 O(1)로 조회
+	TMap<FGameplayTag, TArray<FGameplayAbilitySpecHandle>> InputTagToSpecHandles;
+
+	// 스펙 핸들 → 인덱싱에 사용한 태그 (DynamicTag 변경 시 이전 버킷에서 제거하기 위함)
+	TMap<FGameplayAbilitySpecHandle, FGameplayTagContainer> SpecHandleToInputTags;
+
+	// 스펙 핸들 → ActivatableAbilities.Items 인덱스
+	// RemoveAtSwap/복제로 순서가 바뀔 수 있으므로 조회 시 Handle 일치 여부를 검증하고, 불일치면 재구성
+	TMap<FGameplayAbilitySpecHandle, int32> SpecHandleToIndex;
+	bool bSpecHandleIndexDirty = false;
+
 	// 이 태그가 있으면 모든 어빌리티 입력 무시
 	UPROPERTY(EditDefaultsOnly, Category = "SF|Input")
 	FGameplayTagContainer InputBlockedTags;
@@ -13,6 +13,8 @@
 #include "AbilitySystem/GameplayEffect/SFGameplayEffectContext.h"
 #include "Character/SFCharacterBase.h"
 #include "Engine/OverlapResult.h"
+#include "Net/UnrealNetwork.h"
+#include "System/SFProjectilePoolSubsystem.h"
 
 ASFAttackProjectile::ASFAttackProjectile(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -59,6 +61,72 @@ void ASFAttackProjectile::BeginPlay()
 
 	SetLifeSpan(LifeSeconds);
 
+	// 풀 예열로 숨긴 채 스폰된 경우는 발사가 아니므로 제외
+	if (SpawnSound && !IsHidden())
+	{
+		UGameplayStatics::PlaySoundAtLocation(this, SpawnSound, GetActorLocation());
+	}
+}
+
+void ASFAttackProjectile::LifeSpanExpired()
+{
+	USFProjectilePoolSubsystem::ReleaseOrDestroy(this);
+}
+
+void ASFAttackProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ThisClass, PoolGeneration);
+	DOREPLIFETIME(ThisClass, ProjectileScale);
+}
+
+void ASFAttackProjectile::OnAcquiredFromPool()
+{
+	SetLifeSpan(LifeSeconds);
+
+	// 새 스폰 시 InitializeComponent가 하던 초기 속도 설정을 재현 (Launch가 이후 덮어씀)
+	ProjectileMovement->SetUpdatedComponent(Collision);
+	ProjectileMovement->Velocity = GetActorForwardVector() * ProjectileMovement->InitialSpeed;
+	ProjectileMovement->Activate(true);
+
+	++PoolGeneration;
+	PlayReuseEffects();
+}
+
+void ASFAttackProjectile::OnReleasedToPool()
+{
+	ProjectileMovement->StopMovementImmediately();
+	ProjectileMovement->Deactivate();
+	TrailNiagara->DeactivateImmediate();
+	Collision->ClearMoveIgnoreActors();
+
+	SourceASC.Reset();
+	SourceActor.Reset();
+	Damage = 0.f;
+	bIsExplosive = false;
+	ProjectileScale = 1.f;
+	SetActorScale3D(FVector::OneVector);
+}
+
+void ASFAttackProjectile::OnRep_PoolGeneration()
+{
+	SetActorScale3D(FVector(ProjectileScale));
+	Collision->ClearMoveIgnoreActors();
+
+	// 클라이언트 이동 재무장 (이전 충돌로 UpdatedComponent가 해제됐을 수 있음). 복제된 속도가 있으면 Launch 방향 우선
+	const FVector ReplicatedVelocity = GetReplicatedMovement().LinearVelocity;
+	ProjectileMovement->SetUpdatedComponent(Collision);
+	ProjectileMovement->Velocity = ReplicatedVelocity.IsNearlyZero() ? GetActorForwardVector() * ProjectileMovement->InitialSpeed : ReplicatedVelocity;
+	ProjectileMovement->Activate(true);
+
+	PlayReuseEffects();
+}
+
+void ASFAttackProjectile::PlayReuseEffects()
+{
+	TrailNiagara->ResetSystem();
+
 	if (SpawnSound)
 	{
 		UGameplayStatics::PlaySoundAtLocation(this, SpawnSound, GetActorLocation());
@@ -84,6 +152,7 @@ void ASFAttackProjectile::InitProjectileCharged(UAbilitySystemComponent* InSourc
 	InitProjectile(InSourceASC, InDamage, InSourceActor);
 
 	// 스케일 적용
+	ProjectileScale = InScale;
 	SetActorScale3D(FVector(InScale));
 
 	// 폭발 플래그 설정
@@ -135,7 +204,7 @@ void ASFAttackProjectile::OnProjectileHit(
 
 	if (bDestroyOnHit)
 	{
-		Destroy();
+		USFProjectilePoolSubsystem::ReleaseOrDestroy(this);
 	}
 }
 
@@ -249,7 +318,7 @@ void ASFAttackProjectile::OnProjectileOverlap(
 		// 관통이 아닌데, 파괴 옵션이 켜져 있으면 파괴
 		if (bDestroyOnHit)
 		{
-			Destroy();
+			USFProjectilePoolSubsystem::ReleaseOrDestroy(this);
 		}
 	}
 }
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
+#include "Interface/SFPoolableActorInterface.h"
 #include "SFAttackProjectile.generated.h"
 
 class USphereComponent;
@@ -15,7 +16,7 @@ class UGameplayEffect;
 class UAbilitySystemComponent;
 
 UCLASS()
-class SF_API ASFAttackProjectile : public AActor
+class SF_API ASFAttackProjectile : public AActor, public ISFPoolableActorInterface
 {
 	GENERATED_BODY()
 
@@ -29,8 +30,22 @@ public:
 	// 실제 발사(속도/방향 적용)
 	void Launch(const FVector& Direction);
 
+	//~ISFPoolableActorInterface
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	//~End of ISFPoolableActorInterface
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void LifeSpanExpired() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// 풀에서 재사용될 때 클라이언트에 BeginPlay 대신 전달
+	UFUNCTION()
+	void OnRep_PoolGeneration();
+
+	// 재사용 시작 연출 (트레일 리셋, 발사 사운드)
+	void PlayReuseEffects();
 
 protected:
 	UFUNCTION()
@@ -162,6 +177,14 @@ private:
 	
 	UPROPERTY()
 	bool bIsExplosive = false;
+
+	// 풀에서 꺼내질 때마다 증가 (Dormancy가 풀린 뒤 클라이언트가 재사용을 감지)
+	UPROPERTY(ReplicatedUsing = OnRep_PoolGeneration)
+	uint8 PoolGeneration = 0;
+
+	// 재사용 액터는 스폰 번치가 없으므로 차징 스케일을 별도로 복제
+	UPROPERTY(Replicated)
+	float ProjectileScale = 1.f;
 	
 private:
 	TSubclassOf<UGameplayEffect> ResolveDamageGE() const;
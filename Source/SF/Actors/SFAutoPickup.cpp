@@ -6,6 +6,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Player/SFPlayerState.h"
 #include "Item/Fragments/SFItemFragment_AutoPickup.h"
+#include "System/SFSpatialHashSubsystem.h"
 
 ASFAutoPickup::ASFAutoPickup()
 {
@@ -81,6 +82,11 @@ void ASFAutoPickup::BeginPlay()
     DetectionSphere->SetSphereRadius(DetectionRadius);
     CollectionSphere->SetSphereRadius(CollectionRadius);
 
+    if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+    {
+        SpatialHash->RegisterActor(this, ESFSpatialCategory::Pickup);
+    }
+
     if (HasAuthority())
     {
         DetectionSphere->OnComponentBeginOverlap.AddDynamic(this, &ASFAutoPickup::OnDetectionBeginOverlap);
@@ -97,6 +103,16 @@ void ASFAutoPickup::BeginPlay()
     }
 }
 
+void ASFAutoPickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+    {
+        SpatialHash->UnregisterActor(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void ASFAutoPickup::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
@@ -30,8 +30,15 @@ public:
 
     void Initialize(USFItemInstance* InItemInstance, int32 InAmount);
 
+    // 수집 효과 적용. USFPickupManagerComponent가 CDO로도 호출하므로 인스턴스 상태를 사용하지 말 것
+    virtual void ApplyCollectEffect(ASFPlayerState* PlayerState, int32 CollectAmount) const {}
+
+    float GetDropInitialSpeed() const { return DropInitialSpeed; }
+    float GetDropInitialAngle() const { return DropInitialAngle; }
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -49,8 +56,6 @@ protected:
     void Collect(AActor* Collector);
     bool IsPlayerCharacter(AActor* Actor) const;
 
-    virtual void ApplyCollectEffect(ASFPlayerState* PlayerState, int32 CollectAmount) {}
-
     UFUNCTION()
     void OnRep_PickupState();
 
@@ -1,7 +1,7 @@
 #include "SFAutoPickup_Gold.h"
 #include "Player/SFPlayerState.h"
 
-void ASFAutoPickup_Gold::ApplyCollectEffect(ASFPlayerState* PlayerState, int32 CollectAmount)
+void ASFAutoPickup_Gold::ApplyCollectEffect(ASFPlayerState* PlayerState, int32 CollectAmount) const
 {
 	if (PlayerState)
 	{
@@ -9,6 +9,6 @@ class SF_API ASFAutoPickup_Gold : public ASFAutoPickup
 {
 	GENERATED_BODY()
 
-protected:
-	virtual void ApplyCollectEffect(ASFPlayerState* PlayerState, int32 CollectAmount) override;
+public:
+	virtual void ApplyCollectEffect(ASFPlayerState* PlayerState, int32 CollectAmount) const override;
 };
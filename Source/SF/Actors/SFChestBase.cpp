@@ -2,6 +2,7 @@
 
 #include "Components/ArrowComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "System/SFNetDormancySubsystem.h"
 
 ASFChestBase::ASFChestBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -70,6 +71,11 @@ void ASFChestBase::SetChestState(ESFChestState NewChestState)
 		return;
 	}
 	
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->WakeActor(this);
+	}
+	
 	ChestState = NewChestState;
 	OnRep_ChestState();
 }
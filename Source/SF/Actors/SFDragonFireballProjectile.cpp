@@ -10,6 +10,7 @@
 #include "AbilitySystem/GameplayCues/SFGameplayCueTags.h"
 #include "AbilitySystem/GameplayEvent/SFGameplayEventTags.h"
 #include "Character/SFCharacterBase.h"
+#include "System/SFProjectilePoolSubsystem.h"
 
 ASFDragonFireballProjectile::ASFDragonFireballProjectile()
 {
@@ -40,7 +41,7 @@ void ASFDragonFireballProjectile::OnProjectileHit(UPrimitiveComponent* HitCompon
 
     if (!OwnerChar)
     {
-        if (HasAuthority()) Destroy();
+        if (HasAuthority()) USFProjectilePoolSubsystem::ReleaseOrDestroy(this);
         return;
     }
     
@@ -95,6 +96,6 @@ void ASFDragonFireballProjectile::OnProjectileHit(UPrimitiveComponent* HitCompon
             SFGameplayTags::GameplayCue_Dragon_FireBallExplosion,
             CueParams
         );
-        Destroy();
+        USFProjectilePoolSubsystem::ReleaseOrDestroy(this);
     }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Item/SFItemInstance.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "System/SFAssetManager.h"
+#include "System/SFNetDormancySubsystem.h"
 
 
 ASFPickupableItemBase::ASFPickupableItemBase(const FObjectInitializer& ObjectInitializer)
@@ -39,6 +40,31 @@ ASFPickupableItemBase::ASFPickupableItemBase(const FObjectInitializer& ObjectIni
 	ProjectileMovement->Velocity = FVector::ZeroVector;
 }
 
+void ASFPickupableItemBase::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!HasAuthority() || !ProjectileMovement->IsActive())
+	{
+		return;
+	}
+
+	// 드롭 후 바닥에 멈출 때까지는 위치 복제가 필요하므로 깨어 있음
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->SetActorPinnedAwake(this, true);
+		ProjectileMovement->OnProjectileStop.AddDynamic(this, &ThisClass::OnDropMovementStopped);
+	}
+}
+
+void ASFPickupableItemBase::OnDropMovementStopped(const FHitResult& ImpactResult)
+{
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->SetActorPinnedAwake(this, false);
+	}
+}
+
 void ASFPickupableItemBase::OnRep_PickupInfo()
 {
 	Super::OnRep_PickupInfo();
@@ -16,10 +16,14 @@ public:
 	ASFPickupableItemBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 protected:
+	virtual void BeginPlay() override;
 	virtual void OnRep_PickupInfo() override;
 	virtual void GetMeshComponents(TArray<UMeshComponent*>& OutMeshComponents) const override;
 	virtual ESFOutlineStencil GetOutlineStencil() const;
 
+	UFUNCTION()
+	void OnDropMovementStopped(const FHitResult& ImpactResult);
+
 protected:
 	UPROPERTY(EditDefaultsOnly)
 	bool bAutoCollisionResize = true;
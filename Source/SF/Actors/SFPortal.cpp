@@ -9,12 +9,15 @@
 #include "GameModes/SFPortalManagerComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Player/SFPlayerState.h"
+#include "System/SFNetDormancySubsystem.h"
+#include "System/SFSpatialHashSubsystem.h"
 
 ASFPortal::ASFPortal()
 {
 	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
 	bAlwaysRelevant = true; // 모든 클라이언트에게 항상 관련성 있음
+	NetDormancy = DORM_Initial; // 활성화/Ready 변경 시에만 USFNetDormancySubsystem이 깨움
 
 	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
 	SetRootComponent(Root);
@@ -49,6 +52,16 @@ void ASFPortal::BeginPlay()
 	
 	// PortalManager에 등록
 	FindAndRegisterWithManager();
+
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->RegisterActor(this, ESFSpatialCategory::Interactable);
+	}
+
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->RegisterActor(this);
+	}
 }
 
 void ASFPortal::FindAndRegisterWithManager()
@@ -103,6 +116,11 @@ void ASFPortal::SetPortalEnabled(bool bEnabled)
 		return;
 	}
 
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->WakeActor(this);
+	}
+
 	bIsEnabled = bEnabled;
 
 	// Listen 서버 비주얼 업데이트
@@ -110,7 +128,14 @@ void ASFPortal::SetPortalEnabled(bool bEnabled)
 
 	if (bEnabled)
 	{
-		MulticastPlayActivateSound();
+		// Dormant였던 채널은 이번 프레임 NetDriver 틱에서 다시 열리므로 RPC는 다음 틱에 전송
+		GetWorldTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this]()
+		{
+			if (bIsEnabled)
+			{
+				MulticastPlayActivateSound();
+			}
+		}));
 	}
 }
 
@@ -121,6 +146,12 @@ void ASFPortal::TogglePlayerReady(APlayerState* PlayerState)
 		return;
 	}
 
+	// Ready 인원 변경 중 포탈 쪽 변경분(BP 포함)도 전송되도록 잠깐 깨움
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->WakeActor(this);
+	}
+
 	if (CachedPortalManager)
 	{
 		CachedPortalManager->TogglePlayerReady(PlayerState);
@@ -183,6 +214,16 @@ void ASFPortal::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		CachedPortalManager->UnregisterPortal(this);
 	}
 
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->UnregisterActor(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -4,6 +4,8 @@
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "NiagaraComponent.h"
 #include "Character/SFCharacterBase.h"
+#include "Net/UnrealNetwork.h"
+#include "System/SFProjectilePoolSubsystem.h"
 
 ASFProjectileBase::ASFProjectileBase()
 {
@@ -61,8 +63,53 @@ void ASFProjectileBase::BeginPlay()
     CollisionComponent->OnComponentHit.AddDynamic(this, &ASFProjectileBase::OnProjectileHit);
 }
 
+void ASFProjectileBase::LifeSpanExpired()
+{
+    USFProjectilePoolSubsystem::ReleaseOrDestroy(this);
+}
+
+void ASFProjectileBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ThisClass, PoolGeneration);
+}
+
+void ASFProjectileBase::OnAcquiredFromPool()
+{
+    // 새 스폰 시 InitializeComponent가 하던 초기 속도 설정을 재현
+    ProjectileMovement->SetUpdatedComponent(CollisionComponent);
+    ProjectileMovement->Velocity = GetActorForwardVector() * ProjectileMovement->InitialSpeed;
+    ProjectileMovement->Activate(true);
+
+    ProjectileEffect->Activate(true);
+
+    ++PoolGeneration;
+}
+
+void ASFProjectileBase::OnReleasedToPool()
+{
+    ProjectileMovement->StopMovementImmediately();
+    ProjectileMovement->Deactivate();
+    ProjectileEffect->DeactivateImmediate();
+    CollisionComponent->ClearMoveIgnoreActors();
+
+    OwnerChar = nullptr;
+}
+
+void ASFProjectileBase::OnRep_PoolGeneration()
+{
+    // 클라이언트 이동 재무장 (이전 충돌로 UpdatedComponent가 해제됐을 수 있음)
+    const FVector ReplicatedVelocity = GetReplicatedMovement().LinearVelocity;
+    ProjectileMovement->SetUpdatedComponent(CollisionComponent);
+    ProjectileMovement->Velocity = ReplicatedVelocity.IsNearlyZero() ? GetActorForwardVector() * ProjectileMovement->InitialSpeed : ReplicatedVelocity;
+    ProjectileMovement->Activate(true);
+
+    ProjectileEffect->ResetSystem();
+}
+
 void ASFProjectileBase::OnProjectileHit(UPrimitiveComponent* HitComponent, AActor* OtherActor,
     UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
-    Destroy();
+    USFProjectilePoolSubsystem::ReleaseOrDestroy(this);
 }
\ No newline at end of file
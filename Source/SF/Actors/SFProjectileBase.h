@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Interface/SFPoolableActorInterface.h"
 #include "SFProjectileBase.generated.h"
 
 class ASFCharacterBase;
@@ -11,7 +12,7 @@ class UNiagaraComponent;
 class UStaticMeshComponent; // [추가] 전방 선언
 
 UCLASS()
-class SF_API ASFProjectileBase : public AActor
+class SF_API ASFProjectileBase : public AActor, public ISFPoolableActorInterface
 {
 	GENERATED_BODY()
 
@@ -19,8 +20,20 @@ public:
 	ASFProjectileBase();
 
 	virtual void SetOwner(AActor* NewOwner) override;
+
+	//~ISFPoolableActorInterface
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	//~End of ISFPoolableActorInterface
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void LifeSpanExpired() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// 풀에서 재사용될 때 클라이언트에서 이전 이펙트 잔상 제거
+	UFUNCTION()
+	void OnRep_PoolGeneration();
 
 	UFUNCTION()
 	virtual void OnProjectileHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, 
@@ -54,5 +67,9 @@ protected:
 protected:
 	UPROPERTY()
 	TObjectPtr<ASFCharacterBase> OwnerChar;
+
+	// 풀에서 꺼내질 때마다 증가 (Dormancy가 풀린 뒤 클라이언트가 재사용을 감지)
+	UPROPERTY(ReplicatedUsing = OnRep_PoolGeneration)
+	uint8 PoolGeneration = 0;
     
 };
\ No newline at end of file
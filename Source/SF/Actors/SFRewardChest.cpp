@@ -3,6 +3,7 @@
 #include "GameModes/SFGameState.h"
 #include "GameModes/SFStageManagerComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "System/SFNetDormancySubsystem.h"
 
 ASFRewardChest::ASFRewardChest(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -34,6 +35,12 @@ void ASFRewardChest::BeginPlay()
 	if (bOverrideRewardType)
 	{
 		RewardType = OverriddenRewardType;
+
+		// 배치 액터는 DORM_Initial이라 BeginPlay에서 바꾼 값도 깨워서 전송
+		if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+		{
+			NetDormancySubsystem->WakeActor(this);
+		}
 	}
 
 	// 스테이지 클리어 이벤트 바인딩
@@ -102,6 +109,11 @@ void ASFRewardChest::ClaimReward(AActor* Interactor)
 		return;
 	}
 
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->WakeActor(this);
+	}
+
 	ClaimedPlayers.Add(PS);
 }
 
@@ -112,6 +124,11 @@ void ASFRewardChest::OnStageClearedHandler(const FSFStageInfo& ClearedStageInfo)
 		return;
 	}
 
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->WakeActor(this);
+	}
+
 	CachedStageIndex = ClearedStageInfo.StageIndex;
 	if (!bOverrideRewardType)
 	{
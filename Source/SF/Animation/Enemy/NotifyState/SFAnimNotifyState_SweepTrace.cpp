@@ -5,6 +5,7 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "Combat/SFCombatTraceSubsystem.h"
 #include "Animation/Hero/AnimNotify/SFAnimNotify_SendGameplayEvent.h"
 #include "DrawDebugHelpers.h"
 
@@ -13,35 +14,39 @@ void USFAnimNotifyState_SweepTrace::NotifyBegin(USkeletalMeshComponent* MeshComp
 {
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-	// 타이머 초기화
-	TimeSinceLastTrace = 0.f;
-	HitActors.Reset();
+	AActor* Owner = MeshComp->GetOwner();
+	if (!Owner || !Owner->HasAuthority())
+		return;
+
+	// 메시별 컨텍스트 등록 (타이머/히트 목록 초기화 포함). 실제 Trace는 서브시스템 배치에서 수행
+	if (USFCombatTraceSubsystem* TraceSubsystem = USFCombatTraceSubsystem::Get(MeshComp))
+	{
+		TraceSubsystem->BeginSweepTrace(this, MeshComp, EventReference);
+	}
 }
 
-void USFAnimNotifyState_SweepTrace::NotifyTick(
-	USkeletalMeshComponent* MeshComp,
-	UAnimSequenceBase* Animation,
-	float DeltaTime,
-	const FAnimNotifyEventReference& EventReference)
+int32 USFAnimNotifyState_SweepTrace::GetNumSweepSegments() const
 {
-	Super::NotifyTick(MeshComp, Animation, DeltaTime, EventReference);
+	int32 NumSegments = 0;
+	for (const FSFSweepSocketChain& Chain : SocketChains)
+	{
+		NumSegments += FMath::Max(0, Chain.Nodes.Num() - 1);
+	}
+	return NumSegments;
+}
 
+int32 USFAnimNotifyState_SweepTrace::PerformSweep(USkeletalMeshComponent* MeshComp, FSFSweepTraceContext& Context) const
+{
 	AActor* Owner = MeshComp->GetOwner();
 
 	if (!Owner || !Owner->HasAuthority())
-		return;
+		return 0;
 
 	UWorld* World = Owner->GetWorld();
 	if (!World)
-		return;
+		return 0;
 
-	// TraceInterval 체크
-	TimeSinceLastTrace += DeltaTime;
-	if (TimeSinceLastTrace < TraceInterval)
-		return;
-
-	// Trace 수행 후 타이머 리셋
-	TimeSinceLastTrace = 0.f;
+	int32 NumSweeps = 0;
 
 	for (const FSFSweepSocketChain& Chain : SocketChains)
 	{
@@ -69,39 +74,38 @@ void USFAnimNotifyState_SweepTrace::NotifyTick(
 			Params.bTraceComplex = false;
 
 			bool bHit = false;
+			++NumSweeps;
 
-			switch (Chain.TraceType)
+			const FCollisionShape Shape = (Chain.TraceType == ESFSweepTraceType::Capsule)
+				? FCollisionShape::MakeCapsule(Radius, FVector::Dist(Start, End) * 0.5f + Chain.HalfHeightPadding)
+				: FCollisionShape::MakeSphere(Radius);
+
+			if (Context.bUseAsyncTrace)
+			{
+				// 결과는 다음 프레임 CollectAsyncSweeps에서 제출 순서대로 수집
+				const FTraceHandle Handle = (Chain.TraceType == ESFSweepTraceType::Line)
+					? World->AsyncLineTraceByChannel(EAsyncTraceType::Multi, Start, End, TraceChannel, Params)
+					: World->AsyncSweepByChannel(EAsyncTraceType::Multi, Start, End, FQuat::Identity, TraceChannel, Shape, Params);
+				Context.PendingTraceHandles.Add(Handle);
+			}
+			else if (Chain.TraceType == ESFSweepTraceType::Line)
 			{
-			case ESFSweepTraceType::Line:
 				bHit = World->LineTraceMultiByChannel(
 					Hits, Start, End, TraceChannel, Params);
-				break;
-
-			case ESFSweepTraceType::Sphere:
-				bHit = World->SweepMultiByChannel(
-					Hits, Start, End, FQuat::Identity,
-					TraceChannel,
-					FCollisionShape::MakeSphere(Radius),
-					Params);
-				break;
-
-			case ESFSweepTraceType::Capsule:
+			}
+			else
 			{
-				const float HalfHeight =
-					FVector::Dist(Start, End) * 0.5f + Chain.HalfHeightPadding;
-
 				bHit = World->SweepMultiByChannel(
 					Hits, Start, End, FQuat::Identity,
 					TraceChannel,
-					FCollisionShape::MakeCapsule(Radius, HalfHeight),
+					Shape,
 					Params);
-				break;
-			}
 			}
 
 			// 디버그 시각화
 			if (bIsDebug)
 			{
+				// 비동기 모드는 제출 시점에 결과를 모르므로 Red로 표시
 				FColor DebugColor = bHit ? FColor::Green : FColor::Red;
 				float DebugDuration = 2.0f;
 				float DebugThickness = 2.0f;
@@ -135,44 +139,85 @@ void USFAnimNotifyState_SweepTrace::NotifyTick(
 				
 			}
 
-			if (!bHit)
-				continue;
-
-			for (const FHitResult& Hit : Hits)
+			if (bHit)
 			{
-				AActor* HitActor = Hit.GetActor();
-				if (!HitActor || HitActor == Owner)
-					continue;
-
-				if (!HitActor->IsA(APawn::StaticClass()))
-				{
-					continue;
-				}
-				if (HitActors.Contains(HitActor))
-					continue;
-
-				HitActors.Add(HitActor);
-
-				// Gameplay Event 전달
-				FGameplayEventData EventData;
-				EventData.EventTag = EventTag;
-				EventData.Instigator = Owner;
-				EventData.Target = HitActor;
-				UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Owner);
-				if (!ASC)
-					continue;
-				FGameplayEffectContextHandle ContextHandle = ASC->MakeEffectContext();
-				ContextHandle.AddHitResult(Hit);
-				EventData.ContextHandle = ContextHandle;
-
-				UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(
-					Owner,
-					EventTag,
-					EventData
-				);
+				ProcessHits(Owner, Hits, Context);
 			}
 		}
 	}
+
+	return NumSweeps;
+}
+
+void USFAnimNotifyState_SweepTrace::CollectAsyncSweeps(USkeletalMeshComponent* MeshComp, FSFSweepTraceContext& Context) const
+{
+	if (Context.PendingTraceHandles.Num() == 0)
+		return;
+
+	AActor* Owner = MeshComp->GetOwner();
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	if (!World)
+	{
+		Context.PendingTraceHandles.Reset();
+		return;
+	}
+
+	for (const FTraceHandle& Handle : Context.PendingTraceHandles)
+	{
+		FTraceDatum TraceDatum;
+		if (World->QueryTraceData(Handle, TraceDatum) && TraceDatum.OutHits.Num() > 0)
+		{
+			ProcessHits(Owner, TraceDatum.OutHits, Context);
+		}
+	}
+	Context.PendingTraceHandles.Reset();
+}
+
+void USFAnimNotifyState_SweepTrace::ProcessHits(AActor* Owner, const TArray<FHitResult>& Hits, FSFSweepTraceContext& Context) const
+{
+	USFCombatTraceSubsystem* TraceSubsystem = USFCombatTraceSubsystem::Get(Owner);
+
+	for (const FHitResult& Hit : Hits)
+	{
+		AActor* HitActor = Hit.GetActor();
+		if (!HitActor || HitActor == Owner)
+			continue;
+
+		if (!HitActor->IsA(APawn::StaticClass()))
+		{
+			continue;
+		}
+		if (Context.HitActors.Contains(HitActor))
+			continue;
+
+		Context.HitActors.Add(HitActor);
+
+		// Gameplay Event 전달
+		FGameplayEventData EventData;
+		EventData.EventTag = EventTag;
+		EventData.Instigator = Owner;
+		EventData.Target = HitActor;
+		UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Owner);
+		if (!ASC)
+			continue;
+		FGameplayEffectContextHandle ContextHandle = ASC->MakeEffectContext();
+		ContextHandle.AddHitResult(Hit);
+		EventData.ContextHandle = ContextHandle;
+
+		// 배치 처리 도중이므로 서브시스템에 예약 (이벤트가 다른 트레이스의 Begin/End를 일으킬 수 있음)
+		if (TraceSubsystem)
+		{
+			TraceSubsystem->QueueHitEvent(Owner, EventTag, EventData);
+		}
+		else
+		{
+			UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(
+				Owner,
+				EventTag,
+				EventData
+			);
+		}
+	}
 }
 
 
@@ -181,5 +226,8 @@ void USFAnimNotifyState_SweepTrace::NotifyEnd(USkeletalMeshComponent* MeshComp,
 {
 	Super::NotifyEnd(MeshComp, Animation, EventReference);
 
-	HitActors.Reset();
+	if (USFCombatTraceSubsystem* TraceSubsystem = USFCombatTraceSubsystem::Get(MeshComp))
+	{
+		TraceSubsystem->EndSweepTrace(MeshComp, EventReference);
+	}
 }
@@ -7,6 +7,8 @@
 #include "Animation/AnimNotifies/AnimNotifyState.h"
 #include "SFAnimNotifyState_SweepTrace.generated.h"
 
+struct FSFSweepTraceContext;
+
 /**
  * 
  */
@@ -62,9 +64,23 @@ class SF_API USFAnimNotifyState_SweepTrace : public UAnimNotifyState
 
 public:
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
-	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
 
+	// USFCombatTraceSubsystem의 프레임 배치에서 호출. 실행한 스윕 수 반환
+	int32 PerformSweep(USkeletalMeshComponent* MeshComp, FSFSweepTraceContext& Context) const;
+
+	// 이전 프레임에 제출한 비동기 스윕 결과를 소켓 구간 순서대로 수집
+	void CollectAsyncSweeps(USkeletalMeshComponent* MeshComp, FSFSweepTraceContext& Context) const;
+
+	float GetTraceInterval() const { return TraceInterval; }
+
+	// PerformSweep 한 번에 실행하는 스윕(소켓 구간) 수. 프레임 예산 계산용
+	int32 GetNumSweepSegments() const;
+
+private:
+	// Pawn 필터 + 중복 제거 후 히트마다 Gameplay Event 전달
+	void ProcessHits(AActor* Owner, const TArray<FHitResult>& Hits, FSFSweepTraceContext& Context) const;
+
 protected:
 
 	UPROPERTY(EditAnywhere, Category= "SweepTrace")
@@ -82,11 +98,5 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "SweepTrace")
 	float TraceInterval = 0.03f;
 
-private:
-	// 맞은 액터들
-	TSet<TWeakObjectPtr<AActor>> HitActors;
-
-	// 마지막 Trace 수행 시간
-	float TimeSinceLastTrace = 0.f;
-
+	// 맞은 액터/마지막 Trace 경과 시간은 메시별로 달라야 하므로 USFCombatTraceSubsystem의 FSFSweepTraceContext에 보관
 };
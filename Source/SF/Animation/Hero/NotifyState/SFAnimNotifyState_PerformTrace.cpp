@@ -7,6 +7,7 @@
 #include "KismetTraceUtils.h"
 #include "SFLogChannels.h"
 #include "Character/SFCharacterBase.h"
+#include "Combat/SFCombatTraceSubsystem.h"
 #include "Components/BoxComponent.h"
 #include "Equipment/SFEquipmentTags.h"
 #include "Equipment/EquipmentComponent/SFEquipmentComponent.h"
@@ -33,6 +34,7 @@ void USFAnimNotifyState_PerformTrace::NotifyBegin(USkeletalMeshComponent* MeshCo
 		return;
 	}
 
+	ASFEquipmentBase* WeaponActor = nullptr;
 	if (ASFCharacterBase* SFCharacter = Cast<ASFCharacterBase>(MeshComponent->GetOwner()))
 	{
 		if (USFEquipmentComponent* EquipmentComponent = SFCharacter->FindComponentByClass<USFEquipmentComponent>())
@@ -40,67 +42,65 @@ void USFAnimNotifyState_PerformTrace::NotifyBegin(USkeletalMeshComponent* MeshCo
 			ASFEquipmentBase* EquipmentActor = Cast<ASFEquipmentBase>(EquipmentComponent->GetFirstEquippedActorBySlot(WeaponSlotTag));
 			if (EquipmentActor && EquipmentComponent->IsSlotEquipmentMatchesTag(WeaponSlotTag, SFGameplayTags::EquipmentTag_Weapon))
 			{
-				CachedWeaponActor = EquipmentActor;
-				
-				// 트레이스 방식에 따라 Transform 소스 선택
-				if (TraceParams.TraceMethod == ESFTraceMethod::ComponentSweep)
-				{
-					PreviousTraceTransform = CachedWeaponActor->MeshComponent->GetComponentTransform();
-					PreviousDebugTransform = CachedWeaponActor->TraceDebugCollision->GetComponentTransform();
-				}
-				else
-				{
-					PreviousTraceTransform = CachedWeaponActor->TraceDebugCollision->GetComponentTransform();
-					PreviousDebugTransform = PreviousTraceTransform;
-				}
-				PreviousSocketTransform = CachedWeaponActor->MeshComponent->GetSocketTransform(TraceParams.TraceSocketName);
+				WeaponActor = EquipmentActor;
 			}
 		}
 	}
 
-	if (CachedWeaponActor.IsValid())
+	if (!WeaponActor)
 	{
-#if UE_EDITOR
-		if (TraceDebugParams.bLogTraceInfo)
-		{
-			FVector WeaponExtent = CachedWeaponActor->TraceDebugCollision->GetScaledBoxExtent();
-			FVector ScaleDiff = TraceShapeParams.ExtentScale - FVector::OneVector;
-			FVector CalculatedOffset = WeaponExtent * ScaleDiff;
-
-			UE_LOG(LogSF, Warning, TEXT("========== Trace Box Info =========="));
-			UE_LOG(LogSF, Warning, TEXT("Weapon BoxExtent: X=%.1f, Y=%.1f, Z=%.1f"), 
-				WeaponExtent.X, WeaponExtent.Y, WeaponExtent.Z);
-			UE_LOG(LogSF, Warning, TEXT("ExtentScale: X=%.1f, Y=%.1f, Z=%.1f"), 
-				TraceShapeParams.ExtentScale.X, TraceShapeParams.ExtentScale.Y, TraceShapeParams.ExtentScale.Z);
-			UE_LOG(LogSF, Warning, TEXT("------------------------------------"));
-			UE_LOG(LogSF, Warning, TEXT("한쪽 방향 확장용 PivotOffset:"));
-			UE_LOG(LogSF, Warning, TEXT("  + 방향: (%.1f, %.1f, %.1f)"), 
-				CalculatedOffset.X, CalculatedOffset.Y, CalculatedOffset.Z);
-			UE_LOG(LogSF, Warning, TEXT("  - 방향: (%.1f, %.1f, %.1f)"), 
-				-CalculatedOffset.X, -CalculatedOffset.Y, -CalculatedOffset.Z);
-			UE_LOG(LogSF, Warning, TEXT("===================================="));
-		}
-#endif
+		return;
 	}
 
-	CachedHitActors.Empty();
-}
-
-void USFAnimNotifyState_PerformTrace::NotifyTick(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
-{
-	Super::NotifyTick(MeshComponent, Animation, FrameDeltaTime, EventReference);
-
-	if (MeshComponent->GetOwnerRole() != ExecuteNetRole)
+	USFCombatTraceSubsystem* TraceSubsystem = USFCombatTraceSubsystem::Get(MeshComponent);
+	if (!TraceSubsystem)
 	{
 		return;
 	}
 
-	if (CachedWeaponActor.IsValid() == false)
+	// 메시 + 노티파이 이벤트 단위 컨텍스트 생성 (히트 목록은 새로 시작)
+	FSFWeaponTraceContext* Context = TraceSubsystem->BeginWeaponTrace(this, MeshComponent, EventReference);
+	if (!Context)
 	{
 		return;
 	}
 
-	PerformTrace(MeshComponent);
+	Context->WeaponActor = WeaponActor;
+
+	// 트레이스 방식에 따라 Transform 소스 선택
+	if (TraceParams.TraceMethod == ESFTraceMethod::ComponentSweep)
+	{
+		Context->PreviousTraceTransform = WeaponActor->MeshComponent->GetComponentTransform();
+		Context->PreviousDebugTransform = WeaponActor->TraceDebugCollision->GetComponentTransform();
+	}
+	else
+	{
+		Context->PreviousTraceTransform = WeaponActor->TraceDebugCollision->GetComponentTransform();
+		Context->PreviousDebugTransform = Context->PreviousTraceTransform;
+	}
+	Context->PreviousSocketTransform = WeaponActor->MeshComponent->GetSocketTransform(TraceParams.TraceSocketName);
+
+#if UE_EDITOR
+	if (TraceDebugParams.bLogTraceInfo)
+	{
+		FVector WeaponExtent = WeaponActor->TraceDebugCollision->GetScaledBoxExtent();
+		FVector ScaleDiff = TraceShapeParams.ExtentScale - FVector::OneVector;
+		FVector CalculatedOffset = WeaponExtent * ScaleDiff;
+
+		UE_LOG(LogSF, Warning, TEXT("========== Trace Box Info =========="));
+		UE_LOG(LogSF, Warning, TEXT("Weapon BoxExtent: X=%.1f, Y=%.1f, Z=%.1f"), 
+			WeaponExtent.X, WeaponExtent.Y, WeaponExtent.Z);
+		UE_LOG(LogSF, Warning, TEXT("ExtentScale: X=%.1f, Y=%.1f, Z=%.1f"), 
+			TraceShapeParams.ExtentScale.X, TraceShapeParams.ExtentScale.Y, TraceShapeParams.ExtentScale.Z);
+		UE_LOG(LogSF, Warning, TEXT("------------------------------------"));
+		UE_LOG(LogSF, Warning, TEXT("한쪽 방향 확장용 PivotOffset:"));
+		UE_LOG(LogSF, Warning, TEXT("  + 방향: (%.1f, %.1f, %.1f)"), 
+			CalculatedOffset.X, CalculatedOffset.Y, CalculatedOffset.Z);
+		UE_LOG(LogSF, Warning, TEXT("  - 방향: (%.1f, %.1f, %.1f)"), 
+			-CalculatedOffset.X, -CalculatedOffset.Y, -CalculatedOffset.Z);
+		UE_LOG(LogSF, Warning, TEXT("===================================="));
+	}
+#endif
 }
 
 void USFAnimNotifyState_PerformTrace::NotifyEnd(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
@@ -112,29 +112,43 @@ void USFAnimNotifyState_PerformTrace::NotifyEnd(USkeletalMeshComponent* MeshComp
 		return;
 	}
 
-	// 무기 액터 유효성 검증
-	if (CachedWeaponActor.IsValid() == false)
+	// 마지막 트레이스는 이번 프레임 배치에서 수행 후 컨텍스트 제거
+	if (USFCombatTraceSubsystem* TraceSubsystem = USFCombatTraceSubsystem::Get(MeshComponent))
 	{
-		return;
+		TraceSubsystem->EndWeaponTrace(MeshComponent, EventReference);
 	}
-
-	PerformTrace(MeshComponent);
 }
 
-void USFAnimNotifyState_PerformTrace::PerformTrace(USkeletalMeshComponent* MeshComponent)
+int32 USFAnimNotifyState_PerformTrace::PerformTrace(USkeletalMeshComponent* MeshComponent, FSFWeaponTraceContext& Context, int32 MaxSubSteps) const
 {
-	FTransform CurrentSocketTransform = CachedWeaponActor->MeshComponent->GetSocketTransform(TraceParams.TraceSocketName);
+	ASFEquipmentBase* WeaponActor = Context.WeaponActor.Get();
+	if (!WeaponActor)
+	{
+		return 0;
+	}
+
+	FTransform CurrentSocketTransform = WeaponActor->MeshComponent->GetSocketTransform(TraceParams.TraceSocketName);
 
 	// 이전 프레임과 현재 프레임 간 소켓 이동 거리 계산
-	float Distance = (PreviousSocketTransform.GetLocation() - CurrentSocketTransform.GetLocation()).Length();
+	float Distance = (Context.PreviousSocketTransform.GetLocation() - CurrentSocketTransform.GetLocation()).Length();
 
 	// TargetDistance 기준으로 서브스텝 개수 결정
 	// 예: Distance=50, TargetDistance=20 → SubStepCount=3
 	int SubStepCount = FMath::CeilToInt(Distance / TraceParams.TargetDistance);
 	if (SubStepCount <= 0)
 	{
-		return;
+		return 0;
 	}
+
+	// 프레임 예산을 넘는 경우 서브스텝을 줄여서 실행 (이동 구간 전체는 그대로 커버)
+	if (MaxSubSteps > 0)
+	{
+		SubStepCount = FMath::Min(SubStepCount, MaxSubSteps);
+	}
+
+	// ComponentSweep은 비동기 API가 없으므로 항상 동기 실행
+	const bool bAsync = Context.bUseAsyncTrace && TraceParams.TraceMethod == ESFTraceMethod::BoxSweep;
+	UWorld* World = MeshComponent->GetWorld();
 	
 	// 각 서브스텝의 비율 (0~1 사이 값)
 	float SubstepRatio = 1.f / SubStepCount;
@@ -145,17 +159,17 @@ void USFAnimNotifyState_PerformTrace::PerformTrace(USkeletalMeshComponent* MeshC
 
 	if (TraceParams.TraceMethod == ESFTraceMethod::ComponentSweep)
 	{
-		CurrentTraceTransform = CachedWeaponActor->MeshComponent->GetComponentTransform();
-		CurrentDebugTransform = CachedWeaponActor->TraceDebugCollision->GetComponentTransform();
+		CurrentTraceTransform = WeaponActor->MeshComponent->GetComponentTransform();
+		CurrentDebugTransform = WeaponActor->TraceDebugCollision->GetComponentTransform();
 	}
 	else
 	{
-		CurrentTraceTransform = CachedWeaponActor->TraceDebugCollision->GetComponentTransform();
+		CurrentTraceTransform = WeaponActor->TraceDebugCollision->GetComponentTransform();
 		CurrentDebugTransform = CurrentTraceTransform;
 	}
 
 	// 트레이스 박스 크기 계산
-	FVector BoxExtent = GetTraceBoxExtent();
+	FVector BoxExtent = GetTraceBoxExtent(WeaponActor);
 	FCollisionShape CollisionShape = FCollisionShape::MakeBox(BoxExtent);
 
 	// 오브젝트 타입 설정
@@ -170,8 +184,8 @@ void USFAnimNotifyState_PerformTrace::PerformTrace(USkeletalMeshComponent* MeshC
 	for (int32 i = 0; i < SubStepCount; i++)
 	{
 		// 서브스텝의 시작/끝 Transform 계산 (Dual Quaternion 보간으로 부드러운 회전)
-		FTransform StartTraceTransform = UKismetMathLibrary::TLerp(PreviousTraceTransform, CurrentTraceTransform, SubstepRatio * i, ELerpInterpolationMode::DualQuatInterp);
-		FTransform EndTraceTransform = UKismetMathLibrary::TLerp(PreviousTraceTransform, CurrentTraceTransform, SubstepRatio * (i + 1), ELerpInterpolationMode::DualQuatInterp);
+		FTransform StartTraceTransform = UKismetMathLibrary::TLerp(Context.PreviousTraceTransform, CurrentTraceTransform, SubstepRatio * i, ELerpInterpolationMode::DualQuatInterp);
+		FTransform EndTraceTransform = UKismetMathLibrary::TLerp(Context.PreviousTraceTransform, CurrentTraceTransform, SubstepRatio * (i + 1), ELerpInterpolationMode::DualQuatInterp);
 
 		// 평균 Transform (회전에 사용)
 		FTransform AverageTraceTransform = UKismetMathLibrary::TLerp(StartTraceTransform, EndTraceTransform, 0.5f, ELerpInterpolationMode::DualQuatInterp);
@@ -193,12 +207,12 @@ void USFAnimNotifyState_PerformTrace::PerformTrace(USkeletalMeshComponent* MeshC
 			// ComponentSweepMulti 방식
 			FComponentQueryParams Params = FComponentQueryParams::DefaultComponentQueryParams;
 			Params.bReturnPhysicalMaterial = true;
-			TArray<AActor*> IgnoredActors = { CachedWeaponActor.Get(), CachedWeaponActor->GetOwner() };
+			TArray<AActor*> IgnoredActors = { WeaponActor, WeaponActor->GetOwner() };
 			Params.AddIgnoredActors(IgnoredActors);
 
-			MeshComponent->GetWorld()->ComponentSweepMulti(
+			World->ComponentSweepMulti(
 				HitResults,
-				CachedWeaponActor->MeshComponent,
+				WeaponActor->MeshComponent,
 				StartLocation,
 				EndLocation,
 				AverageTraceTransform.GetRotation(),
@@ -210,37 +224,46 @@ void USFAnimNotifyState_PerformTrace::PerformTrace(USkeletalMeshComponent* MeshC
 			// BoxSweep 방식
 			FCollisionQueryParams Params;
 			Params.bReturnPhysicalMaterial = true;
-			Params.AddIgnoredActor(CachedWeaponActor.Get());
-			Params.AddIgnoredActor(CachedWeaponActor->GetOwner());
+			Params.AddIgnoredActor(WeaponActor);
+			Params.AddIgnoredActor(WeaponActor->GetOwner());
 
-			MeshComponent->GetWorld()->SweepMultiByObjectType(
-				HitResults,
-				StartLocation,
-				EndLocation,
-				AverageTraceTransform.GetRotation(),
-				ObjectQueryParams,
-				CollisionShape,
-				Params
-			);
-		}
-
-		for (const FHitResult& HitResult : HitResults)
-		{
-			AActor* HitActor = HitResult.GetActor();
-			if (CachedHitActors.Contains(HitActor) == false)
+			if (bAsync)
 			{
-				CachedHitActors.Add(HitActor);
-				FinalHitResults.Add(HitResult);
+				// 결과는 다음 프레임 CollectAsyncTraces에서 제출 순서대로 수집
+				Context.PendingTraceHandles.Add(World->AsyncSweepByObjectType(
+					EAsyncTraceType::Multi,
+					StartLocation,
+					EndLocation,
+					AverageTraceTransform.GetRotation(),
+					ObjectQueryParams,
+					CollisionShape,
+					Params
+				));
+			}
+			else
+			{
+				World->SweepMultiByObjectType(
+					HitResults,
+					StartLocation,
+					EndLocation,
+					AverageTraceTransform.GetRotation(),
+					ObjectQueryParams,
+					CollisionShape,
+					Params
+				);
 			}
 		}
 
+		AppendNewHits(Context, HitResults, FinalHitResults);
+
 #if UE_EDITOR
 		if (GIsEditor && TraceDebugParams.bDrawDebugShape)
 		{
+			// 비동기 모드는 제출 시점에 결과를 모르므로 TraceColor로 표시
 			FColor Color = (HitResults.Num() > 0) ? TraceDebugParams.HitColor : TraceDebugParams.TraceColor;
 
-			FTransform StartDebugTransform = UKismetMathLibrary::TLerp(PreviousDebugTransform, CurrentDebugTransform, SubstepRatio * i, ELerpInterpolationMode::DualQuatInterp);
-			FTransform EndDebugTransform = UKismetMathLibrary::TLerp(PreviousDebugTransform, CurrentDebugTransform, SubstepRatio * (i + 1), ELerpInterpolationMode::DualQuatInterp);
+			FTransform StartDebugTransform = UKismetMathLibrary::TLerp(Context.PreviousDebugTransform, CurrentDebugTransform, SubstepRatio * i, ELerpInterpolationMode::DualQuatInterp);
+			FTransform EndDebugTransform = UKismetMathLibrary::TLerp(Context.PreviousDebugTransform, CurrentDebugTransform, SubstepRatio * (i + 1), ELerpInterpolationMode::DualQuatInterp);
 			FTransform AverageDebugTransform = UKismetMathLibrary::TLerp(StartDebugTransform, EndDebugTransform, 0.5f, ELerpInterpolationMode::DualQuatInterp);
 
 			FVector StartDebugLocation = StartDebugTransform.GetLocation();
@@ -253,12 +276,12 @@ void USFAnimNotifyState_PerformTrace::PerformTrace(USkeletalMeshComponent* MeshC
 			}
 			
 			DrawDebugSweptBox(
-			   MeshComponent->GetWorld(),
+			   World,
 			   StartDebugLocation,
 			   EndDebugLocation,
 			   AverageDebugTransform.GetRotation().Rotator(),
 			   (TraceParams.TraceMethod == ESFTraceMethod::ComponentSweep)
-				   ? CachedWeaponActor->TraceDebugCollision->GetScaledBoxExtent()
+				   ? WeaponActor->TraceDebugCollision->GetScaledBoxExtent()
 				   : BoxExtent,
 			   Color,
 			   false,
@@ -268,47 +291,100 @@ void USFAnimNotifyState_PerformTrace::PerformTrace(USkeletalMeshComponent* MeshC
 #endif
 	}
 
-	PreviousTraceTransform = CurrentTraceTransform;
-	PreviousDebugTransform = CurrentDebugTransform;
-	PreviousSocketTransform = CurrentSocketTransform;
+	Context.PreviousTraceTransform = CurrentTraceTransform;
+	Context.PreviousDebugTransform = CurrentDebugTransform;
+	Context.PreviousSocketTransform = CurrentSocketTransform;
 	
-	if (FinalHitResults.Num() > 0)
+	SendHitEvent(MeshComponent, WeaponActor, FinalHitResults);
+
+	return SubStepCount;
+}
+
+FVector USFAnimNotifyState_PerformTrace::GetTraceBoxExtent(const ASFEquipmentBase* WeaponActor) const
+{
+	if (!WeaponActor)
+	{
+		return TraceShapeParams.BoxExtent;
+	}
+
+	if (TraceShapeParams.bUseWeaponDefaultExtent)
+	{
+		return WeaponActor->TraceDebugCollision->GetScaledBoxExtent() * TraceShapeParams.ExtentScale;
+	}
+
+	return TraceShapeParams.BoxExtent;
+}
+
+
+
+
+void USFAnimNotifyState_PerformTrace::CollectAsyncTraces(USkeletalMeshComponent* MeshComponent, FSFWeaponTraceContext& Context) const
+{
+	UWorld* World = MeshComponent->GetWorld();
+	if (!World)
 	{
-		// 히트 결과를 TargetDataHandle로 패키징
-		FGameplayAbilityTargetDataHandle TargetDataHandle;
+		Context.PendingTraceHandles.Reset();
+		return;
+	}
+
+	TArray<FHitResult> FinalHitResults;
 
-		for (const FHitResult& HitResult : FinalHitResults)
+	// 제출 순서(서브스텝 순서)대로 처리해야 동기 모드와 같은 히트 순서가 유지됨
+	for (const FTraceHandle& Handle : Context.PendingTraceHandles)
+	{
+		FTraceDatum TraceDatum;
+		if (World->QueryTraceData(Handle, TraceDatum))
 		{
-			// 각 히트 결과를 SingleTargetHit 데이터로 변환
-			FGameplayAbilityTargetData_SingleTargetHit* NewTargetData = new FGameplayAbilityTargetData_SingleTargetHit();
-			NewTargetData->HitResult = HitResult;
-			TargetDataHandle.Add(NewTargetData);
+			AppendNewHits(Context, TraceDatum.OutHits, FinalHitResults);
 		}
+	}
+	Context.PendingTraceHandles.Reset();
 
-		FGameplayEventData EventData;
-		EventData.TargetData = TargetDataHandle; 
-		EventData.Instigator = CachedWeaponActor.Get();    
+	SendHitEvent(MeshComponent, Context.WeaponActor.Get(), FinalHitResults);
+}
 
-		if (EventTag.IsValid())
+void USFAnimNotifyState_PerformTrace::AppendNewHits(FSFWeaponTraceContext& Context, const TArray<FHitResult>& HitResults, TArray<FHitResult>& OutNewHits) const
+{
+	for (const FHitResult& HitResult : HitResults)
+	{
+		AActor* HitActor = HitResult.GetActor();
+		if (Context.HitActors.Contains(HitActor) == false)
 		{
-			UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(MeshComponent->GetOwner(), EventTag, EventData);
+			Context.HitActors.Add(HitActor);
+			OutNewHits.Add(HitResult);
 		}
 	}
 }
 
-FVector USFAnimNotifyState_PerformTrace::GetTraceBoxExtent() const
+void USFAnimNotifyState_PerformTrace::SendHitEvent(USkeletalMeshComponent* MeshComponent, ASFEquipmentBase* WeaponActor, const TArray<FHitResult>& HitResults) const
 {
-	if (!CachedWeaponActor.IsValid())
+	if (HitResults.Num() == 0 || !EventTag.IsValid())
 	{
-		return TraceShapeParams.BoxExtent;
+		return;
 	}
 
-	if (TraceShapeParams.bUseWeaponDefaultExtent)
+	// 히트 결과를 TargetDataHandle로 패키징
+	FGameplayAbilityTargetDataHandle TargetDataHandle;
+
+	for (const FHitResult& HitResult : HitResults)
 	{
-		return CachedWeaponActor->TraceDebugCollision->GetScaledBoxExtent() * TraceShapeParams.ExtentScale;
+		// 각 히트 결과를 SingleTargetHit 데이터로 변환
+		FGameplayAbilityTargetData_SingleTargetHit* NewTargetData = new FGameplayAbilityTargetData_SingleTargetHit();
+		NewTargetData->HitResult = HitResult;
+		TargetDataHandle.Add(NewTargetData);
 	}
 
-	return TraceShapeParams.BoxExtent;
-}
-
+	FGameplayEventData EventData;
+	EventData.TargetData = TargetDataHandle; 
+	EventData.Instigator = WeaponActor;    
 
+	// 배치 처리 도중이므로 서브시스템에 예약 (이벤트가 다른 트레이스의 Begin/End를 일으킬 수 있음)
+	if (USFCombatTraceSubsystem* TraceSubsystem = USFCombatTraceSubsystem::Get(MeshComponent))
+	{
+		TraceSubsystem->QueueHitEvent(MeshComponent->GetOwner(), EventTag, EventData);
+	}
+	else
+	{
+		UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(MeshComponent->GetOwner(), EventTag, EventData);
+	}
+}
\ No newline at end of file
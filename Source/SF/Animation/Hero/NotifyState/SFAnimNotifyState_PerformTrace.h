@@ -8,6 +8,7 @@
 #include "SFAnimNotifyState_PerformTrace.generated.h"
 
 class ASFEquipmentBase;
+struct FSFWeaponTraceContext;
 
 UENUM(BlueprintType)
 enum class ESFTraceMethod : uint8
@@ -92,16 +93,26 @@ class SF_API USFAnimNotifyState_PerformTrace : public UAnimNotifyState
 public:
 	USFAnimNotifyState_PerformTrace(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	// USFCombatTraceSubsystem의 프레임 배치에서 호출. 실행(비동기면 제출)한 스윕 수 반환
+	// MaxSubSteps > 0이면 서브스텝 수를 그 값으로 제한 (프레임 예산)
+	int32 PerformTrace(USkeletalMeshComponent* MeshComponent, FSFWeaponTraceContext& Context, int32 MaxSubSteps = 0) const;
+
+	// 이전 프레임에 제출한 비동기 스윕 결과를 서브스텝 순서대로 수집하여 히트 이벤트 전송
+	void CollectAsyncTraces(USkeletalMeshComponent* MeshComponent, FSFWeaponTraceContext& Context) const;
+
 protected:
 
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
-	virtual void NotifyTick(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
 
-	void PerformTrace(USkeletalMeshComponent* MeshComponent);
-
 private:
-	FVector GetTraceBoxExtent() const;
+	FVector GetTraceBoxExtent(const ASFEquipmentBase* WeaponActor) const;
+
+	// 이번 구간에서 처음 맞은 액터의 히트만 OutNewHits에 추가
+	void AppendNewHits(FSFWeaponTraceContext& Context, const TArray<FHitResult>& HitResults, TArray<FHitResult>& OutNewHits) const;
+
+	// 히트 결과를 TargetData로 묶어 EventTag 게임플레이 이벤트 전송
+	void SendHitEvent(USkeletalMeshComponent* MeshComponent, ASFEquipmentBase* WeaponActor, const TArray<FHitResult>& HitResults) const;
 
 public:
 
@@ -125,21 +136,6 @@ public:
 	UPROPERTY(EditAnywhere)
 	FTraceDebugParams TraceDebugParams;
 
-private:
-
-	// 특정 슬롯에 해당하는 무기 엑터 캐싱
-	UPROPERTY()
-	TWeakObjectPtr<ASFEquipmentBase> CachedWeaponActor;
-
-	UPROPERTY()
-	TSet<TWeakObjectPtr<AActor>> CachedHitActors;
-
-	// 이전 프레임의 무기 메시 Transform 
-	FTransform PreviousTraceTransform;
-
-	// 이전 프레임의 디버그 콜리전 Transform (디버그 시각화용)
-	FTransform PreviousDebugTransform;
-
-	// 이전 프레임의 소켓 Transform (서브스텝 계산용)
-	FTransform PreviousSocketTransform;
+	// 노티파이 객체는 같은 몽타주를 재생하는 모든 메시가 공유하므로
+	// 무기/이전 Transform/히트 목록 등 인스턴스 상태는 USFCombatTraceSubsystem의 FSFWeaponTraceContext에 보관
 };
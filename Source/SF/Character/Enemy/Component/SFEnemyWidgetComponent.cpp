@@ -1,34 +1,17 @@
 #include "SFEnemyWidgetComponent.h"
 
-#include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystem/Attributes/Enemy/SFPrimarySet_Enemy.h"
 #include "Character/SFPawnExtensionComponent.h" // [필수] 헤더 추가
-#include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
-#include "Camera/PlayerCameraManager.h"
 #include "Character/SFCharacterBase.h"
 #include "Character/Enemy/SFEnemyData.h"
 #include "Character/Enemy/SFEnemyGameplayTags.h"
 #include "Components/CapsuleComponent.h"
-#include "UI/Common/CommonBarBase.h"
+#include "System/SFEnemyHealthBarSubsystem.h"
 
 USFEnemyWidgetComponent::USFEnemyWidgetComponent()
 {
-    SetWidgetSpace(EWidgetSpace::World);
-    PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.bStartWithTickEnabled = false; 
-
-    SetDrawSize(FVector2D(100.f, 10.f));
-    SetPivot(FVector2D(0.5f, 0.f));
-    SetTwoSided(true);
-    SetVisibility(false);
-}
-
-void USFEnemyWidgetComponent::InitWidget()
-{
-    Super::InitWidget();
-    EnemyWidget = Cast<UCommonBarBase>(GetUserWidgetObject());
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
 void USFEnemyWidgetComponent::InitializeWidget()
@@ -36,6 +19,10 @@ void USFEnemyWidgetComponent::InitializeWidget()
    
     ASFCharacterBase* OwnerCharacter = Cast<ASFCharacterBase>(GetOwner());
     if (!OwnerCharacter) return;
+
+    // 체력바는 클라이언트 HUD에서만 그림
+    if (OwnerCharacter->GetNetMode() == NM_DedicatedServer) return;
+
     if(USFPawnExtensionComponent* PawnExtComp = USFPawnExtensionComponent::FindPawnExtensionComponent(OwnerCharacter))
     {
         const USFEnemyData* EnemyData = PawnExtComp->GetPawnData<USFEnemyData>();
@@ -45,135 +32,83 @@ void USFEnemyWidgetComponent::InitializeWidget()
         }
     }
     UAbilitySystemComponent* ASC = OwnerCharacter->GetAbilitySystemComponent();
-    if (IsValid(ASC))
+    if (IsValid(ASC) && !HealthChangedHandle.IsValid())
     {
-        const USFPrimarySet_Enemy* PrimarySet = ASC->GetSet<USFPrimarySet_Enemy>();
-        if (IsValid(PrimarySet))
+        const USFPrimarySet_Enemy* EnemyPrimarySet = ASC->GetSet<USFPrimarySet_Enemy>();
+        if (IsValid(EnemyPrimarySet))
         {
-            ASC->GetGameplayAttributeValueChangeDelegate(PrimarySet->GetHealthAttribute())
+            HealthChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(EnemyPrimarySet->GetHealthAttribute())
                .AddUObject(this, &ThisClass::OnHealthChanged);
+            BoundASC = ASC;
+            PrimarySet = EnemyPrimarySet;
         }
     }
-    if (OwnerCharacter && OwnerCharacter->GetCapsuleComponent())
+    if (OwnerCharacter->GetCapsuleComponent())
     {
         float CapsuleHalfHeight = OwnerCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
         SetRelativeLocation(FVector(0.f, 0.f, CapsuleHalfHeight + WidgetVerticalOffset));
     }
-    
-    if (EnemyWidget)
-    {
-        EnemyWidget->SetBarColor(HealthBarColor);
-        EnemyWidget->SetPercentVisuals(1.f);
-        UpdateHealthPercent(); 
-    }
 }
 
-void USFEnemyWidgetComponent::BeginPlay()
+void USFEnemyWidgetComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::BeginPlay();
-    
+    if (UAbilitySystemComponent* ASC = BoundASC.Get())
+    {
+        if (const USFPrimarySet_Enemy* EnemyPrimarySet = PrimarySet.Get())
+        {
+            ASC->GetGameplayAttributeValueChangeDelegate(EnemyPrimarySet->GetHealthAttribute()).Remove(HealthChangedHandle);
+        }
+    }
+    HealthChangedHandle.Reset();
+    BoundASC.Reset();
+    PrimarySet.Reset();
+
+    HideHealthBar();
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void USFEnemyWidgetComponent::OnHealthChanged(const FOnAttributeChangeData& OnAttributeChangeData)
 {
-    UpdateHealthPercent();
-    
     if (OnAttributeChangeData.NewValue <= 0.0f)
     {
-        OnEngagementExpired(); 
+        HideHealthBar(); 
         return;
     }
     
     if (OnAttributeChangeData.OldValue > OnAttributeChangeData.NewValue)
     {
         ShowHealthBar();
-        ResetEngagementTimer();
+    }
+    else if (USFEnemyHealthBarSubsystem* HealthBars = USFEnemyHealthBarSubsystem::Get(this))
+    {
+        // 표시 중인 바만 회복 반영
+        HealthBars->UpdateHealthPercent(this, GetHealthPercent());
     }
 }
 
 void USFEnemyWidgetComponent::ShowHealthBar()
 {
-    SetVisibility(true);
-    CurrentVisibleTime = VisibleDurationAfterHit;
-    SetComponentTickEnabled(true);
-}
-
-void USFEnemyWidgetComponent::OnEngagementExpired()
-{
-    SetVisibility(false);
-    SetComponentTickEnabled(false);
-}
-
-void USFEnemyWidgetComponent::ResetEngagementTimer()
-{
-    if (UWorld* World = GetWorld())
+    if (USFEnemyHealthBarSubsystem* HealthBars = USFEnemyHealthBarSubsystem::Get(this))
     {
-        World->GetTimerManager().ClearTimer(EngagementTimerHandle);
-        World->GetTimerManager().SetTimer(
-            EngagementTimerHandle,
-            this,
-            &ThisClass::OnEngagementExpired,
-            VisibleDurationAfterHit,
-            false
-        );
+        HealthBars->ShowHealthBar(this, GetHealthPercent(), VisibleDurationAfterHit, MaxRenderDistance, HealthBarColor);
     }
 }
 
-void USFEnemyWidgetComponent::UpdateHealthPercent()
+void USFEnemyWidgetComponent::HideHealthBar()
 {
-    if (!EnemyWidget) return;
-
-    UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetOwner());
-    if (IsValid(ASC))
+    if (USFEnemyHealthBarSubsystem* HealthBars = USFEnemyHealthBarSubsystem::Get(this))
     {
-        const USFPrimarySet_Enemy* PrimarySet = ASC->GetSet<USFPrimarySet_Enemy>();
-        if (IsValid(PrimarySet))
-        {
-            float Percent = PrimarySet->GetHealth() / PrimarySet->GetMaxHealth();
-            EnemyWidget->SetPercentVisuals(Percent);
-        }
+        HealthBars->HideHealthBar(this);
     }
 }
 
-void USFEnemyWidgetComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-    
-    FaceToCamera();
-    UpdateVisibility(DeltaTime);
-}
-
-void USFEnemyWidgetComponent::FaceToCamera()
-{
-    APlayerCameraManager* Cam = UGameplayStatics::GetPlayerCameraManager(this, 0);
-    if (!Cam) return;
-
-    FVector Dir = Cam->GetCameraLocation() - GetComponentLocation();
-    FRotator Rot = FRotationMatrix::MakeFromX(Dir).Rotator();
-    Rot.Pitch = 0.f; 
-    SetWorldRotation(Rot);
-}
-
-void USFEnemyWidgetComponent::UpdateVisibility(float DeltaTime)
+float USFEnemyWidgetComponent::GetHealthPercent() const
 {
-    if (CurrentVisibleTime > 0.f)
-    {
-        CurrentVisibleTime -= DeltaTime;
-    }
-    else
+    const USFPrimarySet_Enemy* EnemyPrimarySet = PrimarySet.Get();
+    if (!EnemyPrimarySet || EnemyPrimarySet->GetMaxHealth() <= 0.f)
     {
-        OnEngagementExpired(); 
-        return;
+        return 1.f;
     }
-
-    // 거리 및 각도 체크 
-    APlayerCameraManager* Cam = UGameplayStatics::GetPlayerCameraManager(this, 0);
-    if (!Cam) return;
-
-    float Dist = FVector::Dist(Cam->GetCameraLocation(), GetComponentLocation());
-    if (Dist > MaxRenderDistance)
-    {
-        SetVisibility(false); 
-        return;
-    }
-}
\ No newline at end of file
+    return EnemyPrimarySet->GetHealth() / EnemyPrimarySet->GetMaxHealth();
+}
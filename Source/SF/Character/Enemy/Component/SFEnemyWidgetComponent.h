@@ -1,13 +1,20 @@
 #pragma once
 #include "CoreMinimal.h"
-#include "Components/WidgetComponent.h"
+#include "Components/SceneComponent.h"
 #include "GameplayEffectTypes.h" 
 #include "SFEnemyWidgetComponent.generated.h"
 
-class UCommonBarBase;
+class UAbilitySystemComponent;
+class USFPrimarySet_Enemy;
 
+/**
+ * USFEnemyWidgetComponent
+ * 적 머리 위 체력바 앵커 (위젯/렌더 타깃 없음)
+ * - Health 변경을 받아 피격 시 USFEnemyHealthBarSubsystem에 표시 요청만 전달
+ * - 투영/거리 페이드/그리기는 서브시스템의 HUD 레이어가 모든 적에 대해 한 번에 처리
+ */
 UCLASS()
-class SF_API USFEnemyWidgetComponent : public UWidgetComponent
+class SF_API USFEnemyWidgetComponent : public USceneComponent
 {
 	GENERATED_BODY()
 
@@ -15,30 +22,19 @@ public:
 	USFEnemyWidgetComponent();
 	
 	void InitializeWidget();
-	virtual void BeginPlay() override;
 
-protected:
-	virtual void InitWidget() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	void OnHealthChanged(const FOnAttributeChangeData& OnAttributeChangeData);
     
-	// 빌보드 및 거리 체크
-	void FaceToCamera();
-	void UpdateVisibility(float DeltaTime);
-    
-	// 표시/숨김 관리 (최적화 포함)
+	// 표시/숨김 요청
 	void ShowHealthBar();
-	void OnEngagementExpired(); // 숨기기
-	void ResetEngagementTimer();
+	void HideHealthBar();
 
-	void UpdateHealthPercent();
+	float GetHealthPercent() const;
 
 private:
-	UPROPERTY()
-	TObjectPtr<UCommonBarBase> EnemyWidget;
-
 	// --- 설정 변수 ---
 	UPROPERTY(EditAnywhere, Category = "SF|Widget")
 	float WidgetVerticalOffset = 50.0f;
@@ -52,11 +48,7 @@ private:
 	UPROPERTY(EditAnywhere, Category = "SF|Widget")
 	float MaxRenderDistance = 3000.f;
 
-	UPROPERTY(EditAnywhere, Category = "SF|Widget")
-	float HideOnAngle = 90.f;
-
-   
-	float CurrentVisibleTime = 0.f;
-    
-	FTimerHandle EngagementTimerHandle;
-};
\ No newline at end of file
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	TWeakObjectPtr<const USFPrimarySet_Enemy> PrimarySet;
+	FDelegateHandle HealthChangedHandle;
+};
@@ -431,6 +431,15 @@ void ASFEnemy::CheckBossDeath()
 	}	
 }
 
+FGameplayTag ASFEnemy::GetEnemyType() const
+{
+	if (const USFEnemyData* Data = Cast<USFEnemyData>(EnemyPawnData))
+	{
+		return Data->EnemyType;
+	}
+	return FGameplayTag();
+}
+
 bool ASFEnemy::CanBeLockedOn() const
 {
 	// 1. 기본 유효성 및 생존 확인
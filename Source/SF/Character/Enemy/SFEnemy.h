@@ -58,6 +58,9 @@ public:
 
 	void CheckBossDeath();
 
+	// EnemyData의 타입 태그 (Normal/Elite/Boss). PawnData가 없으면 빈 태그
+	FGameplayTag GetEnemyType() const;
+
 	//Minimap Interface
 	virtual FVector GetMiniMapWorldPosition_Implementation() const override;
 	virtual EMiniMapIconType GetMiniMapIconType_Implementation() const override;
@@ -68,6 +71,8 @@ public:
 protected:
 
 	virtual void OnAbilitySystemInitialized() override;
+	virtual ESFSpatialCategory GetSpatialCategory() const override { return ESFSpatialCategory::Enemy; }
+
 	//PawnData에 있는 AbilitySet GIVE
 	void GrantAbilitiesFromPawnData();
 
@@ -222,6 +222,8 @@ void USFEnemyComponent::InitalizeStateMachineComponent()
 	{
 		CachedStateMachine->ActivateStateByTag(EnemyData->DefaultStateTag);
 	}
+
+	CachedStateMachine->SetTransitions(EnemyData->StateTransitions);
 }
 
 #pragma endregion
@@ -3,6 +3,8 @@
 
 #include "SFEnemyData.h"
 
+#include "AI/StateMachine/State/Boss_Dragon/SFPhaseCondition.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SFEnemyData)
 
 UBehaviorTree* FSFBehaviourWrapperContainer::GetBehaviourTree(const FGameplayTag& Tag) const
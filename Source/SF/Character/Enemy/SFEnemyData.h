@@ -13,6 +13,7 @@ class USF_EffectConfig;
 class USFState;
 class UBehaviorTree;
 struct FSFPhaseData;
+struct FSFStateTransition;
 
 USTRUCT(BlueprintType)
 struct FSFBehaviourWrapper
@@ -96,6 +97,10 @@ public:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy|State")
 	FSTStateWrapperContainer StateContainer;
+
+	// (From, Conditions, To) 전환 테이블. 조건 관련 태그/어트리뷰트 이벤트가 올 때만 평가됨
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy|State")
+	TArray<FSFStateTransition> StateTransitions;
 	
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy|State")
 	FGameplayTag DefaultStateTag;
@@ -4,6 +4,7 @@
 #include "AbilitySystemGlobals.h"
 #include "MotionWarpingComponent.h"
 #include "AbilitySystem/Attributes/Hero/SFPrimarySet_Hero.h"
+#include "Character/SFPawnExtensionComponent.h"
 #include "GameFramework/Character.h"
 #include "Character/Hero/Component/SFLockOnComponent.h"
 
@@ -15,6 +16,99 @@ void USFHeroMovementComponent::BeginPlay()
 	{
 		CachedMotionWarpingComp = Owner->FindComponentByClass<UMotionWarpingComponent>();
 	}
+
+	// 영웅 ASC는 PlayerState에 있어 Possess/OnRep_PlayerState 이후에 초기화됨
+	if (USFPawnExtensionComponent* PawnExtComp = USFPawnExtensionComponent::FindPawnExtensionComponent(GetOwner()))
+	{
+		PawnExtComp->OnAbilitySystemInitialized_RegisterAndCall(
+			FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &ThisClass::OnAbilitySystemInitialized));
+
+		PawnExtComp->OnAbilitySystemUninitialized_Register(
+			FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &ThisClass::OnAbilitySystemUninitialized));
+	}
+	else
+	{
+		BindMoveSpeedAttributes(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner()));
+	}
+}
+
+void USFHeroMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindMoveSpeedAttributes();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USFHeroMovementComponent::OnAbilitySystemInitialized()
+{
+	BindMoveSpeedAttributes(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner()));
+}
+
+void USFHeroMovementComponent::OnAbilitySystemUninitialized()
+{
+	UnbindMoveSpeedAttributes();
+}
+
+void USFHeroMovementComponent::BindMoveSpeedAttributes(UAbilitySystemComponent* ASC)
+{
+	if (MoveSpeedASC.Get() == ASC)
+	{
+		RefreshCachedMoveSpeed();
+		return;
+	}
+
+	UnbindMoveSpeedAttributes();
+
+	if (!ASC || !ASC->GetAttributeSet(USFPrimarySet_Hero::StaticClass()))
+	{
+		return;
+	}
+
+	MoveSpeedASC = ASC;
+
+	// 이펙트 적용/제거, 예측 이펙트, 복제(OnRep) 모두 이 델리게이트를 거치므로 캐시 무효화 지점으로 충분
+	MoveSpeedChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(USFPrimarySet_Hero::GetMoveSpeedAttribute())
+		.AddUObject(this, &ThisClass::HandleMoveSpeedAttributeChanged);
+	MoveSpeedPercentChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(USFPrimarySet_Hero::GetMoveSpeedPercentAttribute())
+		.AddUObject(this, &ThisClass::HandleMoveSpeedAttributeChanged);
+
+	RefreshCachedMoveSpeed();
+}
+
+void USFHeroMovementComponent::UnbindMoveSpeedAttributes()
+{
+	if (UAbilitySystemComponent* ASC = MoveSpeedASC.Get())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(USFPrimarySet_Hero::GetMoveSpeedAttribute()).Remove(MoveSpeedChangedHandle);
+		ASC->GetGameplayAttributeValueChangeDelegate(USFPrimarySet_Hero::GetMoveSpeedPercentAttribute()).Remove(MoveSpeedPercentChangedHandle);
+	}
+
+	MoveSpeedChangedHandle.Reset();
+	MoveSpeedPercentChangedHandle.Reset();
+	MoveSpeedASC.Reset();
+	bHasCachedMoveSpeed = false;
+}
+
+void USFHeroMovementComponent::HandleMoveSpeedAttributeChanged(const FOnAttributeChangeData& ChangeData)
+{
+	RefreshCachedMoveSpeed();
+}
+
+void USFHeroMovementComponent::RefreshCachedMoveSpeed()
+{
+	const UAbilitySystemComponent* ASC = MoveSpeedASC.Get();
+	if (!ASC)
+	{
+		bHasCachedMoveSpeed = false;
+		return;
+	}
+
+	const float MoveSpeed = ASC->GetNumericAttribute(USFPrimarySet_Hero::GetMoveSpeedAttribute());
+	const float MoveSpeedPercent = ASC->GetNumericAttribute(USFPrimarySet_Hero::GetMoveSpeedPercentAttribute());
+
+	// 기본 속도 + 퍼센트 보너스
+	CachedBaseMaxSpeed = FMath::Max(0.f, MoveSpeed + MoveSpeed * (MoveSpeedPercent / 100.f));
+	bHasCachedMoveSpeed = true;
 }
 
 USFHeroMovementComponent::USFHeroMovementComponent(const FObjectInitializer& ObjectInitializer)
@@ -29,53 +123,46 @@ USFHeroMovementComponent::USFHeroMovementComponent(const FObjectInitializer& Obj
 
 float USFHeroMovementComponent::GetMaxSpeed() const
 {
-	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner()))
+	// ASC가 아직 초기화되지 않았거나 해제된 경우
+	if (!bHasCachedMoveSpeed || !MoveSpeedASC.IsValid())
 	{
-		const UAttributeSet* AttributeSet = ASC->GetAttributeSet(USFPrimarySet_Hero::StaticClass());
-		if (const USFPrimarySet_Hero* PrimarySet = Cast<USFPrimarySet_Hero>(AttributeSet))
-		{
-			float MoveSpeed = PrimarySet->GetMoveSpeed();
-			float MoveSpeedPercent = PrimarySet->GetMoveSpeedPercent();
+		return Super::GetMaxSpeed();
+	}
 
-			// 기본 속도 + 퍼센트 보너스
-			float MaxMoveSpeed = FMath::Max(0.f, MoveSpeed + MoveSpeed * (MoveSpeedPercent / 100.f));
-			switch(MovementMode)
-			{
-			case MOVE_Walking:
-			case MOVE_NavWalking:
+	float MaxMoveSpeed = CachedBaseMaxSpeed;
+	switch(MovementMode)
+	{
+	case MOVE_Walking:
+	case MOVE_NavWalking:
+	{
+		float DirectionDot = GetOwner()->GetActorForwardVector().Dot(Velocity.GetSafeNormal());
+		if (DirectionDot < 0.25f)
+		{
+			if (DirectionDot > -0.25f)
 			{
-				float DirectionDot = GetOwner()->GetActorForwardVector().Dot(Velocity.GetSafeNormal());
-				if (DirectionDot < 0.25f)
-				{
-					if (DirectionDot > -0.25f)
-					{
-						MaxMoveSpeed = MaxMoveSpeed * LeftRightMovePercent;
-					}
-					else
-					{
-						MaxMoveSpeed = MaxMoveSpeed * BackwardMovePercent;
-					}
-				}
-
-				MaxMoveSpeed = IsCrouching() ? CrouchMovePercent * MaxMoveSpeed : MaxMoveSpeed;	
-				//GEngine->AddOnScreenDebugMessage(1, 0.1f, FColor::Red, FString::Printf(TEXT("MaxSpeed: %f"), MaxMoveSpeed));
-				return MaxMoveSpeed;
+				MaxMoveSpeed = MaxMoveSpeed * LeftRightMovePercent;
 			}
-			case MOVE_Falling:
-				return MaxMoveSpeed;
-			case MOVE_Swimming:
-				return MaxSwimSpeed;
-			case MOVE_Flying:
-				return MaxFlySpeed;
-			case MOVE_Custom:
-				return MaxCustomMovementSpeed;
-			case MOVE_None:
-			default:
-				return 0.f;
+			else
+			{
+				MaxMoveSpeed = MaxMoveSpeed * BackwardMovePercent;
 			}
 		}
+
+		MaxMoveSpeed = IsCrouching() ? CrouchMovePercent * MaxMoveSpeed : MaxMoveSpeed;	
+		return MaxMoveSpeed;
+	}
+	case MOVE_Falling:
+		return MaxMoveSpeed;
+	case MOVE_Swimming:
+		return MaxSwimSpeed;
+	case MOVE_Flying:
+		return MaxFlySpeed;
+	case MOVE_Custom:
+		return MaxCustomMovementSpeed;
+	case MOVE_None:
+	default:
+		return 0.f;
 	}
-	return Super::GetMaxSpeed();
 }
 
 void USFHeroMovementComponent::SetWarpTarget(const FVector& Location, const FRotator& Rotation)
@@ -5,7 +5,9 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "SFHeroMovementComponent.generated.h"
 
+class UAbilitySystemComponent;
 class UMotionWarpingComponent;
+struct FOnAttributeChangeData;
 
 UENUM(BlueprintType)
 enum class ESFSlidingMode : uint8
@@ -29,6 +31,7 @@ class SF_API USFHeroMovementComponent : public UCharacterMovementComponent
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 public:
 
@@ -46,6 +49,26 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "SF|Movement")
 	float CrouchMovePercent = 0.5f;
 
+private:
+	// ASC 초기화/해제 시 이동 속도 어트리뷰트 변경 델리게이트 등록/해제
+	void OnAbilitySystemInitialized();
+	void OnAbilitySystemUninitialized();
+
+	void BindMoveSpeedAttributes(UAbilitySystemComponent* ASC);
+	void UnbindMoveSpeedAttributes();
+
+	void HandleMoveSpeedAttributeChanged(const FOnAttributeChangeData& ChangeData);
+	void RefreshCachedMoveSpeed();
+
+	// GetMaxSpeed는 이동 틱/리플레이마다 여러 번 호출되므로 ASC 조회 대신 캐시된 값 사용
+	TWeakObjectPtr<UAbilitySystemComponent> MoveSpeedASC;
+	FDelegateHandle MoveSpeedChangedHandle;
+	FDelegateHandle MoveSpeedPercentChangedHandle;
+
+	// MoveSpeed + MoveSpeedPercent 보너스 적용 값 (방향/앉기 보정 전)
+	float CachedBaseMaxSpeed = 0.f;
+	bool bHasCachedMoveSpeed = false;
+
 public:
 
 	// Warp 타겟 설정 (AbilityTask에서 호출) 
@@ -14,6 +14,7 @@
 #include "AbilitySystem/Abilities/SFGameplayAbilityTags.h"
 #include "Character/Enemy/SFEnemy.h"
 #include "Net/UnrealNetwork.h"
+#include "System/SFSpatialHashSubsystem.h"
 
 USFLockOnComponent::USFLockOnComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -340,13 +341,10 @@ void USFLockOnComponent::Server_SwitchTarget_Implementation(const FVector2D& Inp
 
 	// 주변 액터 검색
 	TArray<AActor*> OverlappedActors;
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-	ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
-
-	UKismetSystemLibrary::SphereOverlapActors(
-		this, OwnerPawn->GetActorLocation(), LockOnDistance, ObjectTypes,
-		AActor::StaticClass(), { OwnerPawn }, OverlappedActors
-	);
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->QueryRadius(OwnerPawn->GetActorLocation(), LockOnDistance, FSFSpatialQueryParams(ESFSpatialCategory::Enemy, OwnerPawn), OverlappedActors);
+	}
 
 	for (AActor* Candidate : OverlappedActors)
 	{
@@ -735,13 +733,10 @@ AActor* USFLockOnComponent::FindBestTarget()
 	FVector CameraForward = CameraRot.Vector();
 
 	TArray<AActor*> OverlappedActors;
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-	ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
-
-	UKismetSystemLibrary::SphereOverlapActors(
-		this, OwnerPawn->GetActorLocation(), LockOnDistance, ObjectTypes,
-		AActor::StaticClass(), { OwnerPawn }, OverlappedActors
-	);
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->QueryRadius(OwnerPawn->GetActorLocation(), LockOnDistance, FSFSpatialQueryParams(ESFSpatialCategory::Enemy, OwnerPawn), OverlappedActors);
+	}
 
 	AActor* BestTarget = nullptr;
 	float BestScore = -1.0f;
@@ -46,6 +46,8 @@ protected:
 
 	void OnDownedTagChanged(const FGameplayTag CallbackTag, int32 NewCount);
 
+	virtual ESFSpatialCategory GetSpatialCategory() const override { return ESFSpatialCategory::Hero; }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = "SF|Revive")
 	FSFInteractionInfo ReviveInteractionInfo;
@@ -138,7 +138,21 @@ void ASFCharacterBase::BeginPlay()
 {
 	Super::BeginPlay();
 	RegisterToMiniMap();
-	
+
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->RegisterActor(this, GetSpatialCategory());
+	}
+}
+
+void ASFCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASFCharacterBase::PossessedBy(AController* NewController)
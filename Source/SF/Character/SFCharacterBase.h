@@ -7,6 +7,7 @@
 #include "GameFramework/Character.h"
 #include "MotionWarpingComponent.h"
 #include "Interaction/SFInteractable.h"
+#include "System/SFSpatialHashSubsystem.h"
 #include "SFCharacterBase.generated.h"
 
 class UBoxComponent;
@@ -62,13 +63,16 @@ public:
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
-	
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	virtual void Tick(float DeltaSeconds) override;
 
 	virtual void RegisterToMiniMap();
 	virtual void UnregisterFromMiniMap();
 
+	// 공간 해시 등록 카테고리 (Hero/Enemy 파생 클래스에서 지정)
+	virtual ESFSpatialCategory GetSpatialCategory() const { return ESFSpatialCategory::None; }
+
 protected:
 
 	// 상호작용 감지용 Box (Interaction 채널만 반응) 
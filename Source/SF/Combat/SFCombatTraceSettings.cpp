@@ -0,0 +1 @@
+#include "SFCombatTraceSettings.h"
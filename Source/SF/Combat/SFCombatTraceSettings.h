@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "SFCombatTraceSettings.generated.h"
+
+/**
+ * 근접 공격 트레이스(PerformTrace/SweepTrace) 실행 방식 및 프레임 예산 설정
+ */
+UCLASS(Config=Game, DefaultConfig, meta = (DisplayName = "SF Combat Trace Settings"))
+class SF_API USFCombatTraceSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	// true면 BoxSweep/소켓 체인 스윕을 AsyncSweep으로 제출하고 다음 프레임에 결과를 수집
+	// (ComponentSweep은 비동기 API가 없으므로 항상 동기 실행)
+	UPROPERTY(Config, EditAnywhere, Category = "Trace")
+	bool bUseAsyncTraces = false;
+
+	// 한 프레임에 실행할 수 있는 최대 서브스텝(스윕) 수. 0 이하면 제한 없음
+	// 예산을 넘으면 무기 트레이스는 서브스텝을 줄여(최소 1) 실행하고, 소켓 체인 스윕은 구간 수가 남은 예산에 안 맞으면 다음 프레임으로 미룸 (미뤄진 스윕은 다음 프레임에 먼저 실행)
+	UPROPERTY(Config, EditAnywhere, Category = "Budget", meta = (ClampMin = "0"))
+	int32 MaxTraceSubStepsPerFrame = 0;
+};
@@ -0,0 +1,343 @@
+#include "SFCombatTraceSubsystem.h"
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "Animation/Enemy/NotifyState/SFAnimNotifyState_SweepTrace.h"
+#include "Animation/Hero/NotifyState/SFAnimNotifyState_PerformTrace.h"
+#include "Combat/SFCombatTraceSettings.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFCombatTraceSubsystem)
+
+DECLARE_STATS_GROUP(TEXT("SF Combat Trace"), STATGROUP_SFCombatTrace, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("CombatTrace Batch"), STAT_SFCombatTrace_Batch, STATGROUP_SFCombatTrace);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Trace Contexts"), STAT_SFCombatTrace_ActiveContexts, STATGROUP_SFCombatTrace);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sweeps Per Frame"), STAT_SFCombatTrace_Sweeps, STATGROUP_SFCombatTrace);
+
+FSFTraceInstanceKey::FSFTraceInstanceKey(const USkeletalMeshComponent* InMeshComponent, const FAnimNotifyEventReference& EventReference)
+	: MeshComponent(InMeshComponent)
+	, NotifyEvent(EventReference.GetNotify())
+{
+}
+
+USFCombatTraceSubsystem* USFCombatTraceSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<USFCombatTraceSubsystem>() : nullptr;
+}
+
+void USFCombatTraceSubsystem::Deinitialize()
+{
+	WeaponContexts.Empty();
+	SweepContexts.Empty();
+	PendingHitEvents.Empty();
+
+	Super::Deinitialize();
+}
+
+bool USFCombatTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USFCombatTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USFCombatTraceSubsystem, STATGROUP_Tickables);
+}
+
+FSFWeaponTraceContext* USFCombatTraceSubsystem::BeginWeaponTrace(const USFAnimNotifyState_PerformTrace* Notify, USkeletalMeshComponent* MeshComponent, const FAnimNotifyEventReference& EventReference)
+{
+	if (!Notify || !MeshComponent)
+	{
+		return nullptr;
+	}
+
+	const FSFTraceInstanceKey Key(MeshComponent, EventReference);
+
+	// 같은 프레임에 End → Begin이 이어지면(루프 몽타주 등) 이전 구간의 결과 수집 + 마지막 트레이스를 먼저 동기 처리
+	if (FSFWeaponTraceContext* Existing = WeaponContexts.Find(Key))
+	{
+		CollectWeaponTrace(*Existing);
+		if (Existing->bPendingEnd && !Existing->bFinalSubmitted)
+		{
+			Existing->bUseAsyncTrace = false;
+			ExecuteWeaponTrace(*Existing, 0);
+		}
+		WeaponContexts.Remove(Key);
+	}
+
+	FSFWeaponTraceContext& Context = WeaponContexts.Add(Key);
+	Context.Notify = Notify;
+	Context.MeshComponent = MeshComponent;
+	Context.bUseAsyncTrace = GetDefault<USFCombatTraceSettings>()->bUseAsyncTraces;
+	return &Context;
+}
+
+void USFCombatTraceSubsystem::EndWeaponTrace(USkeletalMeshComponent* MeshComponent, const FAnimNotifyEventReference& EventReference)
+{
+	if (FSFWeaponTraceContext* Context = WeaponContexts.Find(FSFTraceInstanceKey(MeshComponent, EventReference)))
+	{
+		Context->bPendingEnd = true;
+	}
+}
+
+void USFCombatTraceSubsystem::BeginSweepTrace(const USFAnimNotifyState_SweepTrace* Notify, USkeletalMeshComponent* MeshComponent, const FAnimNotifyEventReference& EventReference)
+{
+	if (!Notify || !MeshComponent)
+	{
+		return;
+	}
+
+	const FSFTraceInstanceKey Key(MeshComponent, EventReference);
+
+	// 이전 구간의 비동기 결과가 남아 있으면 먼저 수집
+	if (FSFSweepTraceContext* Existing = SweepContexts.Find(Key))
+	{
+		if (const USFAnimNotifyState_SweepTrace* ExistingNotify = Existing->Notify.Get())
+		{
+			ExistingNotify->CollectAsyncSweeps(MeshComponent, *Existing);
+		}
+	}
+
+	FSFSweepTraceContext& Context = SweepContexts.Add(Key);
+	Context.Notify = Notify;
+	Context.MeshComponent = MeshComponent;
+	Context.TimeSinceLastTrace = 0.f;
+	Context.HitActors.Reset();
+	Context.PendingTraceHandles.Reset();
+	Context.bUseAsyncTrace = GetDefault<USFCombatTraceSettings>()->bUseAsyncTraces;
+	Context.bPendingEnd = false;
+	Context.bDeferredByBudget = false;
+}
+
+void USFCombatTraceSubsystem::EndSweepTrace(USkeletalMeshComponent* MeshComponent, const FAnimNotifyEventReference& EventReference)
+{
+	const FSFTraceInstanceKey Key(MeshComponent, EventReference);
+	if (FSFSweepTraceContext* Context = SweepContexts.Find(Key))
+	{
+		// 제출된 비동기 스윕이 있으면 다음 프레임 수집 후 제거
+		if (Context->PendingTraceHandles.Num() > 0)
+		{
+			Context->bPendingEnd = true;
+		}
+		else
+		{
+			SweepContexts.Remove(Key);
+		}
+	}
+}
+
+int32 USFCombatTraceSubsystem::ExecuteWeaponTrace(FSFWeaponTraceContext& Context, int32 MaxSubSteps)
+{
+	const USFAnimNotifyState_PerformTrace* Notify = Context.Notify.Get();
+	USkeletalMeshComponent* MeshComponent = Context.MeshComponent.Get();
+	if (!Notify || !MeshComponent || !Context.WeaponActor.IsValid())
+	{
+		return 0;
+	}
+
+	return Notify->PerformTrace(MeshComponent, Context, MaxSubSteps);
+}
+
+void USFCombatTraceSubsystem::CollectWeaponTrace(FSFWeaponTraceContext& Context)
+{
+	if (Context.PendingTraceHandles.Num() == 0)
+	{
+		return;
+	}
+
+	const USFAnimNotifyState_PerformTrace* Notify = Context.Notify.Get();
+	USkeletalMeshComponent* MeshComponent = Context.MeshComponent.Get();
+	if (!Notify || !MeshComponent)
+	{
+		Context.PendingTraceHandles.Reset();
+		return;
+	}
+
+	Notify->CollectAsyncTraces(MeshComponent, Context);
+}
+
+void USFCombatTraceSubsystem::QueueHitEvent(AActor* Actor, const FGameplayTag& EventTag, const FGameplayEventData& Payload)
+{
+	FSFPendingTraceEvent& PendingEvent = PendingHitEvents.AddDefaulted_GetRef();
+	PendingEvent.Actor = Actor;
+	PendingEvent.EventTag = EventTag;
+	PendingEvent.Payload = Payload;
+}
+
+void USFCombatTraceSubsystem::FlushHitEvents()
+{
+	if (PendingHitEvents.Num() == 0)
+	{
+		return;
+	}
+
+	// 이벤트 처리 중 새로 예약된 이벤트는 다음 배치에서 전달
+	TArray<FSFPendingTraceEvent> EventsToSend = MoveTemp(PendingHitEvents);
+	PendingHitEvents.Reset();
+
+	for (const FSFPendingTraceEvent& PendingEvent : EventsToSend)
+	{
+		if (AActor* Actor = PendingEvent.Actor.Get())
+		{
+			UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(Actor, PendingEvent.EventTag, PendingEvent.Payload);
+		}
+	}
+}
+
+void USFCombatTraceSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SFCombatTrace_Batch);
+
+	const USFCombatTraceSettings* Settings = GetDefault<USFCombatTraceSettings>();
+	int32 RemainingBudget = Settings->MaxTraceSubStepsPerFrame > 0 ? Settings->MaxTraceSubStepsPerFrame : MAX_int32;
+
+	int32 NumSweeps = 0;
+
+	// 무기 스윕: 애니메이션 업데이트가 끝난 뒤 현재 포즈 기준으로 일괄 처리
+	// 히트 처리(게임플레이 이벤트)가 다른 노티파이의 Begin/End를 일으켜 맵이 바뀔 수 있으므로
+	// 키 스냅샷을 순회하고 노티파이 호출 뒤에는 항상 키로 다시 조회
+	TArray<FSFTraceInstanceKey, TInlineAllocator<16>> TraceKeys;
+	for (const TPair<FSFTraceInstanceKey, FSFWeaponTraceContext>& Pair : WeaponContexts)
+	{
+		TraceKeys.Add(Pair.Key);
+	}
+
+	for (const FSFTraceInstanceKey& Key : TraceKeys)
+	{
+		FSFWeaponTraceContext* Context = WeaponContexts.Find(Key);
+		if (!Context)
+		{
+			continue;
+		}
+
+		// 1) 지난 프레임에 제출한 비동기 스윕 결과를 서브스텝 순서대로 수집
+		CollectWeaponTrace(*Context);
+
+		Context = WeaponContexts.Find(Key);
+		if (!Context)
+		{
+			continue;
+		}
+
+		if (Context->bFinalSubmitted || !Context->Notify.IsValid() || !Context->MeshComponent.IsValid() || !Context->WeaponActor.IsValid())
+		{
+			WeaponContexts.Remove(Key);
+			continue;
+		}
+
+		// 2) 이번 프레임 스윕 실행(동기) 또는 제출(비동기). 예산이 바닥나도 최소 1 서브스텝은 보장
+		const int32 Executed = ExecuteWeaponTrace(*Context, FMath::Max(1, RemainingBudget));
+		RemainingBudget -= Executed;
+		NumSweeps += Executed;
+
+		Context = WeaponContexts.Find(Key);
+		if (Context && Context->bPendingEnd)
+		{
+			if (Context->PendingTraceHandles.Num() > 0)
+			{
+				Context->bFinalSubmitted = true;
+			}
+			else
+			{
+				WeaponContexts.Remove(Key);
+			}
+		}
+	}
+
+	// 소켓 체인 스윕: TraceInterval마다 수행. 지난 프레임에 미뤄진 스윕을 먼저 실행하도록 순서를 나눔
+	// 스윕 히트 이벤트가 다른 노티파이의 Begin/End를 일으켜 맵이 바뀔 수 있으므로 키로 다시 조회
+	TArray<FSFTraceInstanceKey, TInlineAllocator<16>> ReadySweepKeys;
+	int32 NumCarriedOver = 0;
+
+	TraceKeys.Reset();
+	for (const TPair<FSFTraceInstanceKey, FSFSweepTraceContext>& Pair : SweepContexts)
+	{
+		TraceKeys.Add(Pair.Key);
+	}
+
+	for (const FSFTraceInstanceKey& Key : TraceKeys)
+	{
+		FSFSweepTraceContext* Context = SweepContexts.Find(Key);
+		if (!Context)
+		{
+			continue;
+		}
+
+		const USFAnimNotifyState_SweepTrace* Notify = Context->Notify.Get();
+		USkeletalMeshComponent* MeshComponent = Context->MeshComponent.Get();
+		if (!Notify || !MeshComponent)
+		{
+			SweepContexts.Remove(Key);
+			continue;
+		}
+
+		Notify->CollectAsyncSweeps(MeshComponent, *Context);
+
+		Context = SweepContexts.Find(Key);
+		if (!Context)
+		{
+			continue;
+		}
+
+		if (Context->bPendingEnd)
+		{
+			SweepContexts.Remove(Key);
+			continue;
+		}
+
+		Context->TimeSinceLastTrace += DeltaTime;
+		if (Context->TimeSinceLastTrace < Notify->GetTraceInterval())
+		{
+			continue;
+		}
+
+		if (Context->bDeferredByBudget)
+		{
+			ReadySweepKeys.Insert(Key, NumCarriedOver++);
+		}
+		else
+		{
+			ReadySweepKeys.Add(Key);
+		}
+	}
+
+	for (const FSFTraceInstanceKey& Key : ReadySweepKeys)
+	{
+		FSFSweepTraceContext* Context = SweepContexts.Find(Key);
+		const USFAnimNotifyState_SweepTrace* Notify = Context ? Context->Notify.Get() : nullptr;
+		USkeletalMeshComponent* MeshComponent = Context ? Context->MeshComponent.Get() : nullptr;
+		if (!Notify || !MeshComponent || Context->bPendingEnd)
+		{
+			continue;
+		}
+
+		// 체인 하나가 여러 구간을 스윕하므로 구간 수가 남은 예산에 안 맞으면 타이머를 유지한 채 다음 프레임으로 미룸
+		// 미뤄진 스윕은 다음 프레임에 예산과 관계없이 실행 (무한히 밀리지 않도록)
+		if (!Context->bDeferredByBudget && Notify->GetNumSweepSegments() > RemainingBudget)
+		{
+			Context->bDeferredByBudget = true;
+			continue;
+		}
+
+		Context->bDeferredByBudget = false;
+		Context->TimeSinceLastTrace = 0.f;
+		const int32 Executed = Notify->PerformSweep(MeshComponent, *Context);
+		RemainingBudget -= Executed;
+		NumSweeps += Executed;
+	}
+
+	// 두 루프가 끝난 뒤 히트 이벤트 전달 (이 안에서 컨텍스트가 추가/제거되어도 안전)
+	FlushHitEvents();
+
+	SweepsLastFrame = NumSweeps;
+
+	SET_DWORD_STAT(STAT_SFCombatTrace_ActiveContexts, GetNumActiveContexts());
+	SET_DWORD_STAT(STAT_SFCombatTrace_Sweeps, NumSweeps);
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GameplayAbilityTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "SFCombatTraceSubsystem.generated.h"
+
+class ASFEquipmentBase;
+class USkeletalMeshComponent;
+class USFAnimNotifyState_PerformTrace;
+class USFAnimNotifyState_SweepTrace;
+struct FAnimNotifyEvent;
+struct FAnimNotifyEventReference;
+
+/**
+ * 트레이스 컨텍스트 식별 키
+ * 노티파이 UObject는 같은 몽타주를 재생하는 모든 메시가 공유하므로
+ * (메시, 노티파이 이벤트) 쌍으로 인스턴스를 구분한다
+ */
+struct FSFTraceInstanceKey
+{
+	FSFTraceInstanceKey() = default;
+	FSFTraceInstanceKey(const USkeletalMeshComponent* InMeshComponent, const FAnimNotifyEventReference& EventReference);
+
+	TObjectKey<USkeletalMeshComponent> MeshComponent;
+	const FAnimNotifyEvent* NotifyEvent = nullptr;
+
+	bool operator==(const FSFTraceInstanceKey& Other) const
+	{
+		return MeshComponent == Other.MeshComponent && NotifyEvent == Other.NotifyEvent;
+	}
+
+	friend uint32 GetTypeHash(const FSFTraceInstanceKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.MeshComponent), PointerHash(Key.NotifyEvent));
+	}
+};
+
+/**
+ * 무기 스윕(PerformTrace) 인스턴스별 상태
+ */
+struct FSFWeaponTraceContext
+{
+	TWeakObjectPtr<const USFAnimNotifyState_PerformTrace> Notify;
+	TWeakObjectPtr<USkeletalMeshComponent> MeshComponent;
+	TWeakObjectPtr<ASFEquipmentBase> WeaponActor;
+
+	// 이번 노티파이 구간 동안 이미 맞은 액터 (중복 히트 방지)
+	TSet<TWeakObjectPtr<AActor>> HitActors;
+
+	// 이전 프레임의 무기 메시 Transform
+	FTransform PreviousTraceTransform;
+
+	// 이전 프레임의 디버그 콜리전 Transform (디버그 시각화용)
+	FTransform PreviousDebugTransform;
+
+	// 이전 프레임의 소켓 Transform (서브스텝 계산용)
+	FTransform PreviousSocketTransform;
+
+	// 비동기 모드에서 제출한 스윕 핸들 (서브스텝 순서 유지, 다음 프레임에 수집)
+	TArray<FTraceHandle> PendingTraceHandles;
+
+	// Begin 시점의 설정값 (구간 도중 설정이 바뀌어도 일관되게 처리)
+	bool bUseAsyncTrace = false;
+
+	// NotifyEnd가 호출됨 → 다음 배치에서 마지막 트레이스 후 제거
+	bool bPendingEnd = false;
+
+	// 비동기 모드에서 마지막 트레이스까지 제출 완료 → 결과 수집 후 제거
+	bool bFinalSubmitted = false;
+};
+
+/**
+ * 소켓 체인 스윕(SweepTrace) 인스턴스별 상태
+ */
+struct FSFSweepTraceContext
+{
+	TWeakObjectPtr<const USFAnimNotifyState_SweepTrace> Notify;
+	TWeakObjectPtr<USkeletalMeshComponent> MeshComponent;
+
+	// 맞은 액터들
+	TSet<TWeakObjectPtr<AActor>> HitActors;
+
+	// 마지막 Trace 수행 후 경과 시간
+	float TimeSinceLastTrace = 0.f;
+
+	// 비동기 모드에서 제출한 스윕 핸들 (소켓 순서 유지, 다음 프레임에 수집)
+	TArray<FTraceHandle> PendingTraceHandles;
+
+	bool bUseAsyncTrace = false;
+
+	// NotifyEnd가 호출됨 → 남은 비동기 결과 수집 후 제거
+	bool bPendingEnd = false;
+
+	// 지난 프레임에 예산이 모자라 미뤄짐 → 이번 프레임에 예산과 관계없이 먼저 실행
+	bool bDeferredByBudget = false;
+};
+
+/**
+ * 배치 처리 도중 발생한 히트 게임플레이 이벤트
+ * 이벤트 처리가 다른 노티파이의 Begin/End를 일으켜 컨텍스트 맵이 바뀔 수 있으므로 배치가 끝난 뒤 전달
+ */
+struct FSFPendingTraceEvent
+{
+	TWeakObjectPtr<AActor> Actor;
+	FGameplayTag EventTag;
+	FGameplayEventData Payload;
+};
+
+/**
+ * USFCombatTraceSubsystem
+ * 근접 공격 트레이스 노티파이의 인스턴스별 상태를 소유하고,
+ * 한 프레임의 모든 활성 스윕을 애니메이션 업데이트 이후 한 번에 처리하는 월드 서브시스템
+ * - 노티파이는 Begin/End에서 컨텍스트 등록/해제만 수행
+ * - USFCombatTraceSettings::bUseAsyncTraces 사용 시 스윕을 비동기로 제출하고 다음 프레임에 수집
+ * - USFCombatTraceSettings::MaxTraceSubStepsPerFrame으로 프레임당 서브스텝 예산 제한 (소켓 체인은 구간 수만큼 차감)
+ * - 히트 이벤트는 배치가 끝난 뒤 한 번에 전달 (배치 도중 컨텍스트 맵 변경 방지)
+ * - 트레이스 비용은 stat SFCombatTrace 로 프레임 단위 측정
+ */
+UCLASS()
+class SF_API USFCombatTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFCombatTraceSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of UTickableWorldSubsystem interface
+
+	// PerformTrace 노티파이용
+	FSFWeaponTraceContext* BeginWeaponTrace(const USFAnimNotifyState_PerformTrace* Notify, USkeletalMeshComponent* MeshComponent, const FAnimNotifyEventReference& EventReference);
+	void EndWeaponTrace(USkeletalMeshComponent* MeshComponent, const FAnimNotifyEventReference& EventReference);
+
+	// SweepTrace 노티파이용
+	void BeginSweepTrace(const USFAnimNotifyState_SweepTrace* Notify, USkeletalMeshComponent* MeshComponent, const FAnimNotifyEventReference& EventReference);
+	void EndSweepTrace(USkeletalMeshComponent* MeshComponent, const FAnimNotifyEventReference& EventReference);
+
+	// 히트 이벤트 전달 예약. 이번 배치가 끝난 뒤 SendGameplayEventToActor로 전달
+	void QueueHitEvent(AActor* Actor, const FGameplayTag& EventTag, const FGameplayEventData& Payload);
+
+	int32 GetNumActiveContexts() const { return WeaponContexts.Num() + SweepContexts.Num(); }
+	int32 GetSweepsLastFrame() const { return SweepsLastFrame; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 컨텍스트 하나를 실행. 실행(제출)된 스윕 수 반환
+	int32 ExecuteWeaponTrace(FSFWeaponTraceContext& Context, int32 MaxSubSteps);
+
+	// 이전 프레임에 제출한 비동기 스윕 결과 수집
+	void CollectWeaponTrace(FSFWeaponTraceContext& Context);
+
+	// 배치 도중 쌓인 히트 이벤트 전달
+	void FlushHitEvents();
+
+private:
+	TMap<FSFTraceInstanceKey, FSFWeaponTraceContext> WeaponContexts;
+	TMap<FSFTraceInstanceKey, FSFSweepTraceContext> SweepContexts;
+
+	TArray<FSFPendingTraceEvent> PendingHitEvents;
+
+	int32 SweepsLastFrame = 0;
+};
@@ -28,8 +28,11 @@ void USFEquipmentComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ThisClass, EquipmentList);
-	DOREPLIFETIME(ThisClass, bShouldHiddenWeaponActors);
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, EquipmentList, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, bShouldHiddenWeaponActors, SharedParams);
 }
 
 void USFEquipmentComponent::ReadyForReplication()
@@ -159,6 +162,7 @@ void USFEquipmentComponent::EquipItem(USFEquipmentDefinition* EquipmentDefinitio
 	}
 	
 	EquipmentList.MarkItemDirty(NewEntry);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, EquipmentList, this);
 }
 
 void USFEquipmentComponent::UnequipItem(FGameplayTag EquipmentSlotTag)
@@ -323,6 +327,7 @@ void USFEquipmentComponent::UnequipItemByInstance(USFEquipmentInstance* Equipmen
 			
 			EntryIt.RemoveCurrent();
 			EquipmentList.MarkArrayDirty();
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, EquipmentList, this);
 			return;
 		}
 	}
@@ -408,6 +413,7 @@ void USFEquipmentComponent::HideWeapons()
 
 void USFEquipmentComponent::ChangeShouldHiddenWeaponActors(bool bNewShouldHiddenEquipments)
 {
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, bShouldHiddenWeaponActors, this);
 	bShouldHiddenWeaponActors = bNewShouldHiddenEquipments;
 
 	TArray<AActor*> OutWeaponActors;
@@ -1,17 +1,26 @@
 #include "SFEnemyManagerComponent.h"
 
+#include "AbilitySystemComponent.h"
 #include "SFLogChannels.h"
+#include "AbilitySystem/Attributes/SFPrimarySet.h"
+#include "Character/Enemy/SFEnemy.h"
 #include "Net/UnrealNetwork.h"
 
+DECLARE_CYCLE_STAT(TEXT("EnemyRegistry Refresh"), STAT_SFEnemyRegistry_Refresh, STATGROUP_Game);
+
 USFEnemyManagerComponent::USFEnemyManagerComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	// 레지스트리 캐시 갱신용. 서버에서 적이 등록될 때만 활성화
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
 	SetIsReplicatedByDefault(true);
 
 	AliveEnemyCount = 0;
 	TotalEnemyCount = 0;
 
+	bAllEnemiesSpawned = false;
 	bStageCleared = false;
 }
 
@@ -19,8 +28,37 @@ void USFEnemyManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProper
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ThisClass, AliveEnemyCount);
-	DOREPLIFETIME(ThisClass, TotalEnemyCount);
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, AliveEnemyCount, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, TotalEnemyCount, SharedParams);
+}
+
+void USFEnemyManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SCOPE_CYCLE_COUNTER(STAT_SFEnemyRegistry_Refresh);
+
+	// 역순 순회: 사망 처리 없이 파괴된 적은 여기서 정리
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		const ASFEnemy* Enemy = Entries[Index].Enemy.Get();
+		if (!Enemy)
+		{
+			RemoveEntryAt(Index);
+			OnAliveEnemyRemoved();
+			continue;
+		}
+
+		RefreshEntry(Entries[Index], Enemy);
+	}
+
+	if (Entries.Num() == 0)
+	{
+		SetComponentTickEnabled(false);
+	}
 }
 
 void USFEnemyManagerComponent::RegisterEnemy(ASFEnemy* Enemy)
@@ -31,15 +69,29 @@ void USFEnemyManagerComponent::RegisterEnemy(ASFEnemy* Enemy)
 	}
 
 	// 이미 등록된 적인지 확인
-	if (RegisteredEnemies.Contains(Enemy))
+	const TObjectKey<ASFEnemy> Key(Enemy);
+	if (EntryIndexMap.Contains(Key))
 	{
 		return;
 	}
 
-	RegisteredEnemies.Add(Enemy);
-	AliveEnemyCount++;
+	const int32 EntryIndex = Entries.AddDefaulted();
+	FSFEnemyRegistryEntry& Entry = Entries[EntryIndex];
+	Entry.Enemy = Enemy;
+	Entry.Key = Key;
+	Entry.TypeTag = Enemy->GetEnemyType();
+	RefreshEntry(Entry, Enemy);
+
+	EntryIndexMap.Add(Key, EntryIndex);
+	TypeBuckets.FindOrAdd(Entry.TypeTag).Add(EntryIndex);
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, AliveEnemyCount, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, TotalEnemyCount, this);
+	AliveEnemyCount = Entries.Num();
 	TotalEnemyCount++;
 
+	SetComponentTickEnabled(true);
+
 	OnEnemyCountChanged.Broadcast(AliveEnemyCount, TotalEnemyCount);
 }
 
@@ -51,17 +103,14 @@ void USFEnemyManagerComponent::UnregisterEnemy(ASFEnemy* Enemy)
 	}
 
 	// 등록된 적이 아니면 무시
-	if (!RegisteredEnemies.Contains(Enemy))
+	const int32* EntryIndex = EntryIndexMap.Find(TObjectKey<ASFEnemy>(Enemy));
+	if (!EntryIndex)
 	{
 		return;
 	}
 
-	RegisteredEnemies.Remove(Enemy);
-	AliveEnemyCount = FMath::Max(0, AliveEnemyCount - 1);
-
-	OnEnemyCountChanged.Broadcast(AliveEnemyCount, TotalEnemyCount);
-
-	CheckAllEnemiesDefeated();
+	RemoveEntryAt(*EntryIndex);
+	OnAliveEnemyRemoved();
 }
 
 void USFEnemyManagerComponent::NotifyAllEnemiesSpawned()
@@ -76,6 +125,147 @@ void USFEnemyManagerComponent::NotifyAllEnemiesSpawned()
 	CheckAllEnemiesDefeated();
 }
 
+const FSFEnemyRegistryEntry* USFEnemyManagerComponent::FindEntry(const ASFEnemy* Enemy) const
+{
+	const int32* EntryIndex = EntryIndexMap.Find(TObjectKey<ASFEnemy>(Enemy));
+	return EntryIndex ? &Entries[*EntryIndex] : nullptr;
+}
+
+int32 USFEnemyManagerComponent::GetAliveEnemyCountOfType(FGameplayTag TypeTag) const
+{
+	const TArray<int32>* Bucket = TypeBuckets.Find(TypeTag);
+	return Bucket ? Bucket->Num() : 0;
+}
+
+void USFEnemyManagerComponent::GetEnemiesOfType(FGameplayTag TypeTag, TArray<ASFEnemy*>& OutEnemies) const
+{
+	OutEnemies.Reset();
+
+	const TArray<int32>* Bucket = TypeBuckets.Find(TypeTag);
+	if (!Bucket)
+	{
+		return;
+	}
+
+	OutEnemies.Reserve(Bucket->Num());
+	for (const int32 EntryIndex : *Bucket)
+	{
+		if (ASFEnemy* Enemy = Entries[EntryIndex].Enemy.Get())
+		{
+			OutEnemies.Add(Enemy);
+		}
+	}
+}
+
+void USFEnemyManagerComponent::GetEnemiesInRadius(FVector Origin, float Radius, TArray<ASFEnemy*>& OutEnemies, FGameplayTag TypeTag) const
+{
+	OutEnemies.Reset();
+
+	const float RadiusSq = FMath::Square(Radius);
+	auto Visit = [&](const FSFEnemyRegistryEntry& Entry)
+	{
+		if (FVector::DistSquared(Entry.Location, Origin) > RadiusSq)
+		{
+			return;
+		}
+		if (ASFEnemy* Enemy = Entry.Enemy.Get())
+		{
+			OutEnemies.Add(Enemy);
+		}
+	};
+
+	// 타입 지정 시 해당 버킷만 순회
+	if (TypeTag.IsValid())
+	{
+		if (const TArray<int32>* Bucket = TypeBuckets.Find(TypeTag))
+		{
+			for (const int32 EntryIndex : *Bucket)
+			{
+				Visit(Entries[EntryIndex]);
+			}
+		}
+		return;
+	}
+
+	for (const FSFEnemyRegistryEntry& Entry : Entries)
+	{
+		Visit(Entry);
+	}
+}
+
+ASFEnemy* USFEnemyManagerComponent::FindNearestEnemy(FVector Origin, float MaxRadius) const
+{
+	ASFEnemy* NearestEnemy = nullptr;
+	float NearestDistSq = MaxRadius > 0.f ? FMath::Square(MaxRadius) : TNumericLimits<float>::Max();
+
+	for (const FSFEnemyRegistryEntry& Entry : Entries)
+	{
+		const float DistSq = FVector::DistSquared(Entry.Location, Origin);
+		if (DistSq > NearestDistSq)
+		{
+			continue;
+		}
+		if (ASFEnemy* Enemy = Entry.Enemy.Get())
+		{
+			NearestEnemy = Enemy;
+			NearestDistSq = DistSq;
+		}
+	}
+
+	return NearestEnemy;
+}
+
+void USFEnemyManagerComponent::RefreshEntry(FSFEnemyRegistryEntry& Entry, const ASFEnemy* Enemy) const
+{
+	Entry.Location = Enemy->GetActorLocation();
+	Entry.TeamId = Enemy->GetGenericTeamId();
+
+	if (const UAbilitySystemComponent* ASC = Enemy->GetAbilitySystemComponent())
+	{
+		Entry.Health = ASC->GetNumericAttribute(USFPrimarySet::GetHealthAttribute());
+		Entry.MaxHealth = ASC->GetNumericAttribute(USFPrimarySet::GetMaxHealthAttribute());
+	}
+}
+
+void USFEnemyManagerComponent::RemoveEntryAt(int32 EntryIndex)
+{
+	FSFEnemyRegistryEntry& Entry = Entries[EntryIndex];
+
+	EntryIndexMap.Remove(Entry.Key);
+	if (TArray<int32>* Bucket = TypeBuckets.Find(Entry.TypeTag))
+	{
+		Bucket->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+	}
+
+	// 마지막 엔트리가 빈자리로 이동 → 맵/버킷 인덱스 보정
+	const int32 LastIndex = Entries.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		const FSFEnemyRegistryEntry& MovedEntry = Entries[LastIndex];
+		EntryIndexMap.Add(MovedEntry.Key, EntryIndex);
+		if (TArray<int32>* Bucket = TypeBuckets.Find(MovedEntry.TypeTag))
+		{
+			const int32 BucketSlot = Bucket->Find(LastIndex);
+			if (BucketSlot != INDEX_NONE)
+			{
+				(*Bucket)[BucketSlot] = EntryIndex;
+			}
+		}
+	}
+
+	Entries.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+}
+
+void USFEnemyManagerComponent::OnAliveEnemyRemoved()
+{
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, AliveEnemyCount, this);
+	AliveEnemyCount = Entries.Num();
+
+	OnEnemyCountChanged.Broadcast(AliveEnemyCount, TotalEnemyCount);
+
+	CheckAllEnemiesDefeated();
+}
+
 void USFEnemyManagerComponent::CheckAllEnemiesDefeated()
 {
 	// 스폰 완료 전에는 체크하지 않음
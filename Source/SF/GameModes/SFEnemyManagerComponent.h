@@ -3,7 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "GenericTeamAgentInterface.h"
 #include "Components/GameStateComponent.h"
+#include "UObject/ObjectKey.h"
 
 #include "SFEnemyManagerComponent.generated.h"
 
@@ -12,6 +15,27 @@ class ASFEnemy;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAllEnemiesDefeatedDelegate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEnemyCountChangedDelegate, int32, AliveCount, int32, TotalCount);
 
+/**
+ * 레지스트리에 캐시된 적 정보 (프레임당 한 번 갱신)
+ */
+struct FSFEnemyRegistryEntry
+{
+	TWeakObjectPtr<ASFEnemy> Enemy;
+	TObjectKey<ASFEnemy> Key; // 적 파괴 후에도 맵에서 제거할 수 있도록 보관
+	FVector Location = FVector::ZeroVector;
+	FGenericTeamId TeamId = FGenericTeamId::NoTeam;
+	FGameplayTag TypeTag;
+	float Health = 0.f;
+	float MaxHealth = 0.f;
+};
+
+/**
+ * USFEnemyManagerComponent
+ * 살아있는 적의 권한 있는 레지스트리 (서버)
+ * - 밀집 배열에 위치/팀/타입/체력을 캐시하고 틱마다 한 번 갱신
+ * - 타입 태그별 버킷과 반경 쿼리 제공 → 월드 스캔 없이 "근처 적", "살아있는 보스" 조회
+ * - 웨이브 클리어 판정은 카운트만으로 처리
+ */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class SF_API USFEnemyManagerComponent : public UGameStateComponent
 {
@@ -21,6 +45,7 @@ public:
 	USFEnemyManagerComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	UFUNCTION(BlueprintCallable, Category = "SF|Enemy")
 	void RegisterEnemy(ASFEnemy* Enemy);
@@ -37,6 +62,29 @@ public:
 	UFUNCTION(BlueprintPure, Category = "SF|Enemy")
 	int32 GetTotalEnemyCount() const { return TotalEnemyCount; }
 
+	// ========== 레지스트리 쿼리 (서버) ==========
+
+	// 살아있는 적 전체 (캐시 값은 마지막 틱 기준)
+	const TArray<FSFEnemyRegistryEntry>& GetAliveEnemies() const { return Entries; }
+
+	// 등록된 적의 캐시 엔트리. 없으면 nullptr
+	const FSFEnemyRegistryEntry* FindEntry(const ASFEnemy* Enemy) const;
+
+	// 타입 태그(정확히 일치)별 살아있는 적 수
+	UFUNCTION(BlueprintPure, Category = "SF|Enemy")
+	int32 GetAliveEnemyCountOfType(FGameplayTag TypeTag) const;
+
+	UFUNCTION(BlueprintCallable, Category = "SF|Enemy")
+	void GetEnemiesOfType(FGameplayTag TypeTag, TArray<ASFEnemy*>& OutEnemies) const;
+
+	// 캐시된 위치 기준 반경 검색. TypeTag가 유효하면 해당 타입만
+	UFUNCTION(BlueprintCallable, Category = "SF|Enemy")
+	void GetEnemiesInRadius(FVector Origin, float Radius, TArray<ASFEnemy*>& OutEnemies, FGameplayTag TypeTag = FGameplayTag()) const;
+
+	// 캐시된 위치 기준 가장 가까운 적 (MaxRadius <= 0이면 거리 제한 없음)
+	UFUNCTION(BlueprintCallable, Category = "SF|Enemy")
+	ASFEnemy* FindNearestEnemy(FVector Origin, float MaxRadius = 0.f) const;
+
 protected:
 	void CheckAllEnemiesDefeated();
 
@@ -46,6 +94,14 @@ protected:
 	UFUNCTION()
 	void OnRep_TotalEnemyCount();
 
+private:
+	void RefreshEntry(FSFEnemyRegistryEntry& Entry, const ASFEnemy* Enemy) const;
+
+	// 밀집 배열에서 제거 (마지막 엔트리를 빈자리로 이동하고 버킷 인덱스 보정)
+	void RemoveEntryAt(int32 EntryIndex);
+
+	void OnAliveEnemyRemoved();
+
 public:
 	
 	// 모든 적 처치 시 브로드캐스트 
@@ -57,9 +113,12 @@ public:
 	FOnEnemyCountChangedDelegate OnEnemyCountChanged;
 
 private:
-	// 현재 등록된 적들 (서버만 관리)
-	UPROPERTY()
-	TSet<TObjectPtr<ASFEnemy>> RegisteredEnemies;
+	// 현재 등록된 적들 (서버만 관리). 밀집 배열 + 적 → 인덱스
+	TArray<FSFEnemyRegistryEntry> Entries;
+	TMap<TObjectKey<ASFEnemy>, int32> EntryIndexMap;
+
+	// 타입 태그 → Entries 인덱스 목록
+	TMap<FGameplayTag, TArray<int32>> TypeBuckets;
 
 	// 살아있는 적 수 (추후 필요시 UI 표시용) 
 	UPROPERTY(ReplicatedUsing = OnRep_AliveEnemyCount)
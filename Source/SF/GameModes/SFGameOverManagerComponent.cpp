@@ -24,10 +24,13 @@ void USFGameOverManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimePro
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	
-	DOREPLIFETIME(ThisClass, bGameOver);
-	DOREPLIFETIME(ThisClass, GameClearMessage);
-	DOREPLIFETIME(ThisClass, GameOverResult);
-	DOREPLIFETIME(ThisClass, ReadyCount);
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, bGameOver, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, GameClearMessage, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, GameOverResult, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReadyCount, SharedParams);
 }
 
 void USFGameOverManagerComponent::BeginPlay()
@@ -185,6 +188,7 @@ void USFGameOverManagerComponent::TriggerGameOver()
 		return;
 	}
 
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, bGameOver, this);
 	bGameOver = true;
 
 	// Listen Server 로컬 처리
@@ -211,6 +215,7 @@ void USFGameOverManagerComponent::CollectAndBroadcastStats()
 	if (const AGameStateBase* GS = GetGameStateChecked<AGameStateBase>())
 	{
 		float CurrentServerTime = GS->GetServerWorldTimeSeconds();
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, GameOverResult, this);
 		GameOverResult.TargetLobbyTime = CurrentServerTime + LobbyTransitionDelay;
 	}
 
@@ -231,6 +236,7 @@ void USFGameOverManagerComponent::CollectAllPlayerStats()
 		return;;
 	}
 
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, GameOverResult, this);
 	GameOverResult = FSFGameOverResult();
 	
 	if (USFStageManagerComponent* StageManager = GameState->FindComponentByClass<USFStageManagerComponent>())
@@ -340,6 +346,7 @@ void USFGameOverManagerComponent::NotifyPlayerReadyForLobby(APlayerController* P
 	CleanupInvalidReadyPlayers();
 
 	ReadyPlayers.Add(PC);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReadyCount, this);
 	ReadyCount = ReadyPlayers.Num();
 
 	// Listen Server 로컬 처리
@@ -397,6 +404,7 @@ void USFGameOverManagerComponent::TriggerGameClear()
 		return;
 	}
 
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, GameClearMessage, this);
 	GameClearMessage.bGameClear = true;
 	if (const AGameStateBase* GS = GetGameStateChecked<AGameStateBase>())
 	{
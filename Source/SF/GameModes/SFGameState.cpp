@@ -2,6 +2,7 @@
 
 #include "SFEnemyManagerComponent.h"
 #include "SFGameOverManagerComponent.h"
+#include "SFPickupManagerComponent.h"
 #include "SFPortalManagerComponent.h"
 #include "SFStageManagerComponent.h"
 
@@ -11,6 +12,7 @@ ASFGameState::ASFGameState()
 	EnemyManager = CreateDefaultSubobject<USFEnemyManagerComponent>(TEXT("EnemyManager"));
 	StageManager = CreateDefaultSubobject<USFStageManagerComponent>(TEXT("StageManager"));
 	GameOverManager = CreateDefaultSubobject<USFGameOverManagerComponent>(TEXT("GameOverManager"));
+	PickupManager = CreateDefaultSubobject<USFPickupManagerComponent>(TEXT("PickupManager"));
 }
 
 void ASFGameState::AddPlayerState(APlayerState* PlayerState)
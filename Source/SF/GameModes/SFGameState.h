@@ -10,6 +10,7 @@ class USFPortalManagerComponent;
 class USFEnemyManagerComponent;
 class USFStageManagerComponent;
 class USFGameOverManagerComponent;
+class USFPickupManagerComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerStateChangedDelegate, APlayerState*, PlayerState);
 
@@ -38,6 +39,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "SF|GameState")
 	USFGameOverManagerComponent* GetGameOverManager() const { return GameOverManager; }
 
+	UFUNCTION(BlueprintPure, Category = "SF|GameState")
+	USFPickupManagerComponent* GetPickupManager() const { return PickupManager; }
+
 	UFUNCTION(BlueprintPure, Category = "SF|GameState")
 	bool IsGameOver() const;
 	
@@ -70,4 +74,7 @@ private:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SF|Components", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<USFGameOverManagerComponent> GameOverManager;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SF|Components", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<USFPickupManagerComponent> PickupManager;
 };
@@ -0,0 +1,684 @@
+#include "SFPickupManagerComponent.h"
+
+#include "NiagaraFunctionLibrary.h"
+#include "SFGameState.h"
+#include "Actors/SFAutoPickup.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Item/SFItemData.h"
+#include "Item/SFItemDefinition.h"
+#include "Item/SFItemInstance.h"
+#include "Item/Fragments/SFItemFragment_AutoPickup.h"
+#include "Net/UnrealNetwork.h"
+#include "Player/SFPlayerState.h"
+
+DECLARE_CYCLE_STAT(TEXT("PickupManager Tick"), STAT_SFPickupManager_Tick, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Simulated Pickups"), STAT_SFPickupManager_NumPickups, STATGROUP_Game);
+
+namespace SFPickupManager
+{
+	// 늦게 받은 묶음의 낙하를 미리 진행할 때의 스텝/상한 (초)
+	static constexpr float FastForwardStep = 1.f / 30.f;
+	static constexpr float MaxFastForwardTime = 5.f;
+
+	static bool IsCollected(TConstArrayView<uint32> CollectedMask, int32 Offset)
+	{
+		const int32 WordIndex = Offset / 32;
+		return CollectedMask.IsValidIndex(WordIndex) && (CollectedMask[WordIndex] & (1u << (Offset % 32))) != 0;
+	}
+}
+
+void FSFPickupBatchList::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (const int32 Index : RemovedIndices)
+	{
+		OwnerComponent->OnBatchRemoved(Entries[Index]);
+	}
+}
+
+void FSFPickupBatchList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (const int32 Index : AddedIndices)
+	{
+		OwnerComponent->OnBatchAdded(Entries[Index]);
+	}
+}
+
+void FSFPickupBatchList::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent)
+	{
+		return;
+	}
+
+	for (const int32 Index : ChangedIndices)
+	{
+		OwnerComponent->OnBatchChanged(Entries[Index]);
+	}
+}
+
+USFPickupManagerComponent::USFPickupManagerComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Batches(this)
+{
+	// 픽업이 있을 때만 틱 (서버/클라이언트 모두 시뮬레이션)
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+	SetIsReplicatedByDefault(true);
+}
+
+USFPickupManagerComponent* USFPickupManagerComponent::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const ASFGameState* GameState = World ? World->GetGameState<ASFGameState>() : nullptr;
+	return GameState ? GameState->GetPickupManager() : nullptr;
+}
+
+void USFPickupManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, Batches, SharedParams);
+}
+
+bool USFPickupManagerComponent::CanSimulate(const USFItemFragment_AutoPickup* Fragment)
+{
+	return Fragment && Fragment->bSimulateInPickupManager && Fragment->PickupMesh;
+}
+
+void USFPickupManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SCOPE_CYCLE_COUNTER(STAT_SFPickupManager_Tick);
+
+	GatherHeroes();
+	Simulate(DeltaTime);
+
+	// 이번 프레임 수집분 연출은 한 번의 RPC로 전송
+	if (PendingCollectedIds.Num() > 0)
+	{
+		Multicast_PickupsCollected(PendingCollectedIds);
+		PendingCollectedIds.Reset();
+	}
+
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		UpdateMeshInstances();
+	}
+
+	SET_DWORD_STAT(STAT_SFPickupManager_NumPickups, Pickups.Num());
+
+	UpdateTickEnabled();
+}
+
+void USFPickupManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 렌더 액터와 함께 InstancedStaticMesh도 제거됨
+	if (RenderActor)
+	{
+		RenderActor->Destroy();
+		RenderActor = nullptr;
+	}
+
+	Kinds.Reset();
+	Batches.Entries.Reset();
+	Pickups.Reset();
+	PickupIndexById.Reset();
+	PendingCollectedIds.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USFPickupManagerComponent::SpawnPickups(const USFItemInstance* ItemInstance, int32 AmountPerPickup, int32 Count, const FVector& Location, float SpawnRadius)
+{
+	if (!GetOwner()->HasAuthority() || !ItemInstance || Count <= 0)
+	{
+		return;
+	}
+
+	FSFPickupSpawnBatch Batch;
+	Batch.Origin = Location;
+	Batch.ItemId = ItemInstance->GetItemID();
+	Batch.AmountPerPickup = FMath::Max(1, AmountPerPickup);
+	Batch.SpawnRadius = SpawnRadius;
+	Batch.SpawnTime = GetWorld()->GetTimeSeconds();
+
+	// 묶음이 픽업 없이 복제 상태에 남지 않도록 먼저 확인
+	if (FindOrAddKind(Batch.ItemId) == INDEX_NONE)
+	{
+		return;
+	}
+
+	while (Count > 0)
+	{
+		Batch.Count = static_cast<uint16>(FMath::Min(Count, static_cast<int32>(MAX_uint16)));
+		Batch.Seed = FMath::Rand();
+		Batch.FirstId = NextPickupId;
+		NextPickupId += Batch.Count;
+		Count -= Batch.Count;
+
+		FSFPickupBatchEntry& BatchEntry = Batches.Entries.AddDefaulted_GetRef();
+		BatchEntry.Batch = Batch;
+		BatchEntry.CollectedMask.Init(0, FMath::DivideAndRoundUp(static_cast<int32>(Batch.Count), 32));
+		BatchEntry.NumRemaining = Batch.Count;
+		Batches.MarkItemDirty(BatchEntry);
+
+		AddBatch(Batch, {}, 0.f);
+	}
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, Batches, this);
+	GetOwner()->ForceNetUpdate();
+
+	UpdateTickEnabled();
+}
+
+void USFPickupManagerComponent::Multicast_PickupsCollected_Implementation(const TArray<uint32>& PickupIds)
+{
+	// 서버는 수집 시점에 이미 제거했으므로 클라이언트에서만 찾아짐 (Batches 복제가 먼저 왔으면 이미 제거됨)
+	for (const uint32 PickupId : PickupIds)
+	{
+		RemoveCollectedPickup(PickupId);
+	}
+
+	UpdateTickEnabled();
+}
+
+void USFPickupManagerComponent::RemoveCollectedPickup(uint32 PickupId)
+{
+	const int32* Index = PickupIndexById.Find(PickupId);
+	if (!Index)
+	{
+		return;
+	}
+
+	const FPickupEntry& Entry = Pickups[*Index];
+	if (const USFItemFragment_AutoPickup* Fragment = Kinds[Entry.KindIndex].Fragment)
+	{
+		if (Fragment->CollectEffect)
+		{
+			UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, Fragment->CollectEffect, Entry.Location);
+		}
+	}
+
+	RemovePickupAt(*Index);
+}
+
+void USFPickupManagerComponent::OnBatchAdded(const FSFPickupBatchEntry& BatchEntry)
+{
+	// 늦게 접속한 클라이언트는 스폰 후 지난 시간만큼 낙하를 미리 진행
+	const AGameStateBase* GameState = GetGameStateChecked<AGameStateBase>();
+	const float ElapsedTime = FMath::Max(0.f, static_cast<float>(GameState->GetServerWorldTimeSeconds()) - BatchEntry.Batch.SpawnTime);
+
+	AddBatch(BatchEntry.Batch, BatchEntry.CollectedMask, ElapsedTime);
+	UpdateTickEnabled();
+}
+
+void USFPickupManagerComponent::OnBatchChanged(const FSFPickupBatchEntry& BatchEntry)
+{
+	const FSFPickupSpawnBatch& Batch = BatchEntry.Batch;
+	for (int32 Offset = 0; Offset < Batch.Count; ++Offset)
+	{
+		if (SFPickupManager::IsCollected(BatchEntry.CollectedMask, Offset))
+		{
+			RemoveCollectedPickup(Batch.FirstId + Offset);
+		}
+	}
+
+	UpdateTickEnabled();
+}
+
+void USFPickupManagerComponent::OnBatchRemoved(const FSFPickupBatchEntry& BatchEntry)
+{
+	// 마지막 수집분이 묶음 제거로만 전달될 수 있으므로 남은 픽업을 모두 수집 처리
+	const FSFPickupSpawnBatch& Batch = BatchEntry.Batch;
+	for (int32 Offset = 0; Offset < Batch.Count; ++Offset)
+	{
+		RemoveCollectedPickup(Batch.FirstId + Offset);
+	}
+
+	UpdateTickEnabled();
+}
+
+int32 USFPickupManagerComponent::FindOrAddKind(int32 ItemId)
+{
+	for (int32 KindIndex = 0; KindIndex < Kinds.Num(); ++KindIndex)
+	{
+		if (Kinds[KindIndex].ItemId == ItemId)
+		{
+			return KindIndex;
+		}
+	}
+
+	const USFItemDefinition* ItemDef = USFItemData::Get().FindDefinitionById(ItemId);
+	const USFItemFragment_AutoPickup* Fragment = ItemDef ? ItemDef->FindFragment<USFItemFragment_AutoPickup>() : nullptr;
+	if (!Fragment)
+	{
+		return INDEX_NONE;
+	}
+
+	FSFPickupKind& Kind = Kinds.AddDefaulted_GetRef();
+	Kind.ItemId = ItemId;
+	Kind.Fragment = Fragment;
+	Kind.EffectClass = Fragment->PickupActorClass ? Fragment->PickupActorClass : TSubclassOf<ASFAutoPickup>(ASFAutoPickup::StaticClass());
+
+	AActor* MeshOwner = GetNetMode() != NM_DedicatedServer && Fragment->PickupMesh ? GetOrCreateRenderActor() : nullptr;
+	if (MeshOwner)
+	{
+		UInstancedStaticMeshComponent* MeshInstances = NewObject<UInstancedStaticMeshComponent>(MeshOwner, NAME_None, RF_Transient);
+		MeshInstances->SetupAttachment(MeshOwner->GetRootComponent());
+		MeshInstances->SetStaticMesh(Fragment->PickupMesh);
+		MeshInstances->SetMobility(EComponentMobility::Movable);
+		MeshInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		MeshInstances->SetCanEverAffectNavigation(false);
+		MeshInstances->RegisterComponent();
+		MeshOwner->AddInstanceComponent(MeshInstances);
+		Kind.MeshInstances = MeshInstances;
+	}
+
+	return Kinds.Num() - 1;
+}
+
+void USFPickupManagerComponent::AddBatch(const FSFPickupSpawnBatch& Batch, TConstArrayView<uint32> CollectedMask, float ElapsedTime)
+{
+	const int32 KindIndex = FindOrAddKind(Batch.ItemId);
+	if (KindIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	float LaunchSpeed = DropInitialSpeed;
+	float LaunchAngle = DropInitialAngle;
+	if (const ASFAutoPickup* PickupCDO = Kinds[KindIndex].EffectClass ? Kinds[KindIndex].EffectClass->GetDefaultObject<ASFAutoPickup>() : nullptr)
+	{
+		LaunchSpeed = PickupCDO->GetDropInitialSpeed();
+		LaunchAngle = PickupCDO->GetDropInitialAngle();
+	}
+
+	UWorld* World = GetWorld();
+	const FCollisionObjectQueryParams FloorQuery(ECC_WorldStatic);
+	const float GravityZ = World ? World->GetGravityZ() : 0.f;
+	const float FastForwardTime = FMath::Min(ElapsedTime, SFPickupManager::MaxFastForwardTime);
+
+	// 서버/클라이언트가 같은 순서로 난수를 뽑아 동일한 초기 상태 생성
+	FRandomStream Random(Batch.Seed);
+	Pickups.Reserve(Pickups.Num() + Batch.Count);
+
+	for (int32 i = 0; i < Batch.Count; ++i)
+	{
+		const float OffsetAngle = Random.FRandRange(0.f, UE_TWO_PI);
+		const float OffsetDistance = Batch.SpawnRadius * FMath::Sqrt(Random.FRand());
+		const float LaunchYaw = Random.FRandRange(0.f, 360.f);
+
+		// 이미 수집된 픽업도 난수는 같은 순서로 소비
+		if (SFPickupManager::IsCollected(CollectedMask, i))
+		{
+			continue;
+		}
+
+		FPickupEntry& Entry = Pickups.AddDefaulted_GetRef();
+		Entry.Id = Batch.FirstId + i;
+		Entry.KindIndex = KindIndex;
+		Entry.Amount = Batch.AmountPerPickup;
+		Entry.Location = FVector(Batch.Origin) + FVector(FMath::Cos(OffsetAngle) * OffsetDistance, FMath::Sin(OffsetAngle) * OffsetDistance, 0.f);
+		Entry.Velocity = FRotator(-(90.f - LaunchAngle), LaunchYaw, 0.f).Vector() * LaunchSpeed;
+
+		// 바닥 높이는 스폰 시 한 번만 구함 (이후 시뮬레이션은 충돌 검사 없음)
+		FHitResult FloorHit;
+		const FVector TraceStart = Entry.Location + FVector(0.f, 0.f, FloorTraceUp);
+		const FVector TraceEnd = Entry.Location - FVector(0.f, 0.f, FloorTraceDown);
+		Entry.FloorZ = World && World->LineTraceSingleByObjectType(FloorHit, TraceStart, TraceEnd, FloorQuery)
+			? FloorHit.ImpactPoint.Z + FloorOffset
+			: Entry.Location.Z;
+
+		// 낙하는 영웅과 무관하므로 고정 스텝으로 근사 (유도 중이던 픽업은 바닥에서 다시 판정)
+		Entry.Age = ElapsedTime;
+		for (float Remaining = FastForwardTime; Remaining > 0.f && Entry.Phase == EPickupPhase::Falling; Remaining -= SFPickupManager::FastForwardStep)
+		{
+			SimulateFalling(Entry, GravityZ, FMath::Min(Remaining, SFPickupManager::FastForwardStep));
+		}
+
+		PickupIndexById.Add(Entry.Id, Pickups.Num() - 1);
+	}
+}
+
+void USFPickupManagerComponent::RemovePickupAt(int32 Index)
+{
+	PickupIndexById.Remove(Pickups[Index].Id);
+
+	const int32 LastIndex = Pickups.Num() - 1;
+	if (Index != LastIndex)
+	{
+		PickupIndexById.Add(Pickups[LastIndex].Id, Index);
+	}
+
+	Pickups.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void USFPickupManagerComponent::GatherHeroes()
+{
+	Heroes.Reset();
+
+	const AGameStateBase* GameState = GetGameStateChecked<AGameStateBase>();
+	for (const APlayerState* PS : GameState->PlayerArray)
+	{
+		if (APawn* Pawn = PS ? PS->GetPawn() : nullptr)
+		{
+			FHeroSample& Hero = Heroes.AddDefaulted_GetRef();
+			Hero.Pawn = Pawn;
+			Hero.Location = Pawn->GetActorLocation();
+			Hero.Radius = Pawn->GetSimpleCollisionRadius();
+		}
+	}
+}
+
+void USFPickupManagerComponent::Simulate(float DeltaTime)
+{
+	const float GravityZ = GetWorld()->GetGravityZ();
+	const bool bAuthority = GetOwner()->HasAuthority();
+
+	// 역순 순회: 수집 시 RemoveAtSwap으로 당겨오는 원소는 이미 처리됨
+	for (int32 Index = Pickups.Num() - 1; Index >= 0; --Index)
+	{
+		FPickupEntry& Entry = Pickups[Index];
+		if (Entry.Phase == EPickupPhase::Collected)
+		{
+			// 서버가 확정하지 않으면(서버 판정 불일치) 다시 보이게 하고 제자리에서 낙하
+			Entry.CollectedTime += DeltaTime;
+			if (Entry.CollectedTime >= CollectConfirmTimeout)
+			{
+				Entry.Phase = EPickupPhase::Falling;
+				Entry.HomingTarget.Reset();
+				Entry.Velocity = FVector::ZeroVector;
+			}
+			continue;
+		}
+
+		const USFItemFragment_AutoPickup* Fragment = Kinds[Entry.KindIndex].Fragment;
+		Entry.Age += DeltaTime;
+
+		// 거리 패스: 활성화 딜레이 이후 가장 가까운 영웅 하나로 수집/유도 판정
+		if (Fragment && Entry.Age >= Fragment->InitialDelay)
+		{
+			const FHeroSample* Nearest = nullptr;
+			float NearestDistSq = MAX_flt;
+			for (const FHeroSample& Hero : Heroes)
+			{
+				const float DistSq = FVector::DistSquared(Entry.Location, Hero.Location);
+				if (DistSq < NearestDistSq)
+				{
+					NearestDistSq = DistSq;
+					Nearest = &Hero;
+				}
+			}
+
+			if (Nearest)
+			{
+				if (NearestDistSq <= FMath::Square(Fragment->CollectionRadius + Nearest->Radius))
+				{
+					if (bAuthority)
+					{
+						Collect(Entry, Nearest->Pawn.Get());
+						RemovePickupAt(Index);
+					}
+					else
+					{
+						// 서버 확정 전까지 숨김만
+						Entry.Phase = EPickupPhase::Collected;
+						Entry.CollectedTime = 0.f;
+					}
+					continue;
+				}
+
+				if (Entry.Phase != EPickupPhase::Homing && NearestDistSq <= FMath::Square(Fragment->DetectionRadius))
+				{
+					Entry.Phase = EPickupPhase::Homing;
+					Entry.HomingTarget = Nearest->Pawn;
+					Entry.HomingSpeed = 0.f;
+					Entry.Velocity = FVector::ZeroVector;
+				}
+			}
+		}
+
+		switch (Entry.Phase)
+		{
+		case EPickupPhase::Falling:
+			SimulateFalling(Entry, GravityZ, DeltaTime);
+			break;
+
+		case EPickupPhase::Homing:
+			{
+				const APawn* Target = Entry.HomingTarget.Get();
+				if (!Target || !Fragment)
+				{
+					// 타겟을 잃으면 제자리에서 다시 낙하
+					Entry.HomingTarget.Reset();
+					Entry.Phase = EPickupPhase::Falling;
+					break;
+				}
+
+				Entry.HomingSpeed = FMath::Min(Entry.HomingSpeed + Fragment->HomingAcceleration * DeltaTime, Fragment->HomingSpeed);
+
+				const FVector ToTarget = Target->GetActorLocation() - Entry.Location;
+				const float Distance = ToTarget.Size();
+				if (Distance > UE_KINDA_SMALL_NUMBER)
+				{
+					Entry.Location += ToTarget * (FMath::Min(Entry.HomingSpeed * DeltaTime, Distance) / Distance);
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+void USFPickupManagerComponent::SimulateFalling(FPickupEntry& Entry, float GravityZ, float DeltaTime) const
+{
+	Entry.Velocity.Z += GravityZ * DeltaTime;
+	Entry.Location += Entry.Velocity * DeltaTime;
+
+	if (Entry.Location.Z <= Entry.FloorZ)
+	{
+		Entry.Location.Z = Entry.FloorZ;
+
+		const float ImpactSpeed = -Entry.Velocity.Z;
+		if (ImpactSpeed < BounceStopThreshold)
+		{
+			Entry.Velocity = FVector::ZeroVector;
+			Entry.Phase = EPickupPhase::Settled;
+		}
+		else
+		{
+			Entry.Velocity.Z = ImpactSpeed * Bounciness;
+			Entry.Velocity.X *= 1.f - Friction;
+			Entry.Velocity.Y *= 1.f - Friction;
+		}
+	}
+}
+
+void USFPickupManagerComponent::Collect(FPickupEntry& Entry, APawn* Collector)
+{
+	const FSFPickupKind& Kind = Kinds[Entry.KindIndex];
+	const USFItemFragment_AutoPickup* Fragment = Kind.Fragment;
+	const ASFAutoPickup* EffectCDO = Kind.EffectClass ? Kind.EffectClass->GetDefaultObject<ASFAutoPickup>() : nullptr;
+
+	if (EffectCDO && Fragment)
+	{
+		if (Fragment->bApplyToAllPlayers)
+		{
+			for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+			{
+				if (const APlayerController* PC = It->Get())
+				{
+					if (ASFPlayerState* PS = PC->GetPlayerState<ASFPlayerState>())
+					{
+						EffectCDO->ApplyCollectEffect(PS, Entry.Amount);
+					}
+				}
+			}
+		}
+		else if (Collector)
+		{
+			if (ASFPlayerState* PS = Collector->GetPlayerState<ASFPlayerState>())
+			{
+				EffectCDO->ApplyCollectEffect(PS, Entry.Amount);
+			}
+		}
+	}
+
+	// 리슨 서버 호스트용 연출 (클라이언트는 Multicast_PickupsCollected에서 재생)
+	if (Fragment && Fragment->CollectEffect && GetNetMode() != NM_DedicatedServer)
+	{
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, Fragment->CollectEffect, Entry.Location);
+	}
+
+	PendingCollectedIds.Add(Entry.Id);
+	MarkBatchCollected(Entry.Id);
+}
+
+void USFPickupManagerComponent::MarkBatchCollected(uint32 PickupId)
+{
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Entries.Num(); ++BatchIndex)
+	{
+		FSFPickupBatchEntry& BatchEntry = Batches.Entries[BatchIndex];
+		const uint32 Offset = PickupId - BatchEntry.Batch.FirstId;
+		if (PickupId < BatchEntry.Batch.FirstId || Offset >= BatchEntry.Batch.Count)
+		{
+			continue;
+		}
+
+		BatchEntry.CollectedMask[Offset / 32] |= 1u << (Offset % 32);
+
+		// 다 수집된 묶음은 제거 (클라이언트는 PreReplicatedRemove에서 남은 픽업 정리)
+		if (--BatchEntry.NumRemaining <= 0)
+		{
+			Batches.Entries.RemoveAtSwap(BatchIndex);
+			Batches.MarkArrayDirty();
+		}
+		else
+		{
+			Batches.MarkItemDirty(BatchEntry);
+		}
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, Batches, this);
+		return;
+	}
+}
+
+void USFPickupManagerComponent::UpdateMeshInstances()
+{
+	for (int32 KindIndex = 0; KindIndex < Kinds.Num(); ++KindIndex)
+	{
+		UInstancedStaticMeshComponent* MeshInstances = Kinds[KindIndex].MeshInstances;
+		if (!MeshInstances)
+		{
+			continue;
+		}
+
+		const FVector MeshScale = Kinds[KindIndex].Fragment ? Kinds[KindIndex].Fragment->PickupMeshScale : FVector::OneVector;
+
+		InstanceTransformScratch.Reset();
+		for (const FPickupEntry& Entry : Pickups)
+		{
+			if (Entry.KindIndex == KindIndex && Entry.Phase != EPickupPhase::Collected)
+			{
+				InstanceTransformScratch.Emplace(FQuat::Identity, Entry.Location, MeshScale);
+			}
+		}
+
+		const int32 NumWanted = InstanceTransformScratch.Num();
+		const int32 NumInstances = MeshInstances->GetInstanceCount();
+
+		if (NumWanted == 0)
+		{
+			if (NumInstances > 0)
+			{
+				MeshInstances->ClearInstances();
+			}
+			continue;
+		}
+
+		// 인스턴스 수만 맞춘 뒤 전체 트랜스폼을 한 번에 갱신
+		if (NumInstances > NumWanted)
+		{
+			TArray<int32> InstancesToRemove;
+			InstancesToRemove.Reserve(NumInstances - NumWanted);
+			for (int32 InstanceIndex = NumInstances - 1; InstanceIndex >= NumWanted; --InstanceIndex)
+			{
+				InstancesToRemove.Add(InstanceIndex);
+			}
+			MeshInstances->RemoveInstances(InstancesToRemove, true);
+		}
+		else if (NumInstances < NumWanted)
+		{
+			TArray<FTransform> NewInstances(InstanceTransformScratch.GetData() + NumInstances, NumWanted - NumInstances);
+			MeshInstances->AddInstances(NewInstances, false, true);
+		}
+
+		MeshInstances->BatchUpdateInstancesTransforms(0, InstanceTransformScratch, true, true, true);
+	}
+}
+
+AActor* USFPickupManagerComponent::GetOrCreateRenderActor()
+{
+	if (RenderActor)
+	{
+		return RenderActor;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// 원점에 고정된 로컬 액터 (인스턴스 트랜스폼은 월드 좌표로 갱신)
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	RenderActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!RenderActor)
+	{
+		return nullptr;
+	}
+
+	RenderActor->SetReplicates(false);
+	RenderActor->SetCanBeDamaged(false);
+
+	USceneComponent* Root = NewObject<USceneComponent>(RenderActor, TEXT("Root"), RF_Transient);
+	Root->SetMobility(EComponentMobility::Static);
+	RenderActor->SetRootComponent(Root);
+	Root->RegisterComponent();
+	RenderActor->AddInstanceComponent(Root);
+
+	return RenderActor;
+}
+
+void USFPickupManagerComponent::UpdateTickEnabled()
+{
+	// 마지막 픽업이 사라진 프레임에도 인스턴스 정리를 위해 한 번 더 틱
+	const bool bHasRenderedInstances = Kinds.ContainsByPredicate([](const FSFPickupKind& Kind)
+	{
+		return Kind.MeshInstances && Kind.MeshInstances->GetInstanceCount() > 0;
+	});
+
+	SetComponentTickEnabled(Pickups.Num() > 0 || bHasRenderedInstances);
+}
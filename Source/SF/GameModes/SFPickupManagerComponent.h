@@ -0,0 +1,276 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/GameStateComponent.h"
+#include "Engine/NetSerialization.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "SFPickupManagerComponent.generated.h"
+
+class APawn;
+class ASFAutoPickup;
+class UInstancedStaticMeshComponent;
+class USFItemFragment_AutoPickup;
+class USFItemInstance;
+class USFPickupManagerComponent;
+
+/**
+ * 한 번의 드롭으로 생긴 자동 습득 아이템 묶음
+ * 개별 위치/속도 대신 시드만 보내고, 서버/클라이언트가 같은 시드로 동일한 초기 상태를 생성
+ */
+USTRUCT()
+struct FSFPickupSpawnBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize Origin;
+
+	UPROPERTY()
+	int32 ItemId = INDEX_NONE;
+
+	UPROPERTY()
+	int32 Seed = 0;
+
+	// 개당 수량 (효과는 서버만 적용하지만 리슨 서버도 같은 경로를 타므로 함께 전송)
+	UPROPERTY()
+	int32 AmountPerPickup = 1;
+
+	UPROPERTY()
+	float SpawnRadius = 100.f;
+
+	// 서버 월드 시간 기준 스폰 시각 (늦게 받은 클라이언트가 낙하를 미리 진행)
+	UPROPERTY()
+	float SpawnTime = 0.f;
+
+	// 묶음의 첫 픽업 ID. 나머지는 FirstId + i
+	UPROPERTY()
+	uint32 FirstId = 0;
+
+	UPROPERTY()
+	uint16 Count = 0;
+};
+
+/**
+ * 아직 수집이 끝나지 않은 드롭 묶음 (복제 상태)
+ * 늦게 접속/재접속한 클라이언트도 시드와 수집 비트마스크로 남은 픽업을 재구성
+ */
+USTRUCT()
+struct FSFPickupBatchEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FSFPickupSpawnBatch Batch;
+
+	// 수집된 픽업 비트마스크 (비트 i = FirstId + i)
+	UPROPERTY()
+	TArray<uint32> CollectedMask;
+
+	// 서버 전용: 남은 픽업 수 (0이 되면 묶음 제거)
+	int32 NumRemaining = 0;
+};
+
+USTRUCT()
+struct FSFPickupBatchList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	FSFPickupBatchList() : OwnerComponent(nullptr) {}
+	FSFPickupBatchList(USFPickupManagerComponent* InOwnerComponent) : OwnerComponent(InOwnerComponent) {}
+
+	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FSFPickupBatchEntry, FSFPickupBatchList>(Entries, DeltaParms, *this);
+	}
+
+private:
+	friend USFPickupManagerComponent;
+
+	UPROPERTY()
+	TArray<FSFPickupBatchEntry> Entries;
+
+	UPROPERTY(NotReplicated)
+	TObjectPtr<USFPickupManagerComponent> OwnerComponent;
+};
+
+template<>
+struct TStructOpsTypeTraits<FSFPickupBatchList> : public TStructOpsTypeTraitsBase2<FSFPickupBatchList>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+/**
+ * 아이템(ItemId)별 시뮬레이션 설정과 렌더링 컴포넌트
+ */
+USTRUCT()
+struct FSFPickupKind
+{
+	GENERATED_BODY()
+
+	int32 ItemId = INDEX_NONE;
+
+	UPROPERTY()
+	TObjectPtr<const USFItemFragment_AutoPickup> Fragment;
+
+	// 수집 효과를 적용할 픽업 클래스 (CDO의 ApplyCollectEffect 사용)
+	UPROPERTY()
+	TSubclassOf<ASFAutoPickup> EffectClass;
+
+	// 클라이언트 렌더링용 (데디케이티드 서버에서는 생성하지 않음). 소유자는 RenderActor
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> MeshInstances;
+};
+
+/**
+ * USFPickupManagerComponent
+ * 바닥에 떨어진 자동 습득 아이템(골드 등)을 액터 없이 구조체 배열로 시뮬레이션
+ * - 낙하/바운스 → 정지 → 가장 가까운 영웅에게 유도 → 수집
+ * - 프레임당 한 번 영웅 위치를 모으고, 모든 픽업에 대해 한 번의 거리 패스로 유도/수집 판정
+ * - 복제는 남은 묶음의 스폰 시드 + 수집 비트마스크(Batches)만 전송. 수집 연출은 Multicast_PickupsCollected로 먼저 재생
+ * - 렌더링은 아이템 종류별 InstancedStaticMesh 하나 (GameState는 AInfo라 숨김 상태이므로 로컬 전용 렌더 액터에 붙임)
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SF_API USFPickupManagerComponent : public UGameStateComponent
+{
+	GENERATED_BODY()
+
+public:
+	USFPickupManagerComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	static USFPickupManagerComponent* Get(const UObject* WorldContextObject);
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// 서버: 매니저로 시뮬레이션 가능한 아이템인지 (Fragment 설정 + 메시 지정)
+	static bool CanSimulate(const USFItemFragment_AutoPickup* Fragment);
+
+	// 서버: Count개의 픽업을 Location 주변에 드롭
+	void SpawnPickups(const USFItemInstance* ItemInstance, int32 AmountPerPickup, int32 Count, const FVector& Location, float SpawnRadius);
+
+	int32 GetNumPickups() const { return Pickups.Num(); }
+
+protected:
+	// 수집 연출용 (유실되어도 Batches 복제로 제거됨)
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_PickupsCollected(const TArray<uint32>& PickupIds);
+
+private:
+	friend FSFPickupBatchList;
+
+	enum class EPickupPhase : uint8
+	{
+		Falling,	// 낙하/바운스 중
+		Settled,	// 바닥에 정지
+		Homing,		// 영웅에게 유도 중
+		Collected	// 클라이언트: 로컬에서 수집됨 (서버 확정 대기, 렌더링 제외)
+	};
+
+	struct FPickupEntry
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Velocity = FVector::ZeroVector;
+		TWeakObjectPtr<APawn> HomingTarget;
+		float FloorZ = 0.f;
+		float Age = 0.f;
+		float HomingSpeed = 0.f;
+		float CollectedTime = 0.f;
+		int32 KindIndex = INDEX_NONE;
+		int32 Amount = 1;
+		uint32 Id = 0;
+		EPickupPhase Phase = EPickupPhase::Falling;
+	};
+
+	struct FHeroSample
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.f;
+	};
+
+	int32 FindOrAddKind(int32 ItemId);
+	void AddBatch(const FSFPickupSpawnBatch& Batch, TConstArrayView<uint32> CollectedMask, float ElapsedTime);
+	void RemovePickupAt(int32 Index);
+	void RemoveCollectedPickup(uint32 PickupId);
+
+	// 클라이언트: Batches 복제 콜백
+	void OnBatchAdded(const FSFPickupBatchEntry& BatchEntry);
+	void OnBatchChanged(const FSFPickupBatchEntry& BatchEntry);
+	void OnBatchRemoved(const FSFPickupBatchEntry& BatchEntry);
+
+	void GatherHeroes();
+	void Simulate(float DeltaTime);
+	void SimulateFalling(FPickupEntry& Entry, float GravityZ, float DeltaTime) const;
+	void Collect(FPickupEntry& Entry, APawn* Collector);
+	void MarkBatchCollected(uint32 PickupId);
+	void UpdateMeshInstances();
+	AActor* GetOrCreateRenderActor();
+
+	void UpdateTickEnabled();
+
+protected:
+	// 낙하 초기 속도/각도 (PickupActorClass CDO 값이 우선)
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float DropInitialSpeed = 400.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float DropInitialAngle = 60.f;
+
+	// 바운스 시 수직 속도 유지 비율 / 수평 속도 감쇠 비율
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float Bounciness = 0.3f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float Friction = 0.8f;
+
+	// 바운스 속도가 이 값보다 작으면 정지
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float BounceStopThreshold = 20.f;
+
+	// 바닥 탐색 트레이스 높이/깊이 (스폰 시 픽업당 1회)
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float FloorTraceUp = 200.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float FloorTraceDown = 2000.f;
+
+	// 바닥 위 정지 높이 (기존 픽업 액터의 충돌 구 반경)
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float FloorOffset = 16.f;
+
+	// 클라이언트: 로컬 수집 후 서버 확정을 기다리는 시간. 넘으면 다시 보이게 하고 낙하
+	UPROPERTY(EditDefaultsOnly, Category = "SF|Pickup")
+	float CollectConfirmTimeout = 1.f;
+
+private:
+	// 수집이 끝나지 않은 묶음 (늦은 접속/재접속 클라이언트 재구성용)
+	UPROPERTY(Replicated)
+	FSFPickupBatchList Batches;
+
+	UPROPERTY(Transient)
+	TArray<FSFPickupKind> Kinds;
+
+	TArray<FPickupEntry> Pickups;
+	TMap<uint32, int32> PickupIndexById;
+
+	// 이번 프레임 영웅 샘플 (서버/클라이언트 모두 PlayerArray 기준)
+	TArray<FHeroSample> Heroes;
+
+	// 서버: 이번 프레임에 수집된 ID (틱 끝에 한 번에 전송)
+	TArray<uint32> PendingCollectedIds;
+
+	// 렌더링 버퍼 재사용
+	TArray<FTransform> InstanceTransformScratch;
+
+	// InstancedStaticMesh 소유자. 숨김 상태인 GameState에 붙이면 씬에 추가되지 않으므로 복제하지 않는 로컬 액터를 따로 스폰
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> RenderActor;
+
+	// uint32라 세션 중 되감겨 살아있는 ID와 겹치지 않음
+	uint32 NextPickupId = 0;
+};
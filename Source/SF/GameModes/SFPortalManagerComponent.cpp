@@ -21,8 +21,11 @@ void USFPortalManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimePrope
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ThisClass, bPortalActive);
-	DOREPLIFETIME(ThisClass, PortalState);
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, bPortalActive, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, PortalState, SharedParams);
 }
 
 void USFPortalManagerComponent::BeginPlay()
@@ -71,6 +74,7 @@ void USFPortalManagerComponent::ActivatePortal()
         return;
     }
 
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, bPortalActive, this);
     bPortalActive = true;
     OnRep_PortalActive();
 }
@@ -144,6 +148,7 @@ void USFPortalManagerComponent::OnFirstPlayerReady()
         return;
     }
     
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, PortalState, this);
     PortalState.bIsActive = true;
     PortalState.TotalPlayerCount = GetRequiredPlayerCount();
     PortalState.TravelCountdown = ForceTimeLimit;
@@ -203,6 +208,7 @@ void USFPortalManagerComponent::StartTravelCountdown()
     // 강제 타이머 정지
     World->GetTimerManager().ClearTimer(ForceTimerHandle);
 
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, PortalState, this);
     PortalState.TravelCountdown = TravelDelayTime;
     BroadcastPortalState();
 
@@ -238,6 +244,7 @@ void USFPortalManagerComponent::BroadcastPortalState()
         return;
     }
 
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, PortalState, this);
     PortalState.TotalPlayerCount = GetRequiredPlayerCount();
 
     // Listen server 전용
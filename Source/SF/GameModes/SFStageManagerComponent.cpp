@@ -18,9 +18,12 @@ void USFStageManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProper
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(ThisClass, CurrentStageInfo);
-    DOREPLIFETIME(ThisClass, bStageCleared);
-    DOREPLIFETIME(ThisClass, CurrentBossActor);
+    FDoRepLifetimeParams SharedParams;
+    SharedParams.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, CurrentStageInfo, SharedParams);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, bStageCleared, SharedParams);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, CurrentBossActor, SharedParams);
 }
 
 void USFStageManagerComponent::BeginPlay()
@@ -34,6 +37,7 @@ void USFStageManagerComponent::BeginPlay()
         {
             if (USFStageSubsystem* StageSubsystem = GI->GetSubsystem<USFStageSubsystem>())
             {
+                MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, CurrentStageInfo, this);
                 CurrentStageInfo = StageSubsystem->GetCurrentStageInfo();
             }
         }
@@ -81,6 +85,7 @@ void USFStageManagerComponent::NotifyStageClear()
     }
     
     SaveLocalPlayerGoldToPlayFab();
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, bStageCleared, this);
     bStageCleared = true;
 
     OnStageCleared.Broadcast(CurrentStageInfo);
@@ -102,6 +107,7 @@ void USFStageManagerComponent::OnRep_bStageCleared()
 void USFStageManagerComponent::RegisterBossActor(ACharacter* NewBoss)
 {
     if (!GetOwner()->HasAuthority()) return;
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, CurrentBossActor, this);
     CurrentBossActor = NewBoss;
     OnBossStateChanged.Broadcast(CurrentBossActor);    
 }
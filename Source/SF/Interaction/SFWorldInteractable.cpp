@@ -6,11 +6,46 @@
 #include "AbilitySystem/Abilities/SFGameplayAbilityTags.h"
 #include "Character/SFCharacterBase.h"
 #include "Net/UnrealNetwork.h"
+#include "System/SFNetDormancySubsystem.h"
+#include "System/SFSpatialHashSubsystem.h"
 
 ASFWorldInteractable::ASFWorldInteractable(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	bReplicates = true;
+
+	// 상태가 바뀔 때만 USFNetDormancySubsystem이 잠깐 깨움
+	NetDormancy = DORM_Initial;
+}
+
+void ASFWorldInteractable::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->RegisterActor(this, ESFSpatialCategory::Interactable);
+	}
+
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->RegisterActor(this);
+	}
+}
+
+void ASFWorldInteractable::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->UnregisterActor(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASFWorldInteractable::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -30,6 +65,12 @@ void ASFWorldInteractable::OnInteractActiveStarted(AActor* Interactor)
 	if (HasAuthority())
 	{
 		CachedInteractors.Add(Interactor);
+
+		// 홀딩 중 BP에서 바꾸는 상태도 전송되도록 상호작용이 끝날 때까지 깨어 있음
+		if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+		{
+			NetDormancySubsystem->SetActorPinnedAwake(this, true);
+		}
 	}
 
 	K2_OnInteractActiveStarted(Interactor);
@@ -45,6 +86,14 @@ void ASFWorldInteractable::OnInteractActiveEnded(AActor* Interactor)
 	if (HasAuthority())
 	{
 		CachedInteractors.RemoveSingleSwap(Interactor);
+
+		if (GetActiveInteractorCount() == 0)
+		{
+			if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+			{
+				NetDormancySubsystem->SetActorPinnedAwake(this, false);
+			}
+		}
 	}
 
 	K2_OnInteractActiveEnded(Interactor);
@@ -59,6 +108,12 @@ void ASFWorldInteractable::OnInteractionSuccess(AActor* Interactor)
 	
 	if (HasAuthority())
 	{
+		// bWasConsumed 등 결과 전송 후 다시 Dormant
+		if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+		{
+			NetDormancySubsystem->WakeActor(this);
+		}
+
 		// 일회성 상호작용 객체인 경우 소모 처리 및 다른 상호작용자들의 상호작용 취소
 		if (bShouldConsume)
 		{
@@ -92,6 +147,11 @@ void ASFWorldInteractable::OnInteractionSuccess(AActor* Interactor)
 			// 반복 사용 가능한 객체의 경우 캐시만 정리
 			CachedInteractors.Empty();
 		}
+
+		if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+		{
+			NetDormancySubsystem->SetActorPinnedAwake(this, false);
+		}
 	}
 	
 	K2_OnInteractionSuccess(Interactor);
@@ -5,11 +5,46 @@
 #include "Item/SFItemDefinition.h"
 #include "Item/SFItemInstance.h"
 #include "Net/UnrealNetwork.h"
+#include "System/SFNetDormancySubsystem.h"
+#include "System/SFSpatialHashSubsystem.h"
 
 ASFWorldPickupable::ASFWorldPickupable(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	bReplicates = true;
+
+	// 픽업 정보가 바뀔 때만 USFNetDormancySubsystem이 잠깐 깨움
+	NetDormancy = DORM_Initial;
+}
+
+void ASFWorldPickupable::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->RegisterActor(this, ESFSpatialCategory::Pickup);
+	}
+
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->RegisterActor(this);
+	}
+}
+
+void ASFWorldPickupable::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this))
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+
+	if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+	{
+		NetDormancySubsystem->UnregisterActor(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASFWorldPickupable::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -39,6 +74,11 @@ void ASFWorldPickupable::SetPickupInfo(const FSFPickupInfo& InPickupInfo)
 	}
 	if (InPickupInfo.PickupInstance.ItemInstance || InPickupInfo.PickupDefinition.ItemDefinitionClass)
 	{
+		if (USFNetDormancySubsystem* NetDormancySubsystem = USFNetDormancySubsystem::Get(this))
+		{
+			NetDormancySubsystem->WakeActor(this);
+		}
+
 		PickupInfo = InPickupInfo;
 		OnRep_PickupInfo();
 	}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "SFPoolableActorInterface.generated.h"
+
+UINTERFACE(MinimalAPI)
+class USFPoolableActorInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * USFProjectilePoolSubsystem이 재사용하는 액터가 구현하는 인터페이스
+ * 숨김/콜리전/Dormancy/수명 같은 공통 상태는 풀이 처리하고,
+ * 클래스 고유 상태(이동, 이펙트, 데미지 정보 등)의 초기화만 여기서 담당
+ */
+class SF_API ISFPoolableActorInterface
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * 서버: 풀에서 꺼내져 새 위치/Owner로 배치된 직후 호출 (BeginPlay 대체)
+	 */
+	virtual void OnAcquiredFromPool() = 0;
+
+	/**
+	 * 서버: 풀로 반환되기 직전 호출 (다음 사용자에게 이전 상태가 남지 않도록 초기화)
+	 */
+	virtual void OnReleasedToPool() = 0;
+};
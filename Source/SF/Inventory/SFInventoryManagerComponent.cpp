@@ -82,6 +82,7 @@ void USFInventoryManagerComponent::InitializeComponent()
         {
             InventoryList.MarkItemDirty(Entry);
         }
+        MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InventoryList, this);
     }
 }
 
@@ -89,7 +90,10 @@ void USFInventoryManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimePr
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(ThisClass, InventoryList);
+    FDoRepLifetimeParams SharedParams;
+    SharedParams.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InventoryList, SharedParams);
 }
 
 void USFInventoryManagerComponent::SaveToData(TArray<FSFSavedItemSlot>& OutSlots) const
@@ -156,6 +160,7 @@ void USFInventoryManagerComponent::RestoreFromData(const TArray<FSFSavedItemSlot
         }
 
         InventoryList.MarkItemDirty(Entry);
+        MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InventoryList, this);
         RestoredCount++;
     }
 }
@@ -360,6 +365,7 @@ int32 USFInventoryManagerComponent::TryAddItem(int32 ItemID, const FGameplayTag&
         }
 
         InventoryList.MarkItemDirty(Entry);
+        MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InventoryList, this);
     }
 
     return AddableCount;
@@ -464,6 +470,7 @@ void USFInventoryManagerComponent::AddItemInternal(int32 SlotIndex, USFItemInsta
     }
 
     InventoryList.MarkItemDirty(Entry);
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InventoryList, this);
 
     if (APlayerController* PC = Cast<APlayerController>(GetOwner()))
     {
@@ -497,6 +504,7 @@ USFItemInstance* USFInventoryManagerComponent::RemoveItemInternal(int32 SlotInde
     }
 
     InventoryList.MarkItemDirty(Entry);
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, InventoryList, this);
 
     if (APlayerController* PC = Cast<APlayerController>(GetOwner()))
     {
@@ -80,6 +80,7 @@ void USFQuickbarComponent::InitializeComponent()
         {
             QuickbarList.MarkItemDirty(Entry);
         }
+        MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, QuickbarList, this);
     }
 }
 
@@ -87,7 +88,10 @@ void USFQuickbarComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(ThisClass, QuickbarList);
+    FDoRepLifetimeParams SharedParams;
+    SharedParams.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, QuickbarList, SharedParams);
 }
 
 void USFQuickbarComponent::SaveToData(TArray<FSFSavedItemSlot>& OutSlots) const
@@ -154,6 +158,7 @@ void USFQuickbarComponent::RestoreFromData(const TArray<FSFSavedItemSlot>& InSlo
         }
 
         QuickbarList.MarkItemDirty(Entry);
+        MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, QuickbarList, this);
         RestoredCount++;
     }
 }
@@ -270,6 +275,7 @@ void USFQuickbarComponent::AddItemInternal(int32 SlotIndex, USFItemInstance* Ite
     }
 
     QuickbarList.MarkItemDirty(Entry);
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, QuickbarList, this);
 
     if (APlayerController* PC = Cast<APlayerController>(GetOwner()))
     {
@@ -303,6 +309,7 @@ USFItemInstance* USFQuickbarComponent::RemoveItemInternal(int32 SlotIndex, int32
     }
 
     QuickbarList.MarkItemDirty(Entry);
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, QuickbarList, this);
 
     if (APlayerController* PC = Cast<APlayerController>(GetOwner()))
     {
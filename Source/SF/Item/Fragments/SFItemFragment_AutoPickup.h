@@ -5,6 +5,8 @@
 #include "SFItemFragment_AutoPickup.generated.h"
 
 class ASFAutoPickup;
+class UNiagaraSystem;
+class UStaticMesh;
 
 /**
  * 자동 습득 아이템 Fragment
@@ -43,4 +45,19 @@ public:
 	// 모든 플레이어에게 효과 적용 여부
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AutoPickup")
 	bool bApplyToAllPlayers = true;
+
+	// true면 액터 대신 USFPickupManagerComponent가 구조체로 시뮬레이션 (PickupMesh 필요)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AutoPickup|Simulation")
+	bool bSimulateInPickupManager = true;
+
+	// 매니저 시뮬레이션 시 인스턴스 메시로 그릴 메시. 비어 있으면 PickupActorClass 액터로 스폰
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AutoPickup|Simulation")
+	TObjectPtr<UStaticMesh> PickupMesh;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AutoPickup|Simulation")
+	FVector PickupMeshScale = FVector::OneVector;
+
+	// 수집 시 클라이언트에서 재생할 이펙트 (액터 방식의 OnRep_PickupState BP 연출 대체)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AutoPickup|Simulation")
+	TObjectPtr<UNiagaraSystem> CollectEffect;
 };
@@ -9,6 +9,7 @@
 #include "Inventory/SFInventoryManagerComponent.h"
 #include "Actors/SFPickupableItemBase.h"
 #include "Fragments/SFItemFragment_AutoPickup.h"
+#include "GameModes/SFPickupManagerComponent.h"
 
 TArray<FSFDropResult> USFDropFunctionLibrary::GenerateDropResults(UObject* Outer, const USFDropTable* DropTable, float LuckValue)
 {
@@ -136,6 +137,16 @@ void USFDropFunctionLibrary::SpawnDropResults(UObject* WorldContextObject, const
         // 자동 습득 아이템
         if (const USFItemFragment_AutoPickup* AutoPickupFragment = ItemDef->FindFragment<USFItemFragment_AutoPickup>())
         {
+            // 메시가 지정된 아이템은 액터 없이 픽업 매니저가 일괄 시뮬레이션
+            if (USFPickupManagerComponent::CanSimulate(AutoPickupFragment))
+            {
+                if (USFPickupManagerComponent* PickupManager = USFPickupManagerComponent::Get(World))
+                {
+                    PickupManager->SpawnPickups(Result.ItemInstance, ActualAmount, ActualSpawnCount, Location, SpawnRadius);
+                    continue;
+                }
+            }
+
             TSubclassOf<ASFAutoPickup> PickupClass = AutoPickupFragment->PickupActorClass;
             if (!PickupClass)
             {
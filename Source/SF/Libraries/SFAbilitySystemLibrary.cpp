@@ -1,8 +1,15 @@
 #include "SFAbilitySystemLibrary.h"
 
 #include "AbilitySystemComponent.h"
+#include "SFLogChannels.h"
+#include "AbilitySystem/SFAbilitySystemComponent.h"
+#include "AbilitySystem/Attributes/SFCombatSet.h"
+#include "AbilitySystem/Attributes/SFPrimarySet.h"
+#include "AbilitySystem/EffectExecutionCalculation/SFDamageEffectExecCalculation.h"
+#include "AbilitySystem/GameplayEffect/SFGameplayEffectContext.h"
 #include "AbilitySystem/GameplayEvent/SFGameplayEventTags.h"
 #include "Character/SFCharacterGameplayTags.h"
+#include "Engine/World.h"
 
 void USFAbilitySystemLibrary::SendGameplayEventFromSpec(UAbilitySystemComponent* ASC, const FGameplayTag& EventTag, const FGameplayEffectSpec& Spec)
 {
@@ -139,3 +146,135 @@ void USFAbilitySystemLibrary::SendDeathEvent(UAbilitySystemComponent* ASC, AActo
 
 	SendGameplayEvent(ASC, SFGameplayTags::GameplayEvent_Death, Instigator);
 }
+
+int32 USFAbilitySystemLibrary::ApplyGameplayEffectSpecToTargets(UAbilitySystemComponent* SourceASC, const FGameplayEffectSpec& Spec, TArrayView<UAbilitySystemComponent* const> TargetASCs)
+{
+	if (!SourceASC || !Spec.Def)
+	{
+		return 0;
+	}
+
+	FGameplayEffectContextHandle ContextHandle = Spec.GetEffectContext();
+	FSFGameplayEffectContext* SFContext = static_cast<FSFGameplayEffectContext*>(ContextHandle.Get());
+
+	int32 NumApplied = 0;
+	for (UAbilitySystemComponent* TargetASC : TargetASCs)
+	{
+		if (!TargetASC)
+		{
+			continue;
+		}
+
+		// Context를 공유하므로 이전 타겟의 크리티컬 결과가 남지 않도록 초기화 (ExecCalc에서 다시 설정)
+		if (SFContext)
+		{
+			SFContext->SetIsCriticalHit(false);
+		}
+
+		SourceASC->ApplyGameplayEffectSpecToTarget(Spec, TargetASC);
+		++NumApplied;
+	}
+
+	return NumApplied;
+}
+
+#if !UE_BUILD_SHIPPING
+
+// 사용법: SF.Damage.Benchmark [Ticks]
+// 타겟 1/10/100명에 대해 타겟별 Spec 생성 방식과 단일 Spec 배치 적용 방식의 데미지 틱 비용을 비교
+static FAutoConsoleCommandWithWorldAndArgs CVarSFDamageBenchmark(
+	TEXT("SF.Damage.Benchmark"),
+	TEXT("Compare per-target damage specs against batched spec application for 1/10/100 targets. Args: [Ticks=100]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World || World->GetNetMode() == NM_Client)
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Damage.Benchmark: requires an authoritative game world"));
+			return;
+		}
+
+		const int32 Ticks = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+		const int32 TargetCounts[] = { 1, 10, 100 };
+
+		// 데미지 ExecCalc만 가진 임시 Instant GE
+		UGameplayEffect* DamageEffect = NewObject<UGameplayEffect>(GetTransientPackage(), TEXT("GE_SFDamageBenchmark"));
+		DamageEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+		FGameplayEffectExecutionDefinition& Execution = DamageEffect->Executions.AddDefaulted_GetRef();
+		Execution.CalculationClass = USFDamageEffectExecCalculation::StaticClass();
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		TArray<AActor*> SpawnedActors;
+		auto SpawnDummy = [World, &SpawnParams, &SpawnedActors]() -> UAbilitySystemComponent*
+		{
+			AActor* Dummy = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+			if (!Dummy)
+			{
+				return nullptr;
+			}
+			SpawnedActors.Add(Dummy);
+
+			USFAbilitySystemComponent* ASC = NewObject<USFAbilitySystemComponent>(Dummy, TEXT("AbilitySystem"));
+			ASC->RegisterComponent();
+			ASC->InitAbilityActorInfo(Dummy, Dummy);
+			ASC->AddAttributeSetSubobject(NewObject<USFPrimarySet>(Dummy));
+			ASC->AddAttributeSetSubobject(NewObject<USFCombatSet>(Dummy));
+			ASC->SetNumericAttributeBase(USFPrimarySet::GetMaxHealthAttribute(), 1.e9f);
+			ASC->SetNumericAttributeBase(USFPrimarySet::GetHealthAttribute(), 1.e9f);
+			return ASC;
+		};
+
+		UAbilitySystemComponent* SourceASC = SpawnDummy();
+		if (!SourceASC)
+		{
+			return;
+		}
+
+		for (const int32 TargetCount : TargetCounts)
+		{
+			TArray<UAbilitySystemComponent*> TargetASCs;
+			for (int32 i = 0; i < TargetCount; ++i)
+			{
+				if (UAbilitySystemComponent* TargetASC = SpawnDummy())
+				{
+					TargetASCs.Add(TargetASC);
+				}
+			}
+
+			// 기존 방식: 타겟마다 Context/Spec 생성
+			const double PerTargetStart = FPlatformTime::Seconds();
+			for (int32 Tick = 0; Tick < Ticks; ++Tick)
+			{
+				for (UAbilitySystemComponent* TargetASC : TargetASCs)
+				{
+					FGameplayEffectSpecHandle SpecHandle(new FGameplayEffectSpec(DamageEffect, SourceASC->MakeEffectContext(), 1.f));
+					SpecHandle.Data->SetSetByCallerMagnitude(SFGameplayTags::Data_Damage_BaseDamage, 1.f);
+					SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+				}
+			}
+			const double PerTargetMs = (FPlatformTime::Seconds() - PerTargetStart) * 1000.0;
+
+			// 배치 방식: 틱당 Spec 하나
+			const double BatchStart = FPlatformTime::Seconds();
+			for (int32 Tick = 0; Tick < Ticks; ++Tick)
+			{
+				FGameplayEffectSpec Spec(DamageEffect, SourceASC->MakeEffectContext(), 1.f);
+				Spec.SetSetByCallerMagnitude(SFGameplayTags::Data_Damage_BaseDamage, 1.f);
+				USFAbilitySystemLibrary::ApplyGameplayEffectSpecToTargets(SourceASC, Spec, TargetASCs);
+			}
+			const double BatchMs = (FPlatformTime::Seconds() - BatchStart) * 1000.0;
+
+			UE_LOG(LogSF, Display, TEXT("[DamageBenchmark] Targets=%3d Ticks=%d | PerTarget: %8.3f ms (%.3f us/tick) | Batch: %8.3f ms (%.3f us/tick)"),
+				TargetASCs.Num(), Ticks,
+				PerTargetMs, PerTargetMs * 1000.0 / Ticks,
+				BatchMs, BatchMs * 1000.0 / Ticks);
+		}
+
+		for (AActor* Dummy : SpawnedActors)
+		{
+			Dummy->Destroy();
+		}
+	}));
+
+#endif // !UE_BUILD_SHIPPING
@@ -51,4 +51,15 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "SF|AbilitySystem")
 	static void SendDeathEvent(UAbilitySystemComponent* ASC, AActor* Instigator = nullptr);
+
+	//~=============================================================================
+	// 다중 타겟 적용 (AOE 등에서 사용)
+	//~=============================================================================
+
+	/**
+	 * 하나의 Spec/Context를 여러 타겟에 적용 (타겟별 Spec 생성 없음)
+	 * 크리티컬 여부는 Context에 기록되므로 타겟마다 초기화 후 적용
+	 * @return 실제로 적용된 타겟 수
+	 */
+	static int32 ApplyGameplayEffectSpecToTargets(UAbilitySystemComponent* SourceASC, const FGameplayEffectSpec& Spec, TArrayView<UAbilitySystemComponent* const> TargetASCs);
 };
@@ -0,0 +1,248 @@
+#include "SFHitAggregatorComponent.h"
+
+#include "GameplayEffectTypes.h"
+#include "AbilitySystem/GameplayEffect/SFGameplayEffectContext.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Player/Components/SFPlayerStatsComponent.h"
+#include "System/SFDamageSettings.h"
+#include "System/SFDamageTextSubSystem.h"
+#include "TimerManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFHitAggregatorComponent)
+
+USFHitAggregatorComponent::USFHitAggregatorComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+USFHitAggregatorComponent* USFHitAggregatorComponent::FindHitAggregator(const AActor* Instigator)
+{
+	if (!Instigator)
+	{
+		return nullptr;
+	}
+
+	const AController* Controller = Cast<AController>(Instigator);
+	if (!Controller)
+	{
+		if (const APawn* Pawn = Cast<APawn>(Instigator))
+		{
+			Controller = Pawn->GetController();
+		}
+		else if (const APlayerState* PS = Cast<APlayerState>(Instigator))
+		{
+			Controller = PS->GetPlayerController();
+		}
+	}
+
+	return Controller ? Controller->FindComponentByClass<USFHitAggregatorComponent>() : nullptr;
+}
+
+bool USFHitAggregatorComponent::TryAggregateHit(const FGameplayEffectContextHandle& ContextHandle, AActor* Target, float Amount)
+{
+	if (!GetDefault<USFDamageSettings>()->bAggregateHitEvents || !Target || !ContextHandle.IsValid())
+	{
+		return false;
+	}
+
+	// 데미지 텍스트는 몬스터만 (플레이어/아군은 기존 GameplayCue 경로)
+	const APawn* TargetPawn = Cast<APawn>(Target);
+	if (!TargetPawn || TargetPawn->IsPlayerControlled() || TargetPawn->ActorHasTag(FName("Player")))
+	{
+		return false;
+	}
+
+	USFHitAggregatorComponent* Aggregator = FindHitAggregator(ContextHandle.GetInstigator());
+	if (!Aggregator || !Aggregator->GetOwner()->HasAuthority())
+	{
+		return false;
+	}
+
+	FVector HitLocation = FVector::ZeroVector;
+	if (const FHitResult* HitResult = ContextHandle.GetHitResult())
+	{
+		HitLocation = HitResult->ImpactPoint;
+	}
+
+	bool bIsCritical = false;
+	if (const FSFGameplayEffectContext* SFContext = static_cast<const FSFGameplayEffectContext*>(ContextHandle.Get()))
+	{
+		bIsCritical = SFContext->IsCriticalHit();
+	}
+
+	Aggregator->AddHit(Target, Amount, HitLocation, bIsCritical);
+	return true;
+}
+
+void USFHitAggregatorComponent::AddHit(AActor* Target, float Amount, const FVector& HitLocation, bool bIsCritical)
+{
+	if (!Target || Amount <= 0.f)
+	{
+		return;
+	}
+
+	// 같은 윈도우 안의 같은 타겟 히트는 합산 (크리티컬은 하나라도 있으면 유지, 위치는 마지막 히트 기준)
+	const TObjectKey<AActor> Key(Target);
+	if (const int32* FoundIndex = PendingHitIndexMap.Find(Key))
+	{
+		FPendingHit& Pending = PendingHits[*FoundIndex];
+		Pending.Amount += Amount;
+		Pending.bIsCritical |= bIsCritical;
+		if (!HitLocation.IsNearlyZero())
+		{
+			Pending.HitLocation = HitLocation;
+			Pending.bHasHitLocation = true;
+		}
+	}
+	else
+	{
+		FPendingHit& Pending = PendingHits.AddDefaulted_GetRef();
+		Pending.Target = Target;
+		Pending.Amount = Amount;
+		Pending.bIsCritical = bIsCritical;
+		Pending.HitLocation = HitLocation;
+		Pending.bHasHitLocation = !HitLocation.IsNearlyZero();
+		PendingHitIndexMap.Add(Key, PendingHits.Num() - 1);
+	}
+
+	ScheduleFlush();
+}
+
+void USFHitAggregatorComponent::AddDamageDealt(float Amount)
+{
+	if (Amount <= 0.f)
+	{
+		return;
+	}
+
+	PendingDamageDealt += Amount;
+	ScheduleFlush();
+}
+
+void USFHitAggregatorComponent::ScheduleFlush()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		FlushPendingHits();
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (TimerManager.IsTimerActive(FlushTimerHandle))
+	{
+		return;
+	}
+
+	// 윈도우가 0이면 다음 틱에 플러시 (같은 프레임 히트는 병합)
+	const float Window = GetDefault<USFDamageSettings>()->HitAggregationWindow;
+	if (Window > 0.f)
+	{
+		TimerManager.SetTimer(FlushTimerHandle, this, &ThisClass::FlushPendingHits, Window, false);
+	}
+	else
+	{
+		FlushTimerHandle = TimerManager.SetTimerForNextTick(this, &ThisClass::FlushPendingHits);
+	}
+}
+
+void USFHitAggregatorComponent::FlushPendingHits()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(FlushTimerHandle);
+	}
+
+	// 통계는 윈도우당 한 번만 갱신 → Stats 복제도 윈도우당 최대 한 번
+	if (PendingDamageDealt > 0.f)
+	{
+		if (const APlayerController* PC = GetController<APlayerController>())
+		{
+			if (USFPlayerStatsComponent* StatsComp = USFPlayerStatsComponent::FindPlayerStatsComponent(PC->PlayerState))
+			{
+				StatsComp->AddDamageDealt(PendingDamageDealt);
+			}
+		}
+		PendingDamageDealt = 0.f;
+	}
+
+	if (PendingHits.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 MaxHitsPerBatch = FMath::Max(1, GetDefault<USFDamageSettings>()->MaxHitsPerBatch);
+
+	TArray<FSFAggregatedHit> Batch;
+	Batch.Reserve(FMath::Min(PendingHits.Num(), MaxHitsPerBatch));
+
+	for (const FPendingHit& Pending : PendingHits)
+	{
+		AActor* Target = Pending.Target.Get();
+		if (!Target)
+		{
+			continue;
+		}
+
+		FSFAggregatedHit& Hit = Batch.AddDefaulted_GetRef();
+		Hit.Target = Target;
+		Hit.Amount = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Pending.Amount), 1, static_cast<int32>(MAX_uint16)));
+		if (Pending.bIsCritical)
+		{
+			Hit.Flags |= FSFAggregatedHit::Flag_Critical;
+		}
+		if (Pending.bHasHitLocation)
+		{
+			Hit.HitLocation = Pending.HitLocation;
+			Hit.Flags |= FSFAggregatedHit::Flag_HasHitLocation;
+		}
+
+		if (Batch.Num() >= MaxHitsPerBatch)
+		{
+			Client_ReceiveHitBatch(Batch);
+			Batch.Reset();
+		}
+	}
+
+	if (Batch.Num() > 0)
+	{
+		Client_ReceiveHitBatch(Batch);
+	}
+
+	PendingHits.Reset();
+	PendingHitIndexMap.Reset();
+}
+
+void USFHitAggregatorComponent::Client_ReceiveHitBatch_Implementation(const TArray<FSFAggregatedHit>& Hits)
+{
+	USFDamageTextSubSystem* DamageSystem = GetWorld() ? GetWorld()->GetSubsystem<USFDamageTextSubSystem>() : nullptr;
+	if (!DamageSystem)
+	{
+		return;
+	}
+
+	for (const FSFAggregatedHit& Hit : Hits)
+	{
+		if (!Hit.Target)
+		{
+			continue;
+		}
+
+		const FVector HitLocation = Hit.HasHitLocation() ? FVector(Hit.HitLocation) : FVector::ZeroVector;
+		DamageSystem->ShowDamage(Hit.Amount, Hit.Target, HitLocation, Hit.IsCritical());
+	}
+}
+
+void USFHitAggregatorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 남은 통계는 유실되지 않도록 반영
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		FlushPendingHits();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ControllerComponent.h"
+#include "Engine/NetSerialization.h"
+#include "UObject/ObjectKey.h"
+#include "SFHitAggregatorComponent.generated.h"
+
+struct FGameplayEffectContextHandle;
+
+/**
+ * 클라이언트로 전송되는 병합된 히트 (데미지 텍스트용)
+ * 데미지는 정수로 양자화, 크리티컬/히트 위치 유무는 Flags 비트로 전송
+ */
+USTRUCT()
+struct FSFAggregatedHit
+{
+	GENERATED_BODY()
+
+	enum EFlags : uint8
+	{
+		Flag_Critical		= 1 << 0,
+		Flag_HasHitLocation	= 1 << 1,
+	};
+
+	UPROPERTY()
+	TObjectPtr<AActor> Target;
+
+	UPROPERTY()
+	FVector_NetQuantize HitLocation;
+
+	UPROPERTY()
+	uint16 Amount = 0;
+
+	UPROPERTY()
+	uint8 Flags = 0;
+
+	bool IsCritical() const { return (Flags & Flag_Critical) != 0; }
+	bool HasHitLocation() const { return (Flags & Flag_HasHitLocation) != 0; }
+};
+
+/**
+ * USFHitAggregatorComponent
+ * 플레이어(커넥션)별 서버 히트 집계기
+ * - 윈도우(HitAggregationWindow) 동안 같은 타겟의 히트를 하나로 병합
+ * - 윈도우 종료 시 Unreliable RPC 한 번으로 데미지 텍스트 배치 전송
+ * - 누적 데미지 통계(USFPlayerStatsComponent)도 같은 시점에 한 번만 갱신
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SF_API USFHitAggregatorComponent : public UControllerComponent
+{
+	GENERATED_BODY()
+
+public:
+	USFHitAggregatorComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	// Instigator(Pawn/PlayerState/Controller)로부터 집계기 검색
+	static USFHitAggregatorComponent* FindHitAggregator(const AActor* Instigator);
+
+	// 서버: Context의 Instigator가 플레이어이고 타겟이 몬스터면 히트를 집계하고 true 반환 (false면 호출 측 기존 경로 사용)
+	static bool TryAggregateHit(const FGameplayEffectContextHandle& ContextHandle, AActor* Target, float Amount);
+
+	// 서버: 데미지 텍스트용 히트 누적
+	void AddHit(AActor* Target, float Amount, const FVector& HitLocation, bool bIsCritical);
+
+	// 서버: 누적 데미지 통계 적립 (플러시 시 한 번에 반영)
+	void AddDamageDealt(float Amount);
+
+	// 대기 중인 히트/통계를 즉시 전송
+	void FlushPendingHits();
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UFUNCTION(Client, Unreliable)
+	void Client_ReceiveHitBatch(const TArray<FSFAggregatedHit>& Hits);
+
+private:
+	void ScheduleFlush();
+
+private:
+	struct FPendingHit
+	{
+		TWeakObjectPtr<AActor> Target;
+		FVector HitLocation = FVector::ZeroVector;
+		float Amount = 0.f;
+		bool bHasHitLocation = false;
+		bool bIsCritical = false;
+	};
+
+	// 이번 윈도우에 누적된 히트 (타겟당 하나)
+	TArray<FPendingHit> PendingHits;
+	TMap<TObjectKey<AActor>, int32> PendingHitIndexMap;
+
+	// 이번 윈도우에 누적된 통계용 데미지
+	float PendingDamageDealt = 0.f;
+
+	FTimerHandle FlushTimerHandle;
+};
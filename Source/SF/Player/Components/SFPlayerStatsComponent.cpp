@@ -29,13 +29,18 @@ USFPlayerStatsComponent* USFPlayerStatsComponent::FindPlayerStatsComponent(const
 void USFPlayerStatsComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(ThisClass, Stats);
+
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, Stats, SharedParams);
 }
 
 void USFPlayerStatsComponent::AddDamageDealt(float Amount)
 {
 	if (GetOwner() && GetOwner()->HasAuthority() && Amount > 0.f)
 	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, Stats, this);
 		Stats.TotalDamageDealt += Amount;
 	}
 }
@@ -44,6 +49,7 @@ void USFPlayerStatsComponent::IncrementDownedCount()
 {
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, Stats, this);
 		Stats.TotalDownedCount++;
 	}
 }
@@ -52,6 +58,7 @@ void USFPlayerStatsComponent::IncrementReviveCount()
 {
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, Stats, this);
 		Stats.TotalReviveCount++;
 	}
 }
@@ -60,6 +67,7 @@ void USFPlayerStatsComponent::IncrementKillCount()
 {
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, Stats, this);
 		Stats.TotalEnemiesKilled++;
 	}
 }
@@ -68,6 +76,7 @@ void USFPlayerStatsComponent::CopyStatsFrom(const USFPlayerStatsComponent* Other
 {
 	if (Other)
 	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, Stats, this);
 		Stats = Other->Stats;
 	}
 }
@@ -76,6 +85,7 @@ void USFPlayerStatsComponent::ResetStats()
 {
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, Stats, this);
 		Stats = FSFPlayerStats();
 	}
 }
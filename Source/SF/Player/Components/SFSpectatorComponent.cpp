@@ -22,7 +22,10 @@ void USFSpectatorComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(ThisClass, SpectatorPawn);
+    FDoRepLifetimeParams SharedParams;
+    SharedParams.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, SpectatorPawn, SharedParams);
 }
 
 void USFSpectatorComponent::BeginPlay()
@@ -45,6 +48,7 @@ void USFSpectatorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     if (GetOwner() && GetOwner()->HasAuthority() && SpectatorPawn)
     {
         SpectatorPawn->Destroy();
+        MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, SpectatorPawn, this);
         SpectatorPawn = nullptr;
     }
     
@@ -167,6 +171,7 @@ void USFSpectatorComponent::Server_SpawnSpectatorPawn_Implementation()
     if (SpectatorPawn)
     {
         SpectatorPawn->Destroy();
+        MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, SpectatorPawn, this);
         SpectatorPawn = nullptr;
     }
 
@@ -184,6 +189,7 @@ void USFSpectatorComponent::Server_SpawnSpectatorPawn_Implementation()
     SpawnParams.Owner = PC;
     SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
+    MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, SpectatorPawn, this);
     SpectatorPawn = World->SpawnActor<ASFSpectatorPawn>(SpectatorPawnClass, SpawnLocation, SpawnRotation, SpawnParams);
     if (SpectatorPawn)
     {
@@ -207,6 +213,7 @@ void USFSpectatorComponent::Server_DestroySpectatorPawn_Implementation()
         }
 
         SpectatorPawn->Destroy();
+        MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, SpectatorPawn, this);
         SpectatorPawn = nullptr;
     }
 
@@ -6,27 +6,25 @@
 #include "Components/SFLoadingCheckComponent.h"
 #include "Blueprint/UserWidget.h"
 #include "EnhancedInputComponent.h"
-#include "Character/Enemy/Component/SFEnemyWidgetComponent.h"
 #include "Components/GameFrameworkInitStateInterface.h"
 #include "Components/SFDeathUIComponent.h"
+#include "Components/SFHitAggregatorComponent.h"
 #include "Components/SFSharedUIComponent.h"
 #include "Components/SFSpectatorComponent.h"
 #include "UI/Compoent/SFInGameMenuComponent.h"
-#include "Components/CapsuleComponent.h"
 #include "GameFramework/Character.h"
 #include "GameModes/SFGameOverManagerComponent.h"
 #include "Inventory/SFInventoryManagerComponent.h"
 #include "Inventory/SFQuickbarComponent.h"
 #include "Item/SFItemManagerComponent.h"
-#include "GameFramework/GameplayMessageSubsystem.h"
 #include "GameModes/SFGameState.h"
 #include "GameModes/SFStageManagerComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Pawn/SFSpectatorPawn.h"
 #include "System/SFPlayFabSubsystem.h"
+#include "System/SFSpatialHashSubsystem.h"
 #include "UI/InGame/SFBossHUDWidget.h"
 #include "UI/InGame/SFIndicatorWidgetBase.h"
-#include "UI/InGame/SFDamageWidget.h"
 #include "LoadingScreenManager.h"
 #include "UI/InGame/StagePrintWidget.h"
 #include "UI/InGame/SFMinimapWidget.h"
@@ -42,6 +40,7 @@ ASFPlayerController::ASFPlayerController(const FObjectInitializer& ObjectInitial
 	QuickbarComponent = CreateDefaultSubobject<USFQuickbarComponent>(TEXT("QuickbarComponent"));
 	ItemManagerComponent = CreateDefaultSubobject<USFItemManagerComponent>(TEXT("ItemManagerComponent"));
 	InGameMenuComponent = CreateDefaultSubobject<USFInGameMenuComponent>(TEXT("SystemMenuComponent"));
+	HitAggregatorComponent = CreateDefaultSubobject<USFHitAggregatorComponent>(TEXT("HitAggregatorComponent"));
 }
 
 void ASFPlayerController::BeginPlay()
@@ -50,15 +49,6 @@ void ASFPlayerController::BeginPlay()
 	SetInputMode(FInputModeGameOnly());
 	SetShowMouseCursor(false);
 
-	// 몬스터 데미지 텍스트 관련 리스너 등록 (UI.Event.Damage) -> OnDamageMessageReceived() 실행
-	UGameplayMessageSubsystem& MessageSubsystem = UGameplayMessageSubsystem::Get(this);
-	
-	DamageMessageListenerHandle = MessageSubsystem.RegisterListener(
-		FGameplayTag::RequestGameplayTag("UI.Event.Damage"), 
-		this, 
-		&ThisClass::OnDamageMessageReceived
-	);
-
 	// 로컬 플레이어인 경우 팀원 표시 로직 실행
 	if (IsLocalController())
 	{
@@ -217,11 +207,18 @@ void ASFPlayerController::CreateTeammateIndicators()
 
 	// 2. 새로운 팀원 검색 및 위젯 생성
 
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACharacter::StaticClass(), FoundActors);
+	USFSpatialHashSubsystem* SpatialHash = USFSpatialHashSubsystem::Get(this);
+	if (!SpatialHash)
+	{
+		return;
+	}
 
 	APawn* MyPawn = GetPawn();
 
+	// 공간 해시에 등록된 Hero만 후보로 사용 (월드 전체 캐릭터 스캔 X)
+	TArray<AActor*> FoundActors;
+	SpatialHash->GetActorsOfCategory(FSFSpatialQueryParams(ESFSpatialCategory::Hero, MyPawn), FoundActors);
+
 	for (AActor* Actor : FoundActors)
 	{
 		// A. 플레이어 자신이면 패스
@@ -256,78 +253,6 @@ void ASFPlayerController::CreateTeammateIndicators()
 }
 
 
-void ASFPlayerController::OnDamageMessageReceived(FGameplayTag Channel, const FSFDamageMessageInfo& Payload)
-{
-	// 유효성 체크 -> 타겟 확인
-	if (!Payload.TargetActor) return;
-
-	APawn* MyPawn = GetPawn();
-	if (!MyPawn) return;
-	APlayerState* MyPS = GetPlayerState<APlayerState>();
-
-	/*UE_LOG(LogTemp, Warning, TEXT("Damage Debug: Instigator=[%s], MyPawn=[%s], MyController=[%s]"),
-	Payload.Instigator ? *Payload.Instigator->GetName() : TEXT("NULL"),
-	*MyPawn->GetName(),
-	*GetName());
-	*/
-
-	bool bIsMyPawn = (Payload.Instigator == MyPawn);
-	bool bIsMyController = (Payload.Instigator == this);
-	bool bIsMyPlayerState = (MyPS && Payload.Instigator == MyPS);
-	
-	if (!bIsMyPawn && !bIsMyController && !bIsMyPlayerState)
-	{
-		return; 
-	}
-	
-	Client_ShowDamageText(Payload.DamageAmount, Payload.TargetActor);
-}
-
-void ASFPlayerController::Client_ShowDamageText_Implementation(float DamageAmount, AActor* TargetActor)
-{
-	// 1. 유효성 체크
-	if (!DamageWidgetClass || !TargetActor) return;
-
-	// 플레이어/아군 체크
-	APawn* TargetPawn = Cast<APawn>(TargetActor);
-	if (!TargetPawn) return;
-	if (TargetPawn->IsPlayerControlled()) return; 
-	if (TargetPawn->ActorHasTag(FName("Player"))) return;
-
-	FVector TextSpawnLocation = TargetActor->GetActorLocation();
-
-	USFEnemyWidgetComponent* HPBarComp = TargetActor->FindComponentByClass<USFEnemyWidgetComponent>();
-
-	if (HPBarComp)
-	{
-		TextSpawnLocation = HPBarComp->GetComponentLocation();
-	}
-	else
-	{
-		ACharacter* TargetCharacter = Cast<ACharacter>(TargetActor);
-		if (TargetCharacter)
-		{
-			TextSpawnLocation.Z += TargetCharacter->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() + 50.0f;
-		}
-	}
-
-	if (PlayerCameraManager)
-	{
-		const FTransform CamTransform = PlayerCameraManager->GetTransform();
-		const FVector CamRight = CamTransform.GetUnitAxis(EAxis::Y);
-		const FVector CamUp = CamTransform.GetUnitAxis(EAxis::Z);
-
-		// 오른쪽 50, 위 40
-		TextSpawnLocation += (CamRight * 50.0f) + (CamUp * 40.0f);
-	}
-
-	USFDamageWidget* NewDamageWidget = CreateWidget<USFDamageWidget>(this, DamageWidgetClass);
-	if (NewDamageWidget)
-	{
-		NewDamageWidget->AddToViewport();
-	}
-}
-
 void ASFPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	// 1. 팀원 검색 타이머 강제 종료
@@ -336,27 +261,7 @@ void ASFPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		World->GetTimerManager().ClearTimer(TeammateSearchTimerHandle);
 	}
 
-	// 2. GameInstance 가져오기 
-	UGameInstance* GI = GetGameInstance();
-
-	// 만약 PC가 이미 연결이 끊겨서 GI를 가져올 수 없다면
-	if (!GI && GetWorld())
-	{
-		// 월드를 통해 강제로 GameInstance를 찾아옴.
-		GI = GetWorld()->GetGameInstance();
-	}
-
-	// GI를 찾았고, 시스템이 살아있다면
-	if (GI)
-	{
-		if (UGameplayMessageSubsystem* MessageSubsystem = GI->GetSubsystem<UGameplayMessageSubsystem>())
-		{
-			// 리스너 해제 (Unregister)
-			MessageSubsystem->UnregisterListener(DamageMessageListenerHandle);
-		}
-	}
-	
-	// 3. 팀원 표시 위젯 정리 (Viewport 참조 해제)
+	// 2. 팀원 표시 위젯 정리 (Viewport 참조 해제)
 	for (auto& Elem : TeammateWidgetMap)
 	{
 		if (Elem.Value)
@@ -2,10 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
-#include "GameFramework/GameplayMessageSubsystem.h"
 #include "GameplayTagContainer.h"
 #include "System/Data/SFStageInfo.h"
-#include "UI/InGame/UIDataStructs.h"
 #include "SFPlayerController.generated.h"
 
 struct FSFPermanentUpgradeData;
@@ -19,13 +17,13 @@ class USFSharedUIComponent;
 class USFDeathUIComponent;
 class USFSpectatorComponent;
 class USFInGameMenuComponent;
+class USFHitAggregatorComponent;
 struct FSFStageInfo;
 class USFSkillSelectionScreen;
 class USFLoadingCheckComponent;
 class ASFPlayerState;
 class USFAbilitySystemComponent;
 class UUserWidget;
-class USFDamageWidget;
 class ULoadingScreenManager;
 
 /**
@@ -101,14 +99,7 @@ protected:
 	// 팀원 위젯 생성 함수
 	void CreateTeammateIndicators();
 	
-	// 몬스터 데미지 텍스트 메세지 함수 (서버 실행)
-	void OnDamageMessageReceived(FGameplayTag Channel, const FSFDamageMessageInfo& Payload);
-
-	// 클라이언트 데미지 텍스트 출력 RPC 함수
-	UFUNCTION(Client, Unreliable)
-	void Client_ShowDamageText(float DamageAmount, AActor* TargetActor);
-	
-	// 게임 졸료 시 리스너 해제 함수 
+	// 게임 종료 시 타이머/팀원 위젯 정리
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UFUNCTION(Server, Reliable)
@@ -165,6 +156,9 @@ private:
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SF|Components", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<USFInGameMenuComponent> InGameMenuComponent;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SF|Components", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<USFHitAggregatorComponent> HitAggregatorComponent;
+
 private:
 	// ViewRotation 전송 최적화 
 	FRotator LastSentViewRotation;
@@ -175,12 +169,4 @@ private:
 
 	// 최소 전송 간격
 	static constexpr float ViewRotationSendInterval = 0.05f;
-	
-	// 리스너 등록증(핸들) 저장 변수
-	FGameplayMessageListenerHandle DamageMessageListenerHandle;
-
-public:
-	// 몬스터 데미지 텍스트 위젯(WBP) 변수
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI|InGame")
-	TSubclassOf<USFDamageWidget> DamageWidgetClass;
 };
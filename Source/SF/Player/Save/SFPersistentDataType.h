@@ -9,17 +9,48 @@
 class UGameplayEffect;
 class UGameplayAbility;
 
+// 어트리뷰트 세트 하나의 Base Value 스냅샷 (Current Value는 버프 재적용으로 자동 계산됨)
+// Values 순서는 FSFAttributeSetSchema::Attributes와 같음
 USTRUCT()
-struct FSFSavedAttribute
+struct FSFSavedAttributeSet
 {
 	GENERATED_BODY()
 
 	UPROPERTY()
-	FGameplayAttribute Attribute;
+	TSubclassOf<UAttributeSet> SetClass;
 
-	//Base Value만 저장 (Current Value는 버프 재적용으로 자동 계산됨)
+	// 저장 당시 스키마 레이아웃 해시. 현재 스키마와 다르면 LayoutNames로 이름 매칭
 	UPROPERTY()
-	float BaseValue = 0.f;
+	uint32 LayoutHash = 0;
+
+	UPROPERTY()
+	TArray<float> Values;
+
+	// 디스크 저장처럼 스키마가 바뀔 수 있는 경우에만 기록 (스테이지 이동 중 메모리 복사에서는 비움)
+	UPROPERTY()
+	TArray<FName> LayoutNames;
+};
+
+// 어트리뷰트 스냅샷 (버전 헤더 + 세트별 float 배열)
+USTRUCT()
+struct FSFSavedAttributeSnapshot
+{
+	GENERATED_BODY()
+
+	// 스냅샷 포맷 버전 (FSFAttributeSnapshotCodec::SnapshotVersion)
+	UPROPERTY()
+	uint16 Version = 0;
+
+	UPROPERTY()
+	TArray<FSFSavedAttributeSet> Sets;
+
+	bool IsEmpty() const { return Sets.Num() == 0; }
+
+	void Reset()
+	{
+		Version = 0;
+		Sets.Reset();
+	}
 };
 
 USTRUCT()
@@ -65,7 +96,7 @@ struct FSFSavedAbilitySystemData
 	GENERATED_BODY()
 
 	UPROPERTY()
-	TArray<FSFSavedAttribute> SavedAttributes;
+	FSFSavedAttributeSnapshot AttributeSnapshot;
 
 	UPROPERTY()
 	TArray<FSFSavedAbility> SavedAbilities;
@@ -73,14 +104,14 @@ struct FSFSavedAbilitySystemData
 	UPROPERTY()
 	TArray<FSFSavedGameplayEffect> SavedGameplayEffects;
 
-	bool HasSavedAttributes() const { return SavedAttributes.Num() > 0; }
+	bool HasSavedAttributes() const { return !AttributeSnapshot.IsEmpty(); }
 	bool HasSavedAbilities() const { return SavedAbilities.Num() > 0; }
 	bool HasSavedEffects() const { return SavedGameplayEffects.Num() > 0; }
 	bool IsValid() const { return HasSavedAttributes() || HasSavedAbilities() || HasSavedEffects(); }
 
 	void Reset()
 	{
-		SavedAttributes.Reset();
+		AttributeSnapshot.Reset();
 		SavedAbilities.Reset();
 		SavedGameplayEffects.Reset();
 	}
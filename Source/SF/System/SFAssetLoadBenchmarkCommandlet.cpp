@@ -0,0 +1,210 @@
+#include "SFAssetLoadBenchmarkCommandlet.h"
+
+#include "SFLogChannels.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "System/SFAssetManager.h"
+#include "Tickable.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFAssetLoadBenchmarkCommandlet)
+
+namespace SFAssetLoadBenchmark
+{
+	struct FPhaseSample
+	{
+		FName PhaseName;
+		double RequestMs = 0.0;
+		double CompleteMs = 0.0;
+
+		// 완료 시점 사용 메모리 / 단계 진행 중 샘플링한 최대 사용 메모리 / 완료 시점 프로세스 최대 사용 메모리
+		uint64 UsedPhysicalAtComplete = 0;
+		uint64 PeakUsedPhysicalDuringPhase = 0;
+		uint64 ProcessPeakUsedPhysical = 0;
+	};
+
+	static double ToMB(uint64 Bytes)
+	{
+		return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+	}
+}
+
+USFAssetLoadBenchmarkCommandlet::USFAssetLoadBenchmarkCommandlet()
+{
+	IsClient = true;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 USFAssetLoadBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace SFAssetLoadBenchmark;
+
+	USFAssetManager& AssetManager = USFAssetManager::Get();
+
+	// 요청할 단계
+	TArray<FName> RequestedPhases;
+	FString PhasesParam;
+	if (FParse::Value(*Params, TEXT("Phases="), PhasesParam, false))
+	{
+		TArray<FString> PhaseStrings;
+		PhasesParam.ParseIntoArray(PhaseStrings, TEXT(","));
+		for (const FString& PhaseString : PhaseStrings)
+		{
+			RequestedPhases.Add(FName(*PhaseString.TrimStartAndEnd()));
+		}
+	}
+	else
+	{
+		for (const FSFAssetLoadPhase& Phase : AssetManager.GetLoadPhases())
+		{
+			if (Phase.bLoadAtStartup)
+			{
+				RequestedPhases.Add(Phase.PhaseName);
+			}
+		}
+	}
+
+	FString TargetParam = USFAssetManager::LoadPhase_Lobby.ToString();
+	FParse::Value(*Params, TEXT("Target="), TargetParam);
+	const FName TargetPhase(*TargetParam);
+
+	int32 NumRuns = 1;
+	FParse::Value(*Params, TEXT("Runs="), NumRuns);
+	NumRuns = FMath::Max(1, NumRuns);
+
+	float Timeout = 120.f;
+	FParse::Value(*Params, TEXT("Timeout="), Timeout);
+
+	FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Profiling") / TEXT("AssetLoadBenchmark.csv");
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+
+	for (const FName& PhaseName : RequestedPhases)
+	{
+		if (!AssetManager.FindLoadPhase(PhaseName))
+		{
+			UE_LOG(LogSF, Error, TEXT("AssetLoadBenchmark: Unknown load phase [%s]"), *PhaseName.ToString());
+			return 1;
+		}
+	}
+
+	FString Csv = TEXT("Run,Phase,RequestMs,CompleteMs,DurationMs,UsedMB,PeakDuringPhaseMB,ProcessPeakMB\n");
+	int32 ExitCode = 0;
+
+	for (int32 Run = 0; Run < NumRuns; ++Run)
+	{
+		// 이전 회차 에셋 해제 후 시작
+		for (const FSFAssetLoadPhase& Phase : AssetManager.GetLoadPhases())
+		{
+			AssetManager.UnloadLoadPhase(Phase.PhaseName);
+		}
+		CollectGarbage(RF_NoFlags);
+
+		TMap<FName, FPhaseSample> Samples;
+		const double StartTime = FPlatformTime::Seconds();
+		const uint64 BaselineUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+		const FDelegateHandle CompletedHandle = AssetManager.OnLoadPhaseCompleted.AddLambda([&Samples, &AssetManager, StartTime](FName PhaseName)
+		{
+			const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+
+			FPhaseSample& Sample = Samples.FindOrAdd(PhaseName);
+			Sample.PhaseName = PhaseName;
+			Sample.UsedPhysicalAtComplete = MemoryStats.UsedPhysical;
+			Sample.PeakUsedPhysicalDuringPhase = FMath::Max<uint64>(Sample.PeakUsedPhysicalDuringPhase, MemoryStats.UsedPhysical);
+			Sample.ProcessPeakUsedPhysical = MemoryStats.PeakUsedPhysical;
+
+			double RequestTime = 0.0;
+			double CompleteTime = 0.0;
+			if (AssetManager.GetLoadPhaseTiming(PhaseName, RequestTime, CompleteTime))
+			{
+				Sample.RequestMs = (RequestTime - StartTime) * 1000.0;
+				Sample.CompleteMs = (CompleteTime - StartTime) * 1000.0;
+			}
+		});
+
+		// 실제 시작과 같은 순서/블로킹 설정으로 요청
+		for (const FName& PhaseName : RequestedPhases)
+		{
+			const FSFAssetLoadPhase* Phase = AssetManager.FindLoadPhase(PhaseName);
+			AssetManager.RequestLoadPhase(PhaseName, FStreamableDelegate(), Phase && Phase->bBlocking);
+		}
+
+		// 엔진 루프 대신 비동기 로딩/티커를 직접 펌프
+		TArray<FName> PendingPhases;
+		double LastTime = StartTime;
+		while (AssetManager.HasPendingLoadPhases())
+		{
+			const double Now = FPlatformTime::Seconds();
+			if (Now - StartTime > Timeout)
+			{
+				AssetManager.GetPendingLoadPhases(PendingPhases);
+				UE_LOG(LogSF, Error, TEXT("AssetLoadBenchmark: Run %d timed out after %.1fs waiting for [%s]"), Run, Timeout,
+					*FString::JoinBy(PendingPhases, TEXT(", "), [](const FName& PhaseName) { return PhaseName.ToString(); }));
+				ExitCode = 1;
+				break;
+			}
+
+			const float DeltaTime = static_cast<float>(Now - LastTime);
+			LastTime = Now;
+
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			ProcessAsyncLoading(true, false, 0.005f);
+			FTSTicker::GetCoreTicker().Tick(DeltaTime);
+			FTickableGameObject::TickObjects(nullptr, LEVELTICK_All, false, DeltaTime);
+
+			const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+			AssetManager.GetPendingLoadPhases(PendingPhases);
+			for (const FName& PhaseName : PendingPhases)
+			{
+				FPhaseSample& Sample = Samples.FindOrAdd(PhaseName);
+				Sample.PeakUsedPhysicalDuringPhase = FMath::Max(Sample.PeakUsedPhysicalDuringPhase, UsedPhysical);
+			}
+
+			FPlatformProcess::Sleep(0.f);
+		}
+
+		AssetManager.OnLoadPhaseCompleted.Remove(CompletedHandle);
+
+		// 결과 (단계 선언 순서)
+		UE_LOG(LogSF, Display, TEXT("AssetLoadBenchmark: Run %d (baseline %.1f MB)"), Run, ToMB(BaselineUsedPhysical));
+		for (const FSFAssetLoadPhase& Phase : AssetManager.GetLoadPhases())
+		{
+			const FPhaseSample* Sample = Samples.Find(Phase.PhaseName);
+			if (!Sample || !AssetManager.IsLoadPhaseLoaded(Phase.PhaseName))
+			{
+				continue;
+			}
+
+			UE_LOG(LogSF, Display, TEXT("  %-12s request %8.2f ms, complete %8.2f ms (%8.2f ms), used %8.1f MB, peak %8.1f MB, process peak %8.1f MB"),
+				*Phase.PhaseName.ToString(), Sample->RequestMs, Sample->CompleteMs, Sample->CompleteMs - Sample->RequestMs,
+				ToMB(Sample->UsedPhysicalAtComplete), ToMB(Sample->PeakUsedPhysicalDuringPhase), ToMB(Sample->ProcessPeakUsedPhysical));
+
+			Csv += FString::Printf(TEXT("%d,%s,%.3f,%.3f,%.3f,%.2f,%.2f,%.2f\n"), Run, *Phase.PhaseName.ToString(),
+				Sample->RequestMs, Sample->CompleteMs, Sample->CompleteMs - Sample->RequestMs,
+				ToMB(Sample->UsedPhysicalAtComplete), ToMB(Sample->PeakUsedPhysicalDuringPhase), ToMB(Sample->ProcessPeakUsedPhysical));
+		}
+
+		if (const FPhaseSample* TargetSample = Samples.Find(TargetPhase))
+		{
+			UE_LOG(LogSF, Display, TEXT("AssetLoadBenchmark: Run %d time to [%s] %.2f ms"), Run, *TargetPhase.ToString(), TargetSample->CompleteMs);
+		}
+		else
+		{
+			UE_LOG(LogSF, Warning, TEXT("AssetLoadBenchmark: Run %d never completed target phase [%s]"), Run, *TargetPhase.ToString());
+		}
+	}
+
+	if (FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		UE_LOG(LogSF, Display, TEXT("AssetLoadBenchmark: Wrote %s"), *CsvPath);
+	}
+	else
+	{
+		UE_LOG(LogSF, Error, TEXT("AssetLoadBenchmark: Failed to write %s"), *CsvPath);
+	}
+
+	return ExitCode;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SFAssetLoadBenchmarkCommandlet.generated.h"
+
+/**
+ * USFAssetLoadBenchmarkCommandlet
+ * USFAssetManager 로드 단계를 헤드리스로 실행하고 단계별 시간/메모리를 기록
+ * - 실행: UnrealEditor-Cmd SF.uproject -run=SFAssetLoadBenchmark -nullrhi -unattended
+ * - -Phases=Critical,Lobby   요청할 단계 (기본: bLoadAtStartup 단계 전부, 의존 단계는 자동 포함)
+ * - -Target=Lobby            time-to-lobby 기준 단계 (기본 Lobby)
+ * - -Runs=N                  반복 횟수 (회차 사이에 단계 언로드 + GC)
+ * - -Timeout=120             회차별 최대 대기 시간(초)
+ * - -Csv=Path                결과 CSV 경로 (기본 Saved/Profiling/AssetLoadBenchmark.csv)
+ */
+UCLASS()
+class SF_API USFAssetLoadBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USFAssetLoadBenchmarkCommandlet();
+
+	//~UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	//~End of UCommandlet interface
+};
@@ -1,15 +1,27 @@
 #include "SFAssetManager.h"
 
 #include "SFLogChannels.h"
+#include "AbilitySystem/Attributes/SFAttributeSnapshotCodec.h"
 #include "Character/Hero/SFHeroDefinition.h"
 #include "Data/Common/SFCommonLootTable.h"
 #include "Data/Common/SFCommonRarityConfig.h"
 #include "Data/Common/SFCommonUpgradeDefinition.h"
 
+const FName USFAssetManager::LoadPhase_Critical(TEXT("Critical"));
+const FName USFAssetManager::LoadPhase_Definitions(TEXT("Definitions"));
+const FName USFAssetManager::LoadPhase_Lobby(TEXT("Lobby"));
+const FName USFAssetManager::LoadPhase_InGame(TEXT("InGame"));
+
 void USFAssetManager::StartInitialLoading()
 {
+	// 스캔이 끝나면 PostInitialAssetScan에서 바로 단계를 요청하므로 스캔 전에 구성
+	BuildLoadPhases();
+
 	Super::StartInitialLoading();
 
+	// 스테이지 이동마다 쓰는 어트리뷰트 스냅샷 스키마를 미리 컴파일
+	FSFAttributeSnapshotCodec::CompileAllSchemas();
+
 	GetGameData();
     GetItemData();
     GetUIData();
@@ -24,7 +36,11 @@ void USFAssetManager::PostInitialAssetScan()
 {
 	Super::PostInitialAssetScan();
 
-	LoadAllPrimaryAssets();
+	// 커맨드렛(쿠크, SFAssetLoadBenchmark)은 필요할 때 직접 요청
+	if (!IsRunningCommandlet())
+	{
+		RequestStartupLoadPhases();
+	}
 }
 
 #if WITH_EDITOR
@@ -35,10 +51,7 @@ void USFAssetManager::PreBeginPIE(bool bStartSimulate)
 	GetGameData();
     GetItemData();
     GetUIData();
-	if (!AreLobbyAssetsLoaded())
-	{
-		LoadAllPrimaryAssets();
-	}
+	RequestStartupLoadPhases();
 }
 #endif
 
@@ -84,62 +97,432 @@ TArray<FPrimaryAssetType> USFAssetManager::GetManagedPrimaryAssetTypes() const
 }
 
 //////////////////////////////////////////////////////////////////////////
-//                          초기 로딩
+//                          Load Phase
 //////////////////////////////////////////////////////////////////////////
 
-void USFAssetManager::LoadAllPrimaryAssets()
+void USFAssetManager::BuildLoadPhases()
 {
-#if WITH_EDITOR
-    FScopedSlowTask SlowTask(0, NSLOCTEXT("SFEditor", "LoadingAssets", "Loading Primary Assets..."));
-    SlowTask.MakeDialog(false, true);
-#endif
+    ResolvedLoadPhases.Reset();
 
-    UE_LOG(LogSF, Log, TEXT("Loading All PrimaryAssets..."));
-    SCOPE_LOG_TIME_IN_SECONDS(TEXT("    ... PrimaryAssets loaded!"), nullptr);
+    if (LoadPhases.Num() > 0)
+    {
+        for (const FSFAssetLoadPhase& Phase : LoadPhases)
+        {
+            if (Phase.PhaseName.IsNone() || FindLoadPhase(Phase.PhaseName))
+            {
+                UE_LOG(LogSF, Warning, TEXT("Load phase [%s] has no name or is declared twice, skipping"), *Phase.PhaseName.ToString());
+                continue;
+            }
+            ResolvedLoadPhases.Add(Phase);
+        }
+    }
+    else
+    {
+        const TArray<FPrimaryAssetType> ManagedTypes = GetManagedPrimaryAssetTypes();
+
+        // CommonUpgradeManagerSubsystem::Initialize에서 바로 읽는 데이터 → GameInstance 생성 전에 완료되어야 함
+        FSFAssetLoadPhase Critical;
+        Critical.PhaseName = LoadPhase_Critical;
+        Critical.AssetTypes.Add(USFCommonRarityConfig::GetCommonRarityConfigAssetType());
+        Critical.bLoadAtStartup = true;
+        Critical.bBlocking = true;
+        ResolvedLoadPhases.Add(Critical);
+
+        FSFAssetLoadPhase Definitions;
+        Definitions.PhaseName = LoadPhase_Definitions;
+        Definitions.AssetTypes.Add(USFHeroDefinition::GetHeroDefinitionAssetType());
+        Definitions.AssetTypes.Add(USFCommonUpgradeDefinition::GetCommonUpgradeDefinitionAssetType());
+        Definitions.AssetTypes.Add(USFCommonLootTable::GetCommonLootTableAssetType());
+        Definitions.Dependencies.Add(LoadPhase_Critical);
+        Definitions.bLoadAtStartup = true;
+        ResolvedLoadPhases.Add(Definitions);
+
+        // 로비 표시용 번들 (영웅 아이콘/디스플레이 메시)
+        FSFAssetLoadPhase Lobby;
+        Lobby.PhaseName = LoadPhase_Lobby;
+        Lobby.AssetTypes = ManagedTypes;
+        Lobby.Bundles.Add(TEXT("Lobby"));
+        Lobby.Dependencies.Add(LoadPhase_Definitions);
+        Lobby.bLoadAtStartup = true;
+        Lobby.bClientOnly = true;
+        ResolvedLoadPhases.Add(Lobby);
+
+        // 인게임 번들은 스테이지 진입 시 SFStageSubsystem이 요청
+        FSFAssetLoadPhase InGame;
+        InGame.PhaseName = LoadPhase_InGame;
+        InGame.AssetTypes = ManagedTypes;
+        InGame.Bundles.Add(TEXT("InGame"));
+        InGame.Dependencies.Add(LoadPhase_Definitions);
+        ResolvedLoadPhases.Add(InGame);
+    }
 
-    TArray<FPrimaryAssetType> ManagedTypes = GetManagedPrimaryAssetTypes();
+    // 없는 단계에 대한 의존성 제거
+    for (FSFAssetLoadPhase& Phase : ResolvedLoadPhases)
+    {
+        for (int32 Index = Phase.Dependencies.Num() - 1; Index >= 0; --Index)
+        {
+            const FName Dependency = Phase.Dependencies[Index];
+            if (Dependency == Phase.PhaseName || !FindLoadPhase(Dependency))
+            {
+                UE_LOG(LogSF, Warning, TEXT("Load phase [%s] depends on unknown phase [%s], ignoring"), *Phase.PhaseName.ToString(), *Dependency.ToString());
+                Phase.Dependencies.RemoveAt(Index);
+            }
+        }
+    }
 
-    // 1단계: 모든 PrimaryAsset 타입 동기 로드
-    for (const FPrimaryAssetType& AssetType : ManagedTypes)
+    // 순환 의존성 검사: 의존 단계가 모두 정렬된 단계부터 차례로 제거
+    TSet<FName> Resolved;
+    bool bProgress = true;
+    while (bProgress && Resolved.Num() < ResolvedLoadPhases.Num())
     {
-        TSharedPtr<FStreamableHandle> Handle = LoadPrimaryAssetsWithType(AssetType);
-        if (Handle.IsValid())
+        bProgress = false;
+        for (const FSFAssetLoadPhase& Phase : ResolvedLoadPhases)
         {
-            Handle->WaitUntilComplete(0.0f, false);
-            PrimaryAssetHandles.Add(AssetType, Handle);
+            if (Resolved.Contains(Phase.PhaseName))
+            {
+                continue;
+            }
 
-            TArray<FPrimaryAssetId> AssetIds;
-            GetPrimaryAssetIdList(AssetType, AssetIds);
-            UE_LOG(LogSF, Log, TEXT("  - %s: %d assets loaded"), *AssetType.ToString(), AssetIds.Num());
+            const bool bDependenciesResolved = !Phase.Dependencies.ContainsByPredicate([&Resolved](const FName& Dependency)
+            {
+                return !Resolved.Contains(Dependency);
+            });
+            if (bDependenciesResolved)
+            {
+                Resolved.Add(Phase.PhaseName);
+                bProgress = true;
+            }
         }
     }
 
-    // 2단계: Lobby 번들 동기 로드(현재는 메인 메뉴 진입시에 Lobby에 필요한 에셋 번들 로드)
-    TArray<FPrimaryAssetId> AllAssetIds;
-    for (const FPrimaryAssetType& AssetType : ManagedTypes)
+    // 순환에 걸린 단계는 의존성 없이 로드 (영원히 대기하지 않도록)
+    for (FSFAssetLoadPhase& Phase : ResolvedLoadPhases)
+    {
+        if (!Resolved.Contains(Phase.PhaseName))
+        {
+            UE_LOG(LogSF, Error, TEXT("Load phase [%s] is part of a dependency cycle, dependencies ignored"), *Phase.PhaseName.ToString());
+            Phase.Dependencies.Reset();
+        }
+    }
+}
+
+const TArray<FSFAssetLoadPhase>& USFAssetManager::GetLoadPhases() const
+{
+    return ResolvedLoadPhases;
+}
+
+const FSFAssetLoadPhase* USFAssetManager::FindLoadPhase(FName PhaseName) const
+{
+    return ResolvedLoadPhases.FindByPredicate([PhaseName](const FSFAssetLoadPhase& Phase)
+    {
+        return Phase.PhaseName == PhaseName;
+    });
+}
+
+void USFAssetManager::RequestStartupLoadPhases()
+{
+    const bool bDedicatedServer = IsRunningDedicatedServer();
+
+    for (const FSFAssetLoadPhase& Phase : ResolvedLoadPhases)
+    {
+        if (!Phase.bLoadAtStartup || (Phase.bClientOnly && bDedicatedServer))
+        {
+            continue;
+        }
+        RequestLoadPhase(Phase.PhaseName, FStreamableDelegate(), Phase.bBlocking);
+    }
+}
+
+void USFAssetManager::RequestLoadPhase(FName PhaseName, const FStreamableDelegate& OnComplete, bool bBlockUntilLoaded)
+{
+    const FSFAssetLoadPhase* Phase = FindLoadPhase(PhaseName);
+    if (!Phase)
+    {
+        UE_LOG(LogSF, Warning, TEXT("Load phase [%s] is not declared!"), *PhaseName.ToString());
+        OnComplete.ExecuteIfBound();
+        return;
+    }
+
+    {
+        FLoadPhaseRuntime& Runtime = LoadPhaseRuntimes.FindOrAdd(PhaseName);
+        if (Runtime.State == ELoadPhaseState::Loaded)
+        {
+            OnComplete.ExecuteIfBound();
+            return;
+        }
+
+        if (OnComplete.IsBound())
+        {
+            Runtime.PendingCallbacks.Add(OnComplete);
+        }
+
+        if (Runtime.State == ELoadPhaseState::NotRequested)
+        {
+            Runtime.State = ELoadPhaseState::WaitingForDependencies;
+            Runtime.RequestTime = FPlatformTime::Seconds();
+        }
+    }
+
+    // 의존 단계 먼저 요청 (완료되면 StartWaitingLoadPhases에서 이 단계가 시작됨)
+    for (const FName& Dependency : Phase->Dependencies)
+    {
+        RequestLoadPhase(Dependency, FStreamableDelegate(), bBlockUntilLoaded);
+    }
+
+    // 의존 단계 요청 중 맵이 재할당될 수 있으므로 다시 찾음
+    FLoadPhaseRuntime& Runtime = LoadPhaseRuntimes.FindChecked(PhaseName);
+    if (Runtime.State == ELoadPhaseState::WaitingForDependencies && AreLoadPhaseDependenciesLoaded(*Phase))
+    {
+        StartLoadPhase(*Phase);
+    }
+
+    FLoadPhaseRuntime& StartedRuntime = LoadPhaseRuntimes.FindChecked(PhaseName);
+    if (bBlockUntilLoaded && StartedRuntime.State == ELoadPhaseState::Loading && StartedRuntime.Handle.IsValid())
+    {
+        StartedRuntime.Handle->WaitUntilComplete(0.0f, false);
+        OnLoadPhaseLoaded(PhaseName);
+    }
+}
+
+bool USFAssetManager::AreLoadPhaseDependenciesLoaded(const FSFAssetLoadPhase& Phase) const
+{
+    for (const FName& Dependency : Phase.Dependencies)
+    {
+        if (!IsLoadPhaseLoaded(Dependency))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void USFAssetManager::StartLoadPhase(const FSFAssetLoadPhase& Phase)
+{
+    TArray<FPrimaryAssetId> AssetIds;
+    for (const FPrimaryAssetType& AssetType : Phase.AssetTypes)
     {
         TArray<FPrimaryAssetId> TypeAssetIds;
         GetPrimaryAssetIdList(AssetType, TypeAssetIds);
-        AllAssetIds.Append(TypeAssetIds);
+        AssetIds.Append(TypeAssetIds);
+    }
+
+    UE_LOG(LogSF, Log, TEXT("Load phase [%s] started: %d assets, bundles [%s]"),
+        *Phase.PhaseName.ToString(), AssetIds.Num(), *FString::JoinBy(Phase.Bundles, TEXT(", "), [](const FName& Bundle) { return Bundle.ToString(); }));
+
+    FLoadPhaseRuntime& Runtime = LoadPhaseRuntimes.FindChecked(Phase.PhaseName);
+    Runtime.State = ELoadPhaseState::Loading;
+    Runtime.StartTime = FPlatformTime::Seconds();
+
+    if (AssetIds.Num() > 0)
+    {
+        Runtime.Handle = LoadPrimaryAssets(AssetIds, Phase.Bundles, FStreamableDelegate::CreateUObject(this, &USFAssetManager::OnLoadPhaseLoaded, Phase.PhaseName));
     }
 
-    if (AllAssetIds.Num() > 0)
+    // 로드할 에셋이 없거나 이미 메모리에 있으면 핸들이 없거나 완료 상태로 반환됨
+    if (!Runtime.Handle.IsValid() || Runtime.Handle->HasLoadCompleted())
     {
-        TArray<FName> BundlesToLoad;
-        BundlesToLoad.Add(TEXT("Lobby"));
+        OnLoadPhaseLoaded(Phase.PhaseName);
+    }
+}
 
-        TSharedPtr<FStreamableHandle> LobbyHandle = LoadPrimaryAssets(AllAssetIds, BundlesToLoad);
-        if (LobbyHandle.IsValid())
+void USFAssetManager::OnLoadPhaseLoaded(FName PhaseName)
+{
+    FLoadPhaseRuntime* Runtime = LoadPhaseRuntimes.Find(PhaseName);
+    const FSFAssetLoadPhase* Phase = FindLoadPhase(PhaseName);
+    if (!Runtime || !Phase || Runtime->State != ELoadPhaseState::Loading)
+    {
+        return;
+    }
+
+    // 언로드 후 다시 요청된 경우 이전 핸들의 지연 콜백은 무시
+    if (Runtime->Handle.IsValid() && !Runtime->Handle->HasLoadCompleted())
+    {
+        return;
+    }
+
+    Runtime->State = ELoadPhaseState::Loaded;
+    Runtime->CompleteTime = FPlatformTime::Seconds();
+
+    UE_LOG(LogSF, Log, TEXT("Load phase [%s] complete: %.2f ms (%.2f ms since request)"),
+        *PhaseName.ToString(), (Runtime->CompleteTime - Runtime->StartTime) * 1000.0, (Runtime->CompleteTime - Runtime->RequestTime) * 1000.0);
+
+    // 기존 타입/번들 API(IsPrimaryAssetTypeLoaded, IsBundleLoaded, LoadBundle)도 단계 핸들을 보도록 등록
+    if (Phase->Bundles.Num() == 0)
+    {
+        for (const FPrimaryAssetType& AssetType : Phase->AssetTypes)
+        {
+            PrimaryAssetHandles.Add(AssetType, Runtime->Handle);
+        }
+    }
+    else
+    {
+        for (const FName& Bundle : Phase->Bundles)
         {
-            LobbyHandle->WaitUntilComplete(0.0f, false);
+            BundleHandles.Add(Bundle, Runtime->Handle);
+            BundleAssetTypes.Add(Bundle, Phase->AssetTypes);
         }
-        BundleHandles.Add(TEXT("Lobby"), LobbyHandle);
-        BundleAssetTypes.Add(TEXT("Lobby"), ManagedTypes);
+    }
+
+    TArray<FStreamableDelegate> Callbacks = MoveTemp(Runtime->PendingCallbacks);
+
+    for (const FName& Bundle : Phase->Bundles)
+    {
+        OnBundleLoaded(Bundle);
+    }
+
+    // 이 단계를 기다리던 단계 시작
+    StartWaitingLoadPhases();
 
-        OnBundleLoaded(TEXT("Lobby"));
+    OnLoadPhaseCompleted.Broadcast(PhaseName);
+    for (const FStreamableDelegate& Callback : Callbacks)
+    {
+        Callback.ExecuteIfBound();
     }
 }
 
+void USFAssetManager::StartWaitingLoadPhases()
+{
+    for (const FSFAssetLoadPhase& Phase : ResolvedLoadPhases)
+    {
+        const FLoadPhaseRuntime* Runtime = LoadPhaseRuntimes.Find(Phase.PhaseName);
+        if (Runtime && Runtime->State == ELoadPhaseState::WaitingForDependencies && AreLoadPhaseDependenciesLoaded(Phase))
+        {
+            StartLoadPhase(Phase);
+        }
+    }
+}
+
+void USFAssetManager::UnloadLoadPhase(FName PhaseName)
+{
+    FLoadPhaseRuntime* Runtime = LoadPhaseRuntimes.Find(PhaseName);
+    const FSFAssetLoadPhase* Phase = FindLoadPhase(PhaseName);
+    if (!Runtime || !Phase || Runtime->State == ELoadPhaseState::NotRequested)
+    {
+        return;
+    }
+
+    UE_LOG(LogSF, Log, TEXT("Unloading load phase [%s]..."), *PhaseName.ToString());
+
+    if (Phase->Bundles.Num() == 0)
+    {
+        for (const FPrimaryAssetType& AssetType : Phase->AssetTypes)
+        {
+            const TSharedPtr<FStreamableHandle>* Handle = PrimaryAssetHandles.Find(AssetType);
+            if (Handle && *Handle == Runtime->Handle)
+            {
+                PrimaryAssetHandles.Remove(AssetType);
+            }
+        }
+    }
+    else
+    {
+        for (const FName& Bundle : Phase->Bundles)
+        {
+            BundleHandles.Remove(Bundle);
+            BundleAssetTypes.Remove(Bundle);
+        }
+    }
+
+    if (Runtime->Handle.IsValid())
+    {
+        if (Runtime->State == ELoadPhaseState::Loading)
+        {
+            Runtime->Handle->CancelHandle();
+        }
+        else
+        {
+            Runtime->Handle->ReleaseHandle();
+        }
+    }
+
+    if (Runtime->PendingCallbacks.Num() > 0)
+    {
+        UE_LOG(LogSF, Warning, TEXT("Load phase [%s] unloaded with %d pending callbacks"), *PhaseName.ToString(), Runtime->PendingCallbacks.Num());
+    }
+
+    *Runtime = FLoadPhaseRuntime();
+}
+
+bool USFAssetManager::IsLoadPhaseLoaded(FName PhaseName) const
+{
+    const FLoadPhaseRuntime* Runtime = LoadPhaseRuntimes.Find(PhaseName);
+    return Runtime && Runtime->State == ELoadPhaseState::Loaded;
+}
+
+float USFAssetManager::GetLoadPhaseProgress(FName PhaseName) const
+{
+    const FLoadPhaseRuntime* Runtime = LoadPhaseRuntimes.Find(PhaseName);
+    if (!Runtime)
+    {
+        return 0.f;
+    }
+
+    switch (Runtime->State)
+    {
+    case ELoadPhaseState::Loaded:
+        return 1.f;
+    case ELoadPhaseState::Loading:
+        return Runtime->Handle.IsValid() ? Runtime->Handle->GetProgress() : 0.f;
+    default:
+        return 0.f;
+    }
+}
+
+bool USFAssetManager::HasPendingLoadPhases() const
+{
+    for (const TPair<FName, FLoadPhaseRuntime>& Pair : LoadPhaseRuntimes)
+    {
+        if (Pair.Value.State == ELoadPhaseState::WaitingForDependencies || Pair.Value.State == ELoadPhaseState::Loading)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void USFAssetManager::GetPendingLoadPhases(TArray<FName>& OutPhaseNames) const
+{
+    OutPhaseNames.Reset();
+    for (const FSFAssetLoadPhase& Phase : ResolvedLoadPhases)
+    {
+        const FLoadPhaseRuntime* Runtime = LoadPhaseRuntimes.Find(Phase.PhaseName);
+        if (Runtime && (Runtime->State == ELoadPhaseState::WaitingForDependencies || Runtime->State == ELoadPhaseState::Loading))
+        {
+            OutPhaseNames.Add(Phase.PhaseName);
+        }
+    }
+}
+
+float USFAssetManager::GetPendingLoadProgress() const
+{
+    TArray<FName> PendingPhases;
+    GetPendingLoadPhases(PendingPhases);
+    if (PendingPhases.Num() == 0)
+    {
+        return 1.f;
+    }
+
+    float Progress = 0.f;
+    for (const FName& PhaseName : PendingPhases)
+    {
+        Progress += GetLoadPhaseProgress(PhaseName);
+    }
+    return Progress / PendingPhases.Num();
+}
+
+bool USFAssetManager::GetLoadPhaseTiming(FName PhaseName, double& OutRequestTime, double& OutCompleteTime) const
+{
+    const FLoadPhaseRuntime* Runtime = LoadPhaseRuntimes.Find(PhaseName);
+    if (!Runtime || Runtime->State != ELoadPhaseState::Loaded)
+    {
+        return false;
+    }
+
+    OutRequestTime = Runtime->RequestTime;
+    OutCompleteTime = Runtime->CompleteTime;
+    return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 //                    PrimaryAsset 타입 관리
 //////////////////////////////////////////////////////////////////////////
@@ -369,12 +752,12 @@ bool USFAssetManager::IsBundleLoaded(FName BundleName) const
 
 void USFAssetManager::LoadLobbyAssets(const FStreamableDelegate& OnComplete)
 {
-    LoadBundle(TEXT("Lobby"), GetManagedPrimaryAssetTypes(), OnComplete);
+    RequestLoadPhase(LoadPhase_Lobby, OnComplete);
 }
 
 void USFAssetManager::LoadInGameAssets(const FStreamableDelegate& OnComplete)
 {
-    LoadBundle(TEXT("InGame"), GetManagedPrimaryAssetTypes(), OnComplete);
+    RequestLoadPhase(LoadPhase_InGame, OnComplete);
 }
 
 //////////////////////////////////////////////////////////////////////////
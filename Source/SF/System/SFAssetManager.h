@@ -16,7 +16,48 @@ class USFPawnData;
 class USFHeroDefinition;
 
 /**
- * 
+ * 에셋 로드 단계 선언 (DefaultGame.ini의 [/Script/SF.SFAssetManager] LoadPhases로 덮어쓸 수 있음)
+ * Dependencies의 단계가 모두 로드된 뒤 AssetTypes의 PrimaryAsset(+Bundles)을 비동기 로드
+ */
+USTRUCT()
+struct FSFAssetLoadPhase
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName PhaseName;
+
+	UPROPERTY()
+	TArray<FPrimaryAssetType> AssetTypes;
+
+	// 함께 로드할 번들 (비어 있으면 PrimaryAsset 자체만 로드)
+	UPROPERTY()
+	TArray<FName> Bundles;
+
+	// 먼저 로드가 끝나야 하는 단계
+	UPROPERTY()
+	TArray<FName> Dependencies;
+
+	// 게임 시작(PostInitialAssetScan) 시 요청
+	UPROPERTY()
+	bool bLoadAtStartup = false;
+
+	// 시작 시 완료까지 대기. 서브시스템 Initialize에서 바로 읽는 데이터만 사용
+	UPROPERTY()
+	bool bBlocking = false;
+
+	// 데디케이티드 서버에서는 시작 시 요청하지 않음 (아이콘/메시 등 표시용 번들)
+	UPROPERTY()
+	bool bClientOnly = false;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FSFOnAssetLoadPhaseCompleted, FName /*PhaseName*/);
+
+/**
+ * USFAssetManager
+ * - GameData/ItemData/UIData는 시작 시 동기 로드
+ * - PrimaryAsset/번들은 FSFAssetLoadPhase 단위로 비동기 로드 (Critical → Definitions → Lobby / InGame)
+ * - 진행 중인 단계는 USFLoadingScreenSubsystem이 로딩 화면 유지 조건으로 사용
  */
 UCLASS(Config=Game)
 class SF_API USFAssetManager : public UAssetManager
@@ -61,14 +102,46 @@ public:
 	void UnloadBundle(FName BundleName);
 	bool IsBundleLoaded(FName BundleName) const;
 
+	// ===== Load Phase 관리 =====
+	static const FName LoadPhase_Critical;
+	static const FName LoadPhase_Definitions;
+	static const FName LoadPhase_Lobby;
+	static const FName LoadPhase_InGame;
+
+	// 의존 단계부터 차례로 비동기 로드 (bBlockUntilLoaded면 의존 단계까지 완료 대기)
+	void RequestLoadPhase(FName PhaseName, const FStreamableDelegate& OnComplete = FStreamableDelegate(), bool bBlockUntilLoaded = false);
+	void UnloadLoadPhase(FName PhaseName);
+	bool IsLoadPhaseLoaded(FName PhaseName) const;
+
+	// 0~1 (의존 대기 중이면 0)
+	float GetLoadPhaseProgress(FName PhaseName) const;
+
+	// 요청되었지만 아직 완료되지 않은 단계
+	bool HasPendingLoadPhases() const;
+	void GetPendingLoadPhases(TArray<FName>& OutPhaseNames) const;
+
+	// 진행 중인 단계들의 평균 진행률 (진행 중인 단계가 없으면 1)
+	float GetPendingLoadProgress() const;
+
+	// 요청 ~ 완료 시각 (FPlatformTime::Seconds). 완료 전이면 false
+	bool GetLoadPhaseTiming(FName PhaseName, double& OutRequestTime, double& OutCompleteTime) const;
+
+	const TArray<FSFAssetLoadPhase>& GetLoadPhases() const;
+	const FSFAssetLoadPhase* FindLoadPhase(FName PhaseName) const;
+
+	// bLoadAtStartup 단계 요청 (벤치마크 커맨드렛에서 재실행 가능)
+	void RequestStartupLoadPhases();
+
+	FSFOnAssetLoadPhaseCompleted OnLoadPhaseCompleted;
+
 	// Lobby 에셋 관련 래퍼 함수들
 	void LoadLobbyAssets(const FStreamableDelegate& OnComplete = FStreamableDelegate());
-	void UnloadLobbyAssets() { UnloadBundle(TEXT("Lobby")); }
-	bool AreLobbyAssetsLoaded() const { return IsBundleLoaded(TEXT("Lobby")); }
+	void UnloadLobbyAssets() { UnloadLoadPhase(LoadPhase_Lobby); }
+	bool AreLobbyAssetsLoaded() const { return IsLoadPhaseLoaded(LoadPhase_Lobby); }
 
 	void LoadInGameAssets(const FStreamableDelegate& OnComplete = FStreamableDelegate());
-	void UnloadInGameAssets() { UnloadBundle(TEXT("InGame")); }
-	bool AreInGameAssetsLoaded() const { return IsBundleLoaded(TEXT("InGame")); }
+	void UnloadInGameAssets() { UnloadLoadPhase(LoadPhase_InGame); }
+	bool AreInGameAssetsLoaded() const { return IsLoadPhaseLoaded(LoadPhase_InGame); }
 	
 
 protected:
@@ -93,7 +166,12 @@ protected:
 	
 private:
 	
-	void LoadAllPrimaryAssets();
+	void BuildLoadPhases();
+	bool AreLoadPhaseDependenciesLoaded(const FSFAssetLoadPhase& Phase) const;
+	void StartLoadPhase(const FSFAssetLoadPhase& Phase);
+	void OnLoadPhaseLoaded(FName PhaseName);
+	void StartWaitingLoadPhases();
+
 	void OnPrimaryAssetTypeLoaded(FPrimaryAssetType AssetType);
 	void OnBundleLoaded(FName BundleName);
 	TArray<FPrimaryAssetType> GetManagedPrimaryAssetTypes() const;
@@ -109,6 +187,10 @@ protected:
 	UPROPERTY(Config)
 	TSoftObjectPtr<USFItemData> UIDataPath;
 
+	// 비어 있으면 코드 기본값 사용 (BuildLoadPhases)
+	UPROPERTY(Config)
+	TArray<FSFAssetLoadPhase> LoadPhases;
+
 	UPROPERTY(Transient)
 	TMap<TObjectPtr<UClass>, TObjectPtr<UPrimaryDataAsset>> GameDataMap;
 
@@ -120,6 +202,28 @@ protected:
 	FCriticalSection LoadedAssetsCritical;
 
 private:
+	enum class ELoadPhaseState : uint8
+	{
+		NotRequested,
+		WaitingForDependencies,
+		Loading,
+		Loaded
+	};
+
+	struct FLoadPhaseRuntime
+	{
+		ELoadPhaseState State = ELoadPhaseState::NotRequested;
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<FStreamableDelegate> PendingCallbacks;
+		double RequestTime = 0.0;
+		double StartTime = 0.0;
+		double CompleteTime = 0.0;
+	};
+
+	// 의존성 검증이 끝난 단계 목록 (LoadPhases 또는 기본값)
+	TArray<FSFAssetLoadPhase> ResolvedLoadPhases;
+	TMap<FName, FLoadPhaseRuntime> LoadPhaseRuntimes;
+
 	// ===== PrimaryAsset Handles (타입별 관리) =====
 	TMap<FPrimaryAssetType, TSharedPtr<FStreamableHandle>> PrimaryAssetHandles;
 	TMap<FPrimaryAssetType, FStreamableDelegate> PendingPrimaryAssetCallbacks;
@@ -0,0 +1,152 @@
+#include "SFCombatBenchmarkBotController.h"
+
+#include "AbilitySystem/SFAbilitySystemComponent.h"
+#include "Character/Enemy/SFEnemy.h"
+#include "GameModes/SFEnemyManagerComponent.h"
+#include "GameModes/SFGameState.h"
+#include "Input/SFInputGameplayTags.h"
+#include "Player/SFPlayerState.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFCombatBenchmarkBotController)
+
+ASFCombatBenchmarkBotController::ASFCombatBenchmarkBotController(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bWantsPlayerState = true;
+	bStopAILogicOnUnposses = false;
+
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = true;
+}
+
+void ASFCombatBenchmarkBotController::InitBot(const TArray<FGameplayTag>& InputTags, int32 IntervalFrames, int32 PhaseOffset, float InEngageDistance)
+{
+	ConfiguredInputTags = InputTags;
+	AbilityInputTags.Reset();
+	bInputTagsResolved = false;
+	AbilityIntervalFrames = FMath::Max(1, IntervalFrames);
+	FramesSinceInput = PhaseOffset % AbilityIntervalFrames;
+	NextInputIndex = PhaseOffset;
+	EngageDistance = FMath::Max(0.f, InEngageDistance);
+}
+
+void ASFCombatBenchmarkBotController::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	APawn* Hero = GetPawn();
+	USFAbilitySystemComponent* ASC = GetHeroAbilitySystemComponent();
+	if (!Hero || !ASC)
+	{
+		return;
+	}
+
+	// 영웅 어빌리티가 부여된 뒤 한 번만 결정
+	if (!bInputTagsResolved && !ASC->GetActivatableAbilities().IsEmpty())
+	{
+		ResolveAbilityInputTags(*ASC);
+	}
+
+	// 누른 입력은 다음 프레임에 뗌 (탭 입력)
+	if (HeldInputTag.IsValid())
+	{
+		ASC->AbilityInputTagReleased(HeldInputTag);
+		HeldInputTag = FGameplayTag();
+	}
+
+	if (const ASFEnemy* Target = FindNearestEnemy(Hero->GetActorLocation()))
+	{
+		const FVector ToTarget = Target->GetActorLocation() - Hero->GetActorLocation();
+		SetFocalPoint(Target->GetActorLocation());
+
+		if (ToTarget.SizeSquared2D() > FMath::Square(EngageDistance))
+		{
+			Hero->AddMovementInput(ToTarget.GetSafeNormal2D());
+		}
+		else
+		{
+			// 이동 방향 회전을 쓰는 영웅도 멈춘 상태에서 대상을 바라보고 공격하도록
+			Hero->SetActorRotation(FRotator(0.f, ToTarget.Rotation().Yaw, 0.f));
+		}
+
+		if (AbilityInputTags.Num() > 0 && ++FramesSinceInput >= AbilityIntervalFrames)
+		{
+			FramesSinceInput = 0;
+			HeldInputTag = AbilityInputTags[NextInputIndex++ % AbilityInputTags.Num()];
+			ASC->AbilityInputTagPressed(HeldInputTag);
+		}
+	}
+
+	ASC->ProcessAbilityInput(DeltaSeconds, false);
+}
+
+USFAbilitySystemComponent* ASFCombatBenchmarkBotController::GetHeroAbilitySystemComponent() const
+{
+	const ASFPlayerState* SFPS = GetPlayerState<ASFPlayerState>();
+	return SFPS ? SFPS->GetSFAbilitySystemComponent() : nullptr;
+}
+
+void ASFCombatBenchmarkBotController::ResolveAbilityInputTags(const USFAbilitySystemComponent& ASC)
+{
+	bInputTagsResolved = true;
+
+	FGameplayTagContainer BoundInputTags;
+	for (const FGameplayAbilitySpec& Spec : ASC.GetActivatableAbilities())
+	{
+		BoundInputTags.AppendTags(Spec.GetDynamicSpecSourceTags());
+	}
+
+	// 설정한 순서 유지. 영웅에 묶인 어빌리티가 없는 태그는 눌러도 아무것도 안 하므로 제외
+	for (const FGameplayTag& InputTag : ConfiguredInputTags)
+	{
+		if (BoundInputTags.HasTagExact(InputTag))
+		{
+			AbilityInputTags.Add(InputTag);
+		}
+	}
+
+	if (ConfiguredInputTags.IsEmpty())
+	{
+		// 상호작용/인벤토리 등은 제외하고 전투 입력만
+		const FGameplayTag CombatInputTags[] =
+		{
+			SFGameplayTags::InputTag_Attack,
+			SFGameplayTags::InputTag_PrimarySkill,
+			SFGameplayTags::InputTag_SecondarySkill,
+			SFGameplayTags::InputTag_IdentitySkill,
+			SFGameplayTags::InputTag_Dodge
+		};
+
+		for (const FGameplayTag& InputTag : CombatInputTags)
+		{
+			if (BoundInputTags.HasTagExact(InputTag))
+			{
+				AbilityInputTags.Add(InputTag);
+			}
+		}
+	}
+}
+
+const ASFEnemy* ASFCombatBenchmarkBotController::FindNearestEnemy(const FVector& Origin) const
+{
+	const ASFGameState* SFGameState = GetWorld()->GetGameState<ASFGameState>();
+	const USFEnemyManagerComponent* EnemyManager = SFGameState ? SFGameState->GetEnemyManager() : nullptr;
+	if (!EnemyManager)
+	{
+		return nullptr;
+	}
+
+	const ASFEnemy* Nearest = nullptr;
+	double NearestDistSq = TNumericLimits<double>::Max();
+	for (const FSFEnemyRegistryEntry& Entry : EnemyManager->GetAliveEnemies())
+	{
+		const double DistSq = FVector::DistSquared(Origin, Entry.Location);
+		if (DistSq < NearestDistSq && Entry.Enemy.IsValid())
+		{
+			Nearest = Entry.Enemy.Get();
+			NearestDistSq = DistSq;
+		}
+	}
+
+	return Nearest;
+}
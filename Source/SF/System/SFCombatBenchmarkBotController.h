@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "GameplayTagContainer.h"
+#include "SFCombatBenchmarkBotController.generated.h"
+
+class ASFEnemy;
+class USFAbilitySystemComponent;
+
+/**
+ * ASFCombatBenchmarkBotController
+ * 전투 벤치마크용 스크립트 봇 (서버 전용)
+ * - PlayerState를 가지므로 ASFGameMode가 플레이어와 같은 경로(PawnData → 영웅 Pawn, PlayerState ASC)로 스폰
+ * - 가장 가까운 적에게 다가간 뒤 입력 태그를 일정 간격으로 눌렀다 뗌 → 실제 어빌리티 입력/활성화 경로 사용
+ * - 플레이어 컨트롤러 대신 ProcessAbilityInput을 직접 호출
+ */
+UCLASS(NotBlueprintable)
+class SF_API ASFCombatBenchmarkBotController : public AAIController
+{
+	GENERATED_BODY()
+
+public:
+	ASFCombatBenchmarkBotController(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	// InputTags 중 영웅 어빌리티에 묶인 태그만 사용 (비어 있으면 묶인 전투 입력 태그 전부). PhaseOffset으로 봇끼리 입력 타이밍을 어긋나게 함
+	void InitBot(const TArray<FGameplayTag>& InputTags, int32 IntervalFrames, int32 PhaseOffset, float InEngageDistance);
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	// 영웅 어빌리티 부여 후 입력 태그를 결정했는지 / 결정된 입력 태그 수 (0이면 공격하지 않는 봇)
+	bool AreInputTagsResolved() const { return bInputTagsResolved; }
+	int32 GetNumAbilityInputTags() const { return AbilityInputTags.Num(); }
+
+private:
+	USFAbilitySystemComponent* GetHeroAbilitySystemComponent() const;
+	void ResolveAbilityInputTags(const USFAbilitySystemComponent& ASC);
+	const ASFEnemy* FindNearestEnemy(const FVector& Origin) const;
+
+private:
+	TArray<FGameplayTag> ConfiguredInputTags;
+	TArray<FGameplayTag> AbilityInputTags;
+	bool bInputTagsResolved = false;
+	FGameplayTag HeldInputTag;
+
+	int32 AbilityIntervalFrames = 15;
+	int32 FramesSinceInput = 0;
+	int32 NextInputIndex = 0;
+	float EngageDistance = 250.f;
+};
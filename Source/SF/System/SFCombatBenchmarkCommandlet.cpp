@@ -0,0 +1,193 @@
+#include "SFCombatBenchmarkCommandlet.h"
+
+#include "SFCombatBenchmarkSettings.h"
+#include "SFCombatBenchmarkSubsystem.h"
+#include "SFLogChannels.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFCombatBenchmarkCommandlet)
+
+namespace SFCombatBenchmarkCommandlet
+{
+	// 요약 CSV (헤더 한 줄 + 값 한 줄) → 열 이름별 값
+	static bool LoadSummary(const FString& SummaryPath, TMap<FString, FString>& OutColumns)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *SummaryPath) || Lines.Num() < 2)
+		{
+			return false;
+		}
+
+		TArray<FString> Names;
+		TArray<FString> Values;
+		Lines[0].ParseIntoArray(Names, TEXT(","), false);
+		Lines[1].ParseIntoArray(Values, TEXT(","), false);
+		for (int32 Index = 0; Index < Names.Num() && Index < Values.Num(); ++Index)
+		{
+			OutColumns.Add(Names[Index], Values[Index]);
+		}
+		return true;
+	}
+
+	static bool CheckThreshold(const TMap<FString, FString>& Columns, const TCHAR* ColumnName, double Threshold)
+	{
+		const FString* Value = Columns.Find(ColumnName);
+		const double Measured = Value ? FCString::Atod(**Value) : 0.0;
+		if (Threshold > 0.0 && Measured > Threshold)
+		{
+			UE_LOG(LogSF, Error, TEXT("CombatBenchmark: %s %.3f exceeds threshold %.3f"), ColumnName, Measured, Threshold);
+			return false;
+		}
+		return true;
+	}
+}
+
+USFCombatBenchmarkCommandlet::USFCombatBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 USFCombatBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace SFCombatBenchmarkCommandlet;
+
+	const USFCombatBenchmarkSettings* Settings = GetDefault<USFCombatBenchmarkSettings>();
+
+	FString MapName = Settings->BenchmarkMap.IsNull() ? FString() : Settings->BenchmarkMap.GetLongPackageName();
+	FParse::Value(*Params, TEXT("Map="), MapName);
+	if (MapName.IsEmpty())
+	{
+		UE_LOG(LogSF, Error, TEXT("CombatBenchmark: No benchmark map. Set BenchmarkMap in SF Combat Benchmark Settings or pass -Map="));
+		return 1;
+	}
+
+	int32 FixedFrameRate = Settings->FixedFrameRate;
+	FParse::Value(*Params, TEXT("FPS="), FixedFrameRate);
+	FixedFrameRate = FMath::Max(1, FixedFrameRate);
+
+	int32 NumClients = 0;
+	FParse::Value(*Params, TEXT("Clients="), NumClients);
+	NumClients = FMath::Clamp(NumClients, 0, 8);
+
+	float ClientDelay = 15.f;
+	FParse::Value(*Params, TEXT("ClientDelay="), ClientDelay);
+
+	float Timeout = 600.f;
+	FParse::Value(*Params, TEXT("Timeout="), Timeout);
+
+	double MaxAvgFrameMs = 0.0;
+	double MaxP95FrameMs = 0.0;
+	FParse::Value(*Params, TEXT("MaxAvgFrameMs="), MaxAvgFrameMs);
+	FParse::Value(*Params, TEXT("MaxP95FrameMs="), MaxP95FrameMs);
+
+	FString CsvPath = USFCombatBenchmarkSubsystem::GetDefaultCsvPath();
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+	CsvPath = FPaths::ConvertRelativePathToFull(CsvPath);
+	const FString SummaryPath = USFCombatBenchmarkSubsystem::GetSummaryCsvPath(CsvPath);
+
+	// 이전 실행 결과를 읽지 않도록
+	IFileManager::Get().Delete(*CsvPath);
+	IFileManager::Get().Delete(*SummaryPath);
+
+	const FString ExecutablePath = FPlatformProcess::ExecutablePath();
+	const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+	const FString CommonArgs = FString::Printf(TEXT("-game -nullrhi -nosound -unattended -nosplash -nopause -benchmark -fps=%d"), FixedFrameRate);
+
+	FString ServerArgs = FString::Printf(TEXT("\"%s\" %s?listen %s -SFCombatBenchmark -BenchmarkCsv=\"%s\""),
+		*ProjectPath, *MapName, *CommonArgs, *CsvPath);
+
+	// 서버로 그대로 넘기는 설정 덮어쓰기
+	const TCHAR* ForwardedParams[][2] =
+	{
+		{ TEXT("Frames="), TEXT("BenchmarkFrames") },
+		{ TEXT("Warmup="), TEXT("BenchmarkWarmup") },
+		{ TEXT("Bots="), TEXT("BenchmarkBots") },
+		{ TEXT("EnemyScale="), TEXT("BenchmarkEnemyScale") }
+	};
+	for (const auto& Forwarded : ForwardedParams)
+	{
+		FString Value;
+		if (FParse::Value(*Params, Forwarded[0], Value))
+		{
+			ServerArgs += FString::Printf(TEXT(" -%s=%s"), Forwarded[1], *Value);
+		}
+	}
+
+	UE_LOG(LogSF, Display, TEXT("CombatBenchmark: Launching %s %s"), *ExecutablePath, *ServerArgs);
+	FProcHandle ServerProc = FPlatformProcess::CreateProc(*ExecutablePath, *ServerArgs, false, true, true, nullptr, 0, nullptr, nullptr);
+	if (!ServerProc.IsValid())
+	{
+		UE_LOG(LogSF, Error, TEXT("CombatBenchmark: Failed to launch benchmark server"));
+		return 1;
+	}
+
+	// 리슨 서버가 맵을 연 뒤 클라이언트 접속 (복제 바이트 측정용)
+	const FString ClientArgs = FString::Printf(TEXT("\"%s\" 127.0.0.1 %s"), *ProjectPath, *CommonArgs);
+	TArray<FProcHandle> ClientProcs;
+
+	const double StartTime = FPlatformTime::Seconds();
+	bool bTimedOut = false;
+	while (FPlatformProcess::IsProcRunning(ServerProc))
+	{
+		const double Elapsed = FPlatformTime::Seconds() - StartTime;
+		if (Elapsed > Timeout)
+		{
+			bTimedOut = true;
+			break;
+		}
+
+		if (ClientProcs.Num() < NumClients && Elapsed >= ClientDelay)
+		{
+			UE_LOG(LogSF, Display, TEXT("CombatBenchmark: Launching client %d"), ClientProcs.Num());
+			ClientProcs.Add(FPlatformProcess::CreateProc(*ExecutablePath, *ClientArgs, false, true, true, nullptr, 0, nullptr, nullptr));
+		}
+
+		FPlatformProcess::Sleep(0.5f);
+	}
+
+	int32 ServerReturnCode = 1;
+	if (bTimedOut)
+	{
+		UE_LOG(LogSF, Error, TEXT("CombatBenchmark: Server did not finish within %.0fs"), Timeout);
+		FPlatformProcess::TerminateProc(ServerProc, true);
+	}
+	else
+	{
+		FPlatformProcess::GetProcReturnCode(ServerProc, &ServerReturnCode);
+	}
+	FPlatformProcess::CloseProc(ServerProc);
+
+	for (FProcHandle& ClientProc : ClientProcs)
+	{
+		if (ClientProc.IsValid())
+		{
+			FPlatformProcess::TerminateProc(ClientProc, true);
+			FPlatformProcess::CloseProc(ClientProc);
+		}
+	}
+
+	TMap<FString, FString> Summary;
+	if (!LoadSummary(SummaryPath, Summary))
+	{
+		UE_LOG(LogSF, Error, TEXT("CombatBenchmark: No summary at %s (server exit code %d)"), *SummaryPath, ServerReturnCode);
+		return 1;
+	}
+
+	UE_LOG(LogSF, Display, TEXT("CombatBenchmark: %s (server exit code %d, %d clients)"), *SummaryPath, ServerReturnCode, ClientProcs.Num());
+	for (const TPair<FString, FString>& Column : Summary)
+	{
+		UE_LOG(LogSF, Display, TEXT("  %-26s %s"), *Column.Key, *Column.Value);
+	}
+
+	bool bPassed = ServerReturnCode == 0 && !bTimedOut;
+	bPassed &= CheckThreshold(Summary, TEXT("AvgFrameMs"), MaxAvgFrameMs);
+	bPassed &= CheckThreshold(Summary, TEXT("P95FrameMs"), MaxP95FrameMs);
+
+	return bPassed ? 0 : 1;
+}
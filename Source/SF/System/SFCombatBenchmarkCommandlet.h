@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SFCombatBenchmarkCommandlet.generated.h"
+
+/**
+ * USFCombatBenchmarkCommandlet
+ * 헤드리스 전투 스트레스 벤치마크를 별도 게임 프로세스로 실행하고 요약 CSV로 합격/불합격 판정 (CI용)
+ * - 커맨드렛에는 GameInstance/GameMode가 없으므로 같은 실행 파일을 -game -nullrhi -nosound 리슨 서버로 띄워
+ *   USFCombatBenchmarkSubsystem이 측정 후 종료하게 함
+ * - 실행: UnrealEditor-Cmd SF.uproject -run=SFCombatBenchmark -unattended
+ * - CI: UnrealEditor-Cmd <ProjectDir>/SF.uproject -run=SFCombatBenchmark -unattended -nullrhi -stdout -MaxP95FrameMs=33.3
+ *   종료 코드 0이 합격. 기본 설정(맵/봇 영웅/적/웨이브)은 Config/DefaultGame.ini의 [/Script/SF.SFCombatBenchmarkSettings]
+ * - -Map=/Game/Maps/L_Stage1/L_Stage1_Room1  벤치마크 맵 (기본: USFCombatBenchmarkSettings::BenchmarkMap)
+ * - -Frames=N -Warmup=N -Bots=N    설정값 덮어쓰기
+ * - -EnemyScale=1.0               웨이브 적 수 배율
+ * - -FPS=30                       고정 프레임레이트 (기본: 설정값)
+ * - -Clients=N                    헤드리스 클라이언트 수. 0이면 송신 바이트는 0 (기본 0)
+ * - -ClientDelay=15               서버 실행 후 클라이언트 접속까지 대기(초)
+ * - -Timeout=600                  서버 프로세스 최대 실행 시간(초)
+ * - -MaxAvgFrameMs= -MaxP95FrameMs= 넘으면 실패 코드 반환
+ * - -Csv=Path                     프레임별 CSV 경로 (기본 Saved/Profiling/CombatBenchmark.csv, 요약은 <Csv>_Summary.csv)
+ */
+UCLASS()
+class SF_API USFCombatBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USFCombatBenchmarkCommandlet();
+
+	//~UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	//~End of UCommandlet interface
+};
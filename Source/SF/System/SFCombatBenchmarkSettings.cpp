@@ -0,0 +1,20 @@
+#include "SFCombatBenchmarkSettings.h"
+
+#include "Input/SFInputGameplayTags.h"
+
+USFCombatBenchmarkSettings::USFCombatBenchmarkSettings()
+{
+	BotAbilityInputTags =
+	{
+		SFGameplayTags::InputTag_Attack,
+		SFGameplayTags::InputTag_Attack,
+		SFGameplayTags::InputTag_PrimarySkill,
+		SFGameplayTags::InputTag_Attack,
+		SFGameplayTags::InputTag_SecondarySkill,
+		SFGameplayTags::InputTag_IdentitySkill
+	};
+
+	FSFCombatBenchmarkWave& FirstWave = Waves.AddDefaulted_GetRef();
+	FirstWave.Count = 30;
+	FirstWave.SpawnFrame = 0;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Engine/DeveloperSettings.h"
+#include "SFCombatBenchmarkSettings.generated.h"
+
+class ASFEnemy;
+class USFHeroDefinition;
+class UWorld;
+
+USTRUCT()
+struct FSFCombatBenchmarkWave
+{
+	GENERATED_BODY()
+
+	// EnemyDataMap 행 이름. None이면 EnemyClasses에 등록된 적을 번갈아 스폰
+	UPROPERTY(EditAnywhere, Category = "Wave")
+	FName EnemyID;
+
+	UPROPERTY(EditAnywhere, Category = "Wave", meta = (ClampMin = "1"))
+	int32 Count = 10;
+
+	// 전투 시작(봇 스폰 완료) 후 이 프레임에 스폰
+	UPROPERTY(EditAnywhere, Category = "Wave", meta = (ClampMin = "0"))
+	int32 SpawnFrame = 0;
+};
+
+/**
+ * 헤드리스 전투 스트레스 벤치마크(USFCombatBenchmarkSubsystem, USFCombatBenchmarkCommandlet) 설정
+ * 기본값은 Config/DefaultGame.ini에 있어 별도 설정 없이 -run=SFCombatBenchmark로 바로 실행 가능
+ */
+UCLASS(Config=Game, DefaultConfig, meta = (DisplayName = "SF Combat Benchmark Settings"))
+class SF_API USFCombatBenchmarkSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	USFCombatBenchmarkSettings();
+
+	// ASFGameMode를 쓰는 벤치마크 전용 맵 (PlayerStart 필요, 적 배치 없이 평지 권장)
+	UPROPERTY(Config, EditAnywhere, Category = "Map")
+	TSoftObjectPtr<UWorld> BenchmarkMap;
+
+	// 봇 영웅. NumBots가 더 많으면 순서대로 반복
+	UPROPERTY(Config, EditAnywhere, Category = "Bots")
+	TArray<TSoftObjectPtr<USFHeroDefinition>> BotHeroes;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Bots", meta = (ClampMin = "0", ClampMax = "16"))
+	int32 NumBots = 3;
+
+	// 봇이 순서대로 누르는 입력 태그 (실제 어빌리티 입력 경로 사용). 영웅에 묶이지 않은 태그는 건너뛰고, 비어 있으면 묶인 전투 입력 태그 전부. 남는 태그가 없으면 실행 실패
+	UPROPERTY(Config, EditAnywhere, Category = "Bots", meta = (Categories = "InputTag"))
+	TArray<FGameplayTag> BotAbilityInputTags;
+
+	// 입력 간격(프레임). 봇마다 위상을 어긋나게 시작
+	UPROPERTY(Config, EditAnywhere, Category = "Bots", meta = (ClampMin = "1"))
+	int32 BotAbilityIntervalFrames = 15;
+
+	// 가장 가까운 적과 이 거리 안이면 이동을 멈추고 공격만
+	UPROPERTY(Config, EditAnywhere, Category = "Bots", meta = (ClampMin = "0", Units = "cm"))
+	float BotEngageDistance = 250.f;
+
+	// EnemyDataMap 행 이름(EnemyID) → 적 클래스. 적 BP의 EnemyData가 같은 EnemyID를 가리켜야 함
+	UPROPERTY(Config, EditAnywhere, Category = "Enemies")
+	TMap<FName, TSoftClassPtr<ASFEnemy>> EnemyClasses;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Enemies")
+	TArray<FSFCombatBenchmarkWave> Waves;
+
+	// 살아있는 적이 이 수 아래로 떨어지면 EnemyID None 규칙으로 보충 (0이면 보충 안 함)
+	UPROPERTY(Config, EditAnywhere, Category = "Enemies", meta = (ClampMin = "0"))
+	int32 MinAliveEnemies = 0;
+
+	// 봇 중심에서 이 반경 링 위에 스폰
+	UPROPERTY(Config, EditAnywhere, Category = "Enemies", meta = (ClampMin = "100", Units = "cm"))
+	float EnemySpawnRadius = 1500.f;
+
+	// 기록하지 않고 버리는 프레임 (첫 웨이브 스폰, 초기 로드가 정착할 때까지)
+	UPROPERTY(Config, EditAnywhere, Category = "Run", meta = (ClampMin = "0"))
+	int32 WarmupFrames = 120;
+
+	// 기록하는 프레임
+	UPROPERTY(Config, EditAnywhere, Category = "Run", meta = (ClampMin = "1"))
+	int32 SampleFrames = 1800;
+
+	// 고정 프레임레이트 (-benchmark -fps=N). 게임 시간이 실행 속도와 무관하게 같은 양만큼 진행
+	UPROPERTY(Config, EditAnywhere, Category = "Run", meta = (ClampMin = "1"))
+	int32 FixedFrameRate = 30;
+
+	// 이 프레임 간격으로 GC 강제 (0이면 엔진 기본 주기). 회차마다 GC 횟수가 같아야 비교 가능
+	UPROPERTY(Config, EditAnywhere, Category = "Run", meta = (ClampMin = "0"))
+	int32 ForceGCIntervalFrames = 600;
+
+	// 봇 PawnData 로드/스폰 대기 상한(초). 넘으면 실패 코드로 종료
+	UPROPERTY(Config, EditAnywhere, Category = "Run", meta = (ClampMin = "1", Units = "s"))
+	float StartupTimeout = 60.f;
+};
@@ -0,0 +1,679 @@
+#include "System/SFCombatBenchmarkSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "EngineUtils.h"
+#include "SFCombatBenchmarkBotController.h"
+#include "SFCombatBenchmarkSettings.h"
+#include "SFGameInstance.h"
+#include "SFLogChannels.h"
+#include "Character/Enemy/SFEnemy.h"
+#include "Character/Hero/SFHeroDefinition.h"
+#include "Combat/SFCombatTraceSubsystem.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerStart.h"
+#include "GameModes/SFEnemyManagerComponent.h"
+#include "GameModes/SFGameMode.h"
+#include "GameModes/SFGameState.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Player/SFPlayerState.h"
+#include "Team/SFTeamTypes.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFCombatBenchmarkSubsystem)
+
+namespace SFCombatBenchmark
+{
+	static double Percentile(TArray<double> Values, double Fraction)
+	{
+		if (Values.IsEmpty())
+		{
+			return 0.0;
+		}
+
+		Values.Sort();
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Values.Num()) - 1, 0, Values.Num() - 1);
+		return Values[Index];
+	}
+}
+
+bool USFCombatBenchmarkSubsystem::IsBenchmarkRequested()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("SFCombatBenchmark"));
+}
+
+FString USFCombatBenchmarkSubsystem::GetDefaultCsvPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Profiling") / TEXT("CombatBenchmark.csv");
+}
+
+FString USFCombatBenchmarkSubsystem::GetSummaryCsvPath(const FString& InCsvPath)
+{
+	return FPaths::GetBaseFilename(InCsvPath, false) + TEXT("_Summary.csv");
+}
+
+bool USFCombatBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && IsBenchmarkRequested();
+}
+
+bool USFCombatBenchmarkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USFCombatBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USFCombatBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+void USFCombatBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	// 시작 맵/로비 등 ASFGameMode가 아닌 월드는 건너뜀 (벤치마크 맵으로 이동한 뒤 실행)
+	if (!InWorld.GetAuthGameMode<ASFGameMode>())
+	{
+		UE_LOG(LogSF, Warning, TEXT("[CombatBenchmark] %s does not use ASFGameMode, waiting for the benchmark map"), *InWorld.GetMapName());
+		return;
+	}
+
+	const USFCombatBenchmarkSettings* Settings = GetDefault<USFCombatBenchmarkSettings>();
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	NumBots = Settings->NumBots;
+	WarmupFrames = Settings->WarmupFrames;
+	SampleFrames = Settings->SampleFrames;
+	FParse::Value(CommandLine, TEXT("BenchmarkBots="), NumBots);
+	FParse::Value(CommandLine, TEXT("BenchmarkWarmup="), WarmupFrames);
+	FParse::Value(CommandLine, TEXT("BenchmarkFrames="), SampleFrames);
+	FParse::Value(CommandLine, TEXT("BenchmarkEnemyScale="), EnemyScale);
+	NumBots = FMath::Max(0, NumBots);
+	WarmupFrames = FMath::Max(0, WarmupFrames);
+	SampleFrames = FMath::Max(1, SampleFrames);
+	EnemyScale = FMath::Max(0.f, EnemyScale);
+
+	CsvPath = GetDefaultCsvPath();
+	FParse::Value(CommandLine, TEXT("BenchmarkCsv="), CsvPath);
+
+	// -benchmark -fps=N 없이 실행해도 게임 시간이 프레임마다 같은 양만큼 진행되도록
+	if (!FApp::IsBenchmarking())
+	{
+		FApp::SetBenchmarking(true);
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetFixedDeltaTime(1.0 / FMath::Max(1, Settings->FixedFrameRate));
+	}
+
+	SpawnStream.Initialize(1337);
+	ResolveEnemyClasses();
+
+	PostLoginHandle = FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &ThisClass::OnGameModePostLogin);
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &ThisClass::OnWorldTickStart);
+	PostTickFlushHandle = InWorld.OnPostTickFlush().AddUObject(this, &ThisClass::OnPostTickFlush);
+	PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &ThisClass::OnPreGarbageCollect);
+	PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &ThisClass::OnPostGarbageCollect);
+
+	UE_LOG(LogSF, Display, TEXT("[CombatBenchmark] %s: %d bots, %d warmup + %d sample frames at %.0f fps, %d enemy types"),
+		*InWorld.GetMapName(), NumBots, WarmupFrames, SampleFrames, 1.0 / FApp::GetFixedDeltaTime(), EnemyIDs.Num());
+
+	StartupTime = FPlatformTime::Seconds();
+	State = EState::WaitingForBeginPlay;
+}
+
+void USFCombatBenchmarkSubsystem::Deinitialize()
+{
+	if (State != EState::Inactive && State != EState::Finished)
+	{
+		Finish(false, TEXT("world torn down before the benchmark finished"));
+	}
+
+	Super::Deinitialize();
+}
+
+void USFCombatBenchmarkSubsystem::ResolveEnemyClasses()
+{
+	const USFCombatBenchmarkSettings* Settings = GetDefault<USFCombatBenchmarkSettings>();
+	const USFGameInstance* GameInstance = GetWorld()->GetGameInstance<USFGameInstance>();
+
+	EnemyClasses.Reset();
+	EnemyIDs.Reset();
+	for (const TPair<FName, TSoftClassPtr<ASFEnemy>>& Pair : Settings->EnemyClasses)
+	{
+		UClass* EnemyClass = Pair.Value.LoadSynchronous();
+		if (!EnemyClass)
+		{
+			UE_LOG(LogSF, Warning, TEXT("[CombatBenchmark] Enemy class for %s failed to load: %s"), *Pair.Key.ToString(), *Pair.Value.ToString());
+			continue;
+		}
+
+		// 속성은 ASFEnemy::PossessedBy에서 EnemyDataMap으로 적용 → 행이 없으면 기본 속성으로 싸움
+		if (GameInstance && !GameInstance->EnemyDataMap.Contains(Pair.Key))
+		{
+			UE_LOG(LogSF, Warning, TEXT("[CombatBenchmark] %s has no EnemyDataMap row, spawning with default attributes"), *Pair.Key.ToString());
+		}
+
+		EnemyClasses.Add(Pair.Key, EnemyClass);
+		EnemyIDs.Add(Pair.Key);
+	}
+}
+
+void USFCombatBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	switch (State)
+	{
+	case EState::WaitingForBeginPlay:
+		if (EnemyIDs.IsEmpty())
+		{
+			Finish(false, TEXT("no EnemyClasses resolved (check [/Script/SF.SFCombatBenchmarkSettings] in DefaultGame.ini)"));
+		}
+		else if (World->HasBegunPlay() && World->GetGameState<ASFGameState>())
+		{
+			SpawnBots();
+			State = EState::SpawningBots;
+		}
+		break;
+
+	case EState::SpawningBots:
+		{
+			FString BotFailure;
+			if (AreBotsReady(BotFailure))
+			{
+				// 맵에 배치된 적도 활성화 수에 포함
+				if (const USFEnemyManagerComponent* EnemyManager = World->GetGameState<ASFGameState>()->GetEnemyManager())
+				{
+					for (const FSFEnemyRegistryEntry& Entry : EnemyManager->GetAliveEnemies())
+					{
+						if (ASFEnemy* Enemy = Entry.Enemy.Get())
+						{
+							BindAbilityCounter(Enemy->GetAbilitySystemComponent());
+						}
+					}
+				}
+
+				UE_LOG(LogSF, Display, TEXT("[CombatBenchmark] %d bots ready after %.1fs, starting combat"), Bots.Num(), FPlatformTime::Seconds() - StartupTime);
+				State = EState::Running;
+				CombatFrame = 0;
+			}
+			else if (!BotFailure.IsEmpty())
+			{
+				Finish(false, BotFailure);
+			}
+			else if (FPlatformTime::Seconds() - StartupTime > GetDefault<USFCombatBenchmarkSettings>()->StartupTimeout)
+			{
+				Finish(false, TEXT("timed out waiting for bot heroes to spawn"));
+			}
+		}
+		break;
+
+	case EState::Running:
+		{
+			const USFCombatBenchmarkSettings* Settings = GetDefault<USFCombatBenchmarkSettings>();
+			for (const FSFCombatBenchmarkWave& Wave : Settings->Waves)
+			{
+				if (Wave.SpawnFrame == CombatFrame && SpawnWave(Wave.EnemyID, FMath::Max(1, FMath::RoundToInt(Wave.Count * EnemyScale))) == 0)
+				{
+					Finish(false, FString::Printf(TEXT("wave at frame %d (%s) spawned no enemies"), Wave.SpawnFrame, *Wave.EnemyID.ToString()));
+					return;
+				}
+			}
+
+			if (Settings->MinAliveEnemies > 0)
+			{
+				const USFEnemyManagerComponent* EnemyManager = World->GetGameState<ASFGameState>()->GetEnemyManager();
+				const int32 AliveEnemies = EnemyManager ? EnemyManager->GetAliveEnemyCount() : 0;
+				if (AliveEnemies < Settings->MinAliveEnemies && SpawnWave(NAME_None, Settings->MinAliveEnemies - AliveEnemies) == 0)
+				{
+					Finish(false, TEXT("MinAliveEnemies refill spawned no enemies"));
+					return;
+				}
+			}
+
+			if (Settings->ForceGCIntervalFrames > 0 && CombatFrame > 0 && CombatFrame % Settings->ForceGCIntervalFrames == 0)
+			{
+				GEngine->ForceGarbageCollection(true);
+			}
+
+			++CombatFrame;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void USFCombatBenchmarkSubsystem::SpawnBots()
+{
+	const USFCombatBenchmarkSettings* Settings = GetDefault<USFCombatBenchmarkSettings>();
+	if (NumBots > 0 && Settings->BotHeroes.IsEmpty())
+	{
+		Finish(false, TEXT("no BotHeroes configured"));
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	ASFGameMode* GameMode = World->GetAuthGameMode<ASFGameMode>();
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	for (int32 BotIndex = 0; BotIndex < NumBots; ++BotIndex)
+	{
+		ASFCombatBenchmarkBotController* Bot = World->SpawnActor<ASFCombatBenchmarkBotController>(SpawnParams);
+		ASFPlayerState* SFPS = Bot ? Bot->GetPlayerState<ASFPlayerState>() : nullptr;
+		if (!SFPS)
+		{
+			Finish(false, TEXT("bot controller did not get an ASFPlayerState"));
+			return;
+		}
+
+		Bot->InitBot(Settings->BotAbilityInputTags, Settings->BotAbilityIntervalFrames, BotIndex * 5, Settings->BotEngageDistance);
+		Bots.Add(Bot);
+
+		SFPS->SetIsABot(true);
+		SFPS->SetPlayerName(FString::Printf(TEXT("BenchmarkBot%d"), BotIndex));
+		SFPS->SetGenericTeamId(FGenericTeamId(SFTeamID::Player));
+		AssignHero(SFPS, BotIndex);
+		BindAbilityCounter(SFPS->GetSFAbilitySystemComponent());
+
+		// 플레이어와 같은 경로: PawnData 비동기 로드 → RestartPlayer → 영웅 Pawn + PawnData 초기화
+		TWeakObjectPtr<ASFGameMode> WeakGameMode(GameMode);
+		TWeakObjectPtr<ASFCombatBenchmarkBotController> WeakBot(Bot);
+		SFPS->OnPawnDataLoaded.AddWeakLambda(this, [WeakGameMode, WeakBot](const USFPawnData*)
+		{
+			ASFGameMode* LoadedGameMode = WeakGameMode.Get();
+			ASFCombatBenchmarkBotController* LoadedBot = WeakBot.Get();
+			if (LoadedGameMode && LoadedBot && !LoadedBot->GetPawn())
+			{
+				LoadedGameMode->RestartPlayer(LoadedBot);
+			}
+		});
+		SFPS->StartLoadingPawnData();
+	}
+}
+
+void USFCombatBenchmarkSubsystem::OnGameModePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer)
+{
+	if (!NewPlayer || NewPlayer->GetWorld() != GetWorld())
+	{
+		return;
+	}
+
+	// 복제량 측정용으로 접속한 클라이언트도 영웅을 받아야 ASFGameMode가 스폰함 (PostLogin 끝에서 PawnData 로드 시작)
+	if (ASFPlayerState* SFPS = NewPlayer->GetPlayerState<ASFPlayerState>())
+	{
+		if (!SFPS->GetPlayerSelection().GetHeroDefinition())
+		{
+			AssignHero(SFPS, GetWorld()->GetGameState()->PlayerArray.Num());
+		}
+		BindAbilityCounter(SFPS->GetSFAbilitySystemComponent());
+	}
+}
+
+void USFCombatBenchmarkSubsystem::AssignHero(ASFPlayerState* SFPS, int32 HeroIndex) const
+{
+	const TArray<TSoftObjectPtr<USFHeroDefinition>>& BotHeroes = GetDefault<USFCombatBenchmarkSettings>()->BotHeroes;
+	if (BotHeroes.IsEmpty())
+	{
+		return;
+	}
+
+	USFHeroDefinition* HeroDefinition = BotHeroes[HeroIndex % BotHeroes.Num()].LoadSynchronous();
+	if (!HeroDefinition)
+	{
+		UE_LOG(LogSF, Warning, TEXT("[CombatBenchmark] Bot hero %d failed to load"), HeroIndex % BotHeroes.Num());
+		return;
+	}
+
+	FSFPlayerSelectionInfo Selection(0, SFPS);
+	Selection.SetHeroDefinition(HeroDefinition);
+	SFPS->SetPlayerSelection(Selection);
+}
+
+bool USFCombatBenchmarkSubsystem::AreBotsReady(FString& OutFailure) const
+{
+	bool bReady = true;
+	for (const TWeakObjectPtr<ASFCombatBenchmarkBotController>& Bot : Bots)
+	{
+		if (!Bot.IsValid() || !Bot->GetPawn() || !Bot->AreInputTagsResolved())
+		{
+			bReady = false;
+			continue;
+		}
+
+		// 어빌리티를 못 쓰는 봇으로 돌리면 활성화 0인 채로 OK가 나옴
+		if (Bot->GetNumAbilityInputTags() == 0)
+		{
+			OutFailure = FString::Printf(TEXT("%s has no abilities bound to BotAbilityInputTags"), *GetNameSafe(Bot->GetPawn()));
+			return false;
+		}
+	}
+	return bReady;
+}
+
+int32 USFCombatBenchmarkSubsystem::CountAliveBots() const
+{
+	int32 AliveBots = 0;
+	for (const TWeakObjectPtr<ASFCombatBenchmarkBotController>& Bot : Bots)
+	{
+		const ASFPlayerState* SFPS = Bot.IsValid() ? Bot->GetPlayerState<ASFPlayerState>() : nullptr;
+		if (SFPS && Bot->GetPawn() && !SFPS->IsDead())
+		{
+			++AliveBots;
+		}
+	}
+	return AliveBots;
+}
+
+FVector USFCombatBenchmarkSubsystem::GetCombatCenter() const
+{
+	FVector Sum = FVector::ZeroVector;
+	int32 NumPawns = 0;
+	for (const TWeakObjectPtr<ASFCombatBenchmarkBotController>& Bot : Bots)
+	{
+		if (const APawn* Pawn = Bot.IsValid() ? Bot->GetPawn() : nullptr)
+		{
+			Sum += Pawn->GetActorLocation();
+			++NumPawns;
+		}
+	}
+
+	if (NumPawns > 0)
+	{
+		return Sum / NumPawns;
+	}
+
+	for (TActorIterator<APlayerStart> It(GetWorld()); It; ++It)
+	{
+		return It->GetActorLocation();
+	}
+	return FVector::ZeroVector;
+}
+
+int32 USFCombatBenchmarkSubsystem::SpawnWave(FName EnemyID, int32 Count)
+{
+	if (EnemyIDs.IsEmpty())
+	{
+		return 0;
+	}
+
+	UWorld* World = GetWorld();
+	const float Radius = GetDefault<USFCombatBenchmarkSettings>()->EnemySpawnRadius;
+	const FVector Center = GetCombatCenter();
+	const float StartAngle = SpawnStream.FRandRange(0.f, UE_TWO_PI);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	int32 NumSpawned = 0;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		// None이면 등록된 적을 순서대로 번갈아 → 실행마다 같은 구성
+		const FName SpawnID = EnemyID.IsNone() ? EnemyIDs[NextEnemyIDIndex++ % EnemyIDs.Num()] : EnemyID;
+		const TSubclassOf<ASFEnemy>* EnemyClass = EnemyClasses.Find(SpawnID);
+		if (!EnemyClass)
+		{
+			UE_LOG(LogSF, Warning, TEXT("[CombatBenchmark] Wave enemy %s is not in EnemyClasses"), *SpawnID.ToString());
+			break;
+		}
+
+		const float Angle = StartAngle + UE_TWO_PI * Index / Count;
+		const FVector Location = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * Radius + FVector(0.f, 0.f, 100.f);
+		const FRotator Rotation(0.f, (Center - Location).Rotation().Yaw, 0.f);
+
+		ASFEnemy* Enemy = World->SpawnActor<ASFEnemy>(*EnemyClass, Location, Rotation, SpawnParams);
+		if (!Enemy)
+		{
+			continue;
+		}
+
+		if (!Enemy->GetController())
+		{
+			Enemy->SpawnDefaultController();
+		}
+		BindAbilityCounter(Enemy->GetAbilitySystemComponent());
+		++NumSpawned;
+	}
+
+	UE_LOG(LogSF, Log, TEXT("[CombatBenchmark] Frame %d: spawned %d/%d enemies (%s)"),
+		CombatFrame, NumSpawned, Count, EnemyID.IsNone() ? TEXT("mixed") : *EnemyID.ToString());
+
+	return NumSpawned;
+}
+
+void USFCombatBenchmarkSubsystem::BindAbilityCounter(UAbilitySystemComponent* ASC)
+{
+	if (!ASC || CountedASCs.Contains(ASC))
+	{
+		return;
+	}
+
+	CountedASCs.Add(ASC);
+	ASC->AbilityActivatedCallbacks.AddUObject(this, &ThisClass::OnAbilityActivated);
+}
+
+void USFCombatBenchmarkSubsystem::OnAbilityActivated(UGameplayAbility* Ability)
+{
+	++FrameActivations;
+}
+
+void USFCombatBenchmarkSubsystem::OnWorldTickStart(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (FrameStartTime > 0.0)
+	{
+		CloseFrame(Now);
+	}
+
+	FrameStartTime = Now;
+	FrameDeltaSeconds = DeltaSeconds;
+	WorldTickMs = 0.0;
+	FrameGCMs = 0.0;
+	FrameActivations = 0;
+	FrameStartOutBytes = GetOutTotalBytes();
+}
+
+void USFCombatBenchmarkSubsystem::OnPostTickFlush()
+{
+	if (FrameStartTime > 0.0)
+	{
+		WorldTickMs = (FPlatformTime::Seconds() - FrameStartTime) * 1000.0;
+	}
+}
+
+void USFCombatBenchmarkSubsystem::OnPreGarbageCollect()
+{
+	GCStartTime = FPlatformTime::Seconds();
+}
+
+void USFCombatBenchmarkSubsystem::OnPostGarbageCollect()
+{
+	if (GCStartTime > 0.0)
+	{
+		FrameGCMs += (FPlatformTime::Seconds() - GCStartTime) * 1000.0;
+		GCStartTime = 0.0;
+	}
+}
+
+uint32 USFCombatBenchmarkSubsystem::GetOutTotalBytes() const
+{
+	const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	return NetDriver ? NetDriver->OutTotalBytes : 0;
+}
+
+void USFCombatBenchmarkSubsystem::CloseFrame(double Now)
+{
+	// CombatFrame은 이번 프레임 Tick에서 이미 증가
+	if (State != EState::Running || CombatFrame <= WarmupFrames)
+	{
+		return;
+	}
+
+	const ASFGameState* SFGameState = GetWorld()->GetGameState<ASFGameState>();
+	const USFEnemyManagerComponent* EnemyManager = SFGameState ? SFGameState->GetEnemyManager() : nullptr;
+	const USFCombatTraceSubsystem* TraceSubsystem = USFCombatTraceSubsystem::Get(this);
+
+	FFrameSample& Sample = Samples.AddDefaulted_GetRef();
+	Sample.Frame = CombatFrame - WarmupFrames - 1;
+	Sample.FrameMs = (Now - FrameStartTime) * 1000.0;
+	Sample.WorldTickMs = WorldTickMs;
+	Sample.GCMs = FrameGCMs;
+	Sample.SimSeconds = FrameDeltaSeconds;
+	Sample.AbilityActivations = FrameActivations;
+	Sample.Traces = TraceSubsystem ? TraceSubsystem->GetSweepsLastFrame() : 0;
+	Sample.ReplicatedBytes = GetOutTotalBytes() - FrameStartOutBytes;
+	Sample.AliveEnemies = EnemyManager ? EnemyManager->GetAliveEnemyCount() : 0;
+	Sample.AliveBots = CountAliveBots();
+
+	if (Sample.GCMs > 0.0)
+	{
+		++NumGCs;
+	}
+
+	if (Samples.Num() >= SampleFrames)
+	{
+		const FString SampleFailure = GetSampleFailure();
+		Finish(SampleFailure.IsEmpty(), SampleFailure);
+	}
+}
+
+FString USFCombatBenchmarkSubsystem::GetSampleFailure() const
+{
+	int32 PeakEnemies = 0;
+	int64 TotalActivations = 0;
+	for (const FFrameSample& Sample : Samples)
+	{
+		PeakEnemies = FMath::Max(PeakEnemies, Sample.AliveEnemies);
+		TotalActivations += Sample.AbilityActivations;
+	}
+
+	// 전투가 일어나지 않은 측정은 수치가 좋아 보여도 의미가 없으므로 실패로 처리
+	if (PeakEnemies == 0)
+	{
+		return TEXT("no enemies were alive during the sample window");
+	}
+	if (TotalActivations == 0)
+	{
+		return TEXT("no ability activations during the sample window");
+	}
+	return FString();
+}
+
+void USFCombatBenchmarkSubsystem::Finish(bool bSuccess, const FString& Reason)
+{
+	if (State == EState::Finished)
+	{
+		return;
+	}
+
+	State = EState::Finished;
+	FailureReason = Reason;
+
+	FGameModeEvents::GameModePostLoginEvent.Remove(PostLoginHandle);
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	if (UWorld* World = GetWorld())
+	{
+		World->OnPostTickFlush().Remove(PostTickFlushHandle);
+	}
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+
+	WriteResults();
+
+	if (bSuccess)
+	{
+		UE_LOG(LogSF, Display, TEXT("[CombatBenchmark] Finished %d frames, results in %s"), Samples.Num(), *CsvPath);
+	}
+	else
+	{
+		UE_LOG(LogSF, Error, TEXT("[CombatBenchmark] FAILED: %s"), *Reason);
+	}
+
+	FPlatformMisc::RequestExitWithStatus(false, bSuccess ? 0 : 1);
+}
+
+void USFCombatBenchmarkSubsystem::WriteResults() const
+{
+	using namespace SFCombatBenchmark;
+
+	FString FramesCsv = TEXT("Frame,FrameMs,WorldTickMs,GCMs,AbilityActivations,Traces,ReplicatedBytes,AliveEnemies,AliveBots\n");
+
+	TArray<double> FrameMsValues;
+	TArray<double> WorldTickMsValues;
+	FrameMsValues.Reserve(Samples.Num());
+	WorldTickMsValues.Reserve(Samples.Num());
+
+	double TotalSimSeconds = 0.0;
+	double TotalGCMs = 0.0;
+	double MaxGCMs = 0.0;
+	int64 TotalActivations = 0;
+	int64 TotalTraces = 0;
+	int32 MaxTraces = 0;
+	int64 TotalBytes = 0;
+	int32 PeakEnemies = 0;
+	int32 MinBots = Samples.IsEmpty() ? 0 : MAX_int32;
+
+	for (const FFrameSample& Sample : Samples)
+	{
+		FramesCsv += FString::Printf(TEXT("%d,%.3f,%.3f,%.3f,%d,%d,%u,%d,%d\n"),
+			Sample.Frame, Sample.FrameMs, Sample.WorldTickMs, Sample.GCMs, Sample.AbilityActivations,
+			Sample.Traces, Sample.ReplicatedBytes, Sample.AliveEnemies, Sample.AliveBots);
+
+		FrameMsValues.Add(Sample.FrameMs);
+		WorldTickMsValues.Add(Sample.WorldTickMs);
+		TotalSimSeconds += Sample.SimSeconds;
+		TotalGCMs += Sample.GCMs;
+		MaxGCMs = FMath::Max(MaxGCMs, Sample.GCMs);
+		TotalActivations += Sample.AbilityActivations;
+		TotalTraces += Sample.Traces;
+		MaxTraces = FMath::Max(MaxTraces, Sample.Traces);
+		TotalBytes += Sample.ReplicatedBytes;
+		PeakEnemies = FMath::Max(PeakEnemies, Sample.AliveEnemies);
+		MinBots = FMath::Min(MinBots, Sample.AliveBots);
+	}
+
+	const int32 NumSamples = FMath::Max(1, Samples.Num());
+	const double SimSeconds = FMath::Max(TotalSimSeconds, UE_SMALL_NUMBER);
+	auto Average = [NumSamples](const TArray<double>& Values)
+	{
+		double Sum = 0.0;
+		for (double Value : Values)
+		{
+			Sum += Value;
+		}
+		return Sum / NumSamples;
+	};
+
+	FString SummaryCsv = TEXT("Map,Result,Frames,Bots,MinAliveBots,PeakEnemies,AvgFrameMs,P95FrameMs,MaxFrameMs,AvgWorldTickMs,P95WorldTickMs,")
+		TEXT("AbilityActivationsPerSec,AvgTracesPerFrame,MaxTracesPerFrame,GCCount,TotalGCMs,MaxGCMs,ReplicatedBytesPerSec\n");
+	SummaryCsv += FString::Printf(TEXT("%s,%s,%d,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%d,%d,%.3f,%.3f,%.0f\n"),
+		*GetWorld()->GetMapName(), FailureReason.IsEmpty() ? TEXT("OK") : TEXT("FAILED"), Samples.Num(), Bots.Num(), MinBots, PeakEnemies,
+		Average(FrameMsValues), Percentile(FrameMsValues, 0.95), Percentile(FrameMsValues, 1.0),
+		Average(WorldTickMsValues), Percentile(WorldTickMsValues, 0.95),
+		TotalActivations / SimSeconds, static_cast<double>(TotalTraces) / NumSamples, MaxTraces,
+		NumGCs, TotalGCMs, MaxGCMs, TotalBytes / SimSeconds);
+
+	const FString SummaryPath = GetSummaryCsvPath(CsvPath);
+	FFileHelper::SaveStringToFile(FramesCsv, *CsvPath);
+	FFileHelper::SaveStringToFile(SummaryCsv, *SummaryPath);
+
+	UE_LOG(LogSF, Display, TEXT("[CombatBenchmark] Frame %.2f ms avg / %.2f ms p95, world tick %.2f ms avg, %.1f activations/s, %.1f traces/frame, %d GCs (%.1f ms), %.0f B/s out"),
+		Average(FrameMsValues), Percentile(FrameMsValues, 0.95), Average(WorldTickMsValues), TotalActivations / SimSeconds,
+		static_cast<double>(TotalTraces) / NumSamples, NumGCs, TotalGCMs, TotalBytes / SimSeconds);
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SFCombatBenchmarkSubsystem.generated.h"
+
+class AGameModeBase;
+class APlayerController;
+class ASFCombatBenchmarkBotController;
+class ASFEnemy;
+class ASFPlayerState;
+class UAbilitySystemComponent;
+class UGameplayAbility;
+
+/**
+ * USFCombatBenchmarkSubsystem
+ * 헤드리스 전투 스트레스 벤치마크 실행기 (서버/스탠드얼론, -SFCombatBenchmark 인자가 있을 때만 생성)
+ * - 실제 ASFGameMode 위에서 스크립트 봇 영웅(ASFCombatBenchmarkBotController)을 스폰하고 설정한 웨이브의 적을 스폰
+ * - 워밍업 후 SampleFrames 동안 프레임별 지표를 기록하고 CSV를 쓴 뒤 프로세스 종료 (실패 시 종료 코드 1)
+ * - 기록: 프레임 시간, 월드 틱 시간, GC 시간, 어빌리티 활성화 수, 트레이스 수, 송신 바이트, 살아있는 적/봇 수
+ * - 실행 인자: -BenchmarkFrames= -BenchmarkWarmup= -BenchmarkBots= -BenchmarkEnemyScale= -BenchmarkCsv=
+ * - 보통 USFCombatBenchmarkCommandlet이 실행. 설정은 USFCombatBenchmarkSettings
+ */
+UCLASS()
+class SF_API USFCombatBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static bool IsBenchmarkRequested();
+
+	// 프레임별 CSV 기본 경로 (Saved/Profiling/CombatBenchmark.csv) / 요약 CSV 경로 (<프레임 CSV>_Summary.csv)
+	static FString GetDefaultCsvPath();
+	static FString GetSummaryCsvPath(const FString& InCsvPath);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	//~UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of UTickableWorldSubsystem interface
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	enum class EState : uint8
+	{
+		Inactive,
+		WaitingForBeginPlay,
+		SpawningBots,
+		Running,
+		Finished
+	};
+
+	struct FFrameSample
+	{
+		int32 Frame = 0;
+		double FrameMs = 0.0;
+		double WorldTickMs = 0.0;
+		double GCMs = 0.0;
+		double SimSeconds = 0.0;
+		int32 AbilityActivations = 0;
+		int32 Traces = 0;
+		uint32 ReplicatedBytes = 0;
+		int32 AliveEnemies = 0;
+		int32 AliveBots = 0;
+	};
+
+	void ResolveEnemyClasses();
+	void SpawnBots();
+	void OnGameModePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer);
+	void AssignHero(ASFPlayerState* SFPS, int32 HeroIndex) const;
+	bool AreBotsReady(FString& OutFailure) const;
+	int32 CountAliveBots() const;
+
+	// 실제로 스폰된 적 수 반환
+	int32 SpawnWave(FName EnemyID, int32 Count);
+	FVector GetCombatCenter() const;
+
+	void BindAbilityCounter(UAbilitySystemComponent* ASC);
+	void OnAbilityActivated(UGameplayAbility* Ability);
+
+	void OnWorldTickStart(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void OnPostTickFlush();
+	void OnPreGarbageCollect();
+	void OnPostGarbageCollect();
+	void CloseFrame(double Now);
+	// 적이 없었거나 어빌리티가 한 번도 안 쓰인 측정이면 실패 사유 반환
+	FString GetSampleFailure() const;
+	uint32 GetOutTotalBytes() const;
+
+	void Finish(bool bSuccess, const FString& Reason);
+	void WriteResults() const;
+
+private:
+	EState State = EState::Inactive;
+
+	// 실행 인자 적용 후 값
+	int32 NumBots = 0;
+	int32 WarmupFrames = 0;
+	int32 SampleFrames = 0;
+	float EnemyScale = 1.f;
+	FString CsvPath;
+
+	UPROPERTY(Transient)
+	TMap<FName, TSubclassOf<ASFEnemy>> EnemyClasses;
+	TArray<FName> EnemyIDs;
+	int32 NextEnemyIDIndex = 0;
+	FRandomStream SpawnStream;
+
+	TArray<TWeakObjectPtr<ASFCombatBenchmarkBotController>> Bots;
+	TSet<TObjectKey<UAbilitySystemComponent>> CountedASCs;
+
+	double StartupTime = 0.0;
+	int32 CombatFrame = 0;
+
+	// 진행 중인 프레임 (월드 틱 시작 ~ 다음 월드 틱 시작)
+	double FrameStartTime = 0.0;
+	double WorldTickMs = 0.0;
+	double FrameGCMs = 0.0;
+	double GCStartTime = 0.0;
+	float FrameDeltaSeconds = 0.f;
+	int32 FrameActivations = 0;
+	uint32 FrameStartOutBytes = 0;
+	int32 NumGCs = 0;
+
+	TArray<FFrameSample> Samples;
+	FString FailureReason;
+
+	FDelegateHandle PostLoginHandle;
+	FDelegateHandle WorldTickStartHandle;
+	FDelegateHandle PostTickFlushHandle;
+	FDelegateHandle PreGCHandle;
+	FDelegateHandle PostGCHandle;
+};
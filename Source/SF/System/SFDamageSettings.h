@@ -6,7 +6,7 @@
 #include "Engine/DeveloperSettings.h"
 #include "SFDamageSettings.generated.h"
 
-class USFDamageWidget;
+class UCurveFloat;
 /**
  * 
  */
@@ -17,6 +17,80 @@ class SF_API USFDamageSettings : public UDeveloperSettings
 
 public:
 	
+	// 데미지 텍스트 폰트 (크기는 기본 스케일 1 기준)
 	UPROPERTY(Config, EditAnywhere, Category = "UI")
-	TSoftClassPtr<USFDamageWidget> DamageWidgetClass;
+	FSlateFontInfo DamageTextFont;
+
+	UPROPERTY(Config, EditAnywhere, Category = "UI")
+	FLinearColor NormalDamageColor = FLinearColor::White;
+
+	UPROPERTY(Config, EditAnywhere, Category = "UI")
+	FLinearColor CriticalDamageColor = FLinearColor::Red;
+
+	// 크리티컬 텍스트 추가 배율
+	UPROPERTY(Config, EditAnywhere, Category = "UI", meta = (ClampMin = "0.1"))
+	float CriticalDamageScale = 1.3f;
+
+	// 화면에 동시에 표시할 최대 데미지 텍스트 수. 초과 시 가장 오래된 것부터 제거
+	UPROPERTY(Config, EditAnywhere, Category = "UI", meta = (ClampMin = "1"))
+	int32 MaxActiveDamageTexts = 200;
+
+	// 데미지 텍스트 수명(초)
+	UPROPERTY(Config, EditAnywhere, Category = "UI", meta = (ClampMin = "0.05"))
+	float DamageTextLifetime = 1.0f;
+
+	// 수명 동안 위로 떠오르는 거리(픽셀). RiseCurve가 있으면 커브 값(0~1)에 곱함
+	UPROPERTY(Config, EditAnywhere, Category = "UI")
+	float DamageTextRiseDistance = 60.f;
+
+	// 정규화 시간(0~1) → 상승 비율. 비어 있으면 EaseOut
+	UPROPERTY(Config, EditAnywhere, Category = "UI")
+	TSoftObjectPtr<UCurveFloat> RiseCurve;
+
+	// 정규화 시간(0~1) → 스케일. 비어 있으면 짧은 팝업 후 1
+	UPROPERTY(Config, EditAnywhere, Category = "UI")
+	TSoftObjectPtr<UCurveFloat> ScaleCurve;
+
+	// 정규화 시간(0~1) → 투명도. 비어 있으면 마지막 30% 동안 페이드 아웃
+	UPROPERTY(Config, EditAnywhere, Category = "UI")
+	TSoftObjectPtr<UCurveFloat> OpacityCurve;
+
+	// 동시에 표시할 최대 적 체력바 수. 초과 시 카메라에서 가까운 순으로 표시
+	UPROPERTY(Config, EditAnywhere, Category = "UI|Enemy Health Bar", meta = (ClampMin = "1"))
+	int32 MaxVisibleEnemyHealthBars = 16;
+
+	// 체력바 크기(픽셀, DPI 스케일 1 기준)
+	UPROPERTY(Config, EditAnywhere, Category = "UI|Enemy Health Bar")
+	FVector2D EnemyHealthBarSize = FVector2D(100.f, 10.f);
+
+	UPROPERTY(Config, EditAnywhere, Category = "UI|Enemy Health Bar")
+	FLinearColor EnemyHealthBarBackgroundColor = FLinearColor(0.f, 0.f, 0.f, 0.6f);
+
+	// 체력 감소 직후 천천히 줄어드는 잔상 바 색
+	UPROPERTY(Config, EditAnywhere, Category = "UI|Enemy Health Bar")
+	FLinearColor EnemyHealthBarDelayedColor = FLinearColor(1.f, 0.85f, 0.6f, 1.f);
+
+	// 잔상/회복 바 보간 속도
+	UPROPERTY(Config, EditAnywhere, Category = "UI|Enemy Health Bar", meta = (ClampMin = "0.1"))
+	float EnemyHealthBarInterpSpeed = 2.5f;
+
+	// 최대 표시 거리의 이 비율부터 거리 페이드 시작
+	UPROPERTY(Config, EditAnywhere, Category = "UI|Enemy Health Bar", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float EnemyHealthBarFadeStartRatio = 0.7f;
+
+	// 표시 시간이 끝나기 전 페이드 아웃 시간(초)
+	UPROPERTY(Config, EditAnywhere, Category = "UI|Enemy Health Bar", meta = (ClampMin = "0.0"))
+	float EnemyHealthBarFadeOutTime = 0.3f;
+
+	// 플레이어가 준 히트를 서버에서 집계해 배치 RPC로 전송 (false면 히트마다 GameplayCue)
+	UPROPERTY(Config, EditAnywhere, Category = "Network")
+	bool bAggregateHitEvents = true;
+
+	// 같은 타겟 히트를 병합하는 윈도우(초). 0이면 같은 프레임 히트만 병합
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "0.0", EditCondition = "bAggregateHitEvents"))
+	float HitAggregationWindow = 0.1f;
+
+	// RPC 한 번에 담을 최대 히트 수
+	UPROPERTY(Config, EditAnywhere, Category = "Network", meta = (ClampMin = "1", EditCondition = "bAggregateHitEvents"))
+	int32 MaxHitsPerBatch = 32;
 };
@@ -1,10 +1,28 @@
 #include "System/SFDamageTextSubSystem.h"
 #include "SFDamageSettings.h"
-#include "Components/WidgetComponent.h"
-#include "UI/InGame/SFDamageWidget.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Rendering/SlateRenderer.h"
+#include "SceneView.h"
+#include "Styling/CoreStyle.h"
+#include "UI/Slate/SFDamageTextLayer.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFDamageTextSubSystem)
+
+DECLARE_STATS_GROUP(TEXT("SF Damage Text"), STATGROUP_SFDamageText, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("DamageText Update"), STAT_SFDamageText_Update, STATGROUP_SFDamageText);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Damage Texts"), STAT_SFDamageText_Active, STATGROUP_SFDamageText);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Evicted Damage Texts"), STAT_SFDamageText_Evicted, STATGROUP_SFDamageText);
+
+// 데미지 텍스트 레이어 ZOrder (HUD 오버레이보다 아래)
+static constexpr int32 DamageTextLayerZOrder = 5;
 
 void USFDamageTextSubSystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -12,95 +30,180 @@ void USFDamageTextSubSystem::Initialize(FSubsystemCollectionBase& Collection)
 
     if (const USFDamageSettings* Settings = GetDefault<USFDamageSettings>())
     {
-        DamageWidgetClass = Settings->DamageWidgetClass.LoadSynchronous();
+        RiseCurve = Settings->RiseCurve.LoadSynchronous();
+        ScaleCurve = Settings->ScaleCurve.LoadSynchronous();
+        OpacityCurve = Settings->OpacityCurve.LoadSynchronous();
+
+        DamageTextFont = Settings->DamageTextFont;
+        NormalColor = Settings->NormalDamageColor;
+        CriticalColor = Settings->CriticalDamageColor;
+        CriticalScale = Settings->CriticalDamageScale;
+        Lifetime = FMath::Max(0.05f, Settings->DamageTextLifetime);
+        RiseDistance = Settings->DamageTextRiseDistance;
+        MaxActiveRecords = FMath::Max(1, Settings->MaxActiveDamageTexts);
+    }
+
+    if (!DamageTextFont.HasValidFont())
+    {
+        DamageTextFont = FCoreStyle::GetDefaultFontStyle("Bold", 24);
+        DamageTextFont.OutlineSettings.OutlineSize = 2;
     }
+
+    ActiveRecords.Reserve(MaxActiveRecords);
 }
 
 void USFDamageTextSubSystem::Deinitialize()
 {
-    for (auto& Pair : ActiveWidgetMap)
+    RemoveLayer();
+    ActiveRecords.Empty();
+
+    Super::Deinitialize();
+}
+
+bool USFDamageTextSubSystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USFDamageTextSubSystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USFDamageTextSubSystem, STATGROUP_Tickables);
+}
+
+void USFDamageTextSubSystem::ShowDamage(float DamageAmount, AActor* TargetActor, FVector HitLocation, bool bIsCritical)
+{
+    if (!TargetActor || GetWorld()->GetNetMode() == NM_DedicatedServer) return;
+
+    EnsureLayer();
+
+    // 상한 도달 시 가장 오래된 레코드 제거
+    if (ActiveRecords.Num() >= MaxActiveRecords)
     {
-        if (IsValid(Pair.Value))
+        const int32 NumToEvict = ActiveRecords.Num() - MaxActiveRecords + 1;
+        ActiveRecords.RemoveAt(0, NumToEvict, EAllowShrinking::No);
+        INC_DWORD_STAT_BY(STAT_SFDamageText_Evicted, NumToEvict);
+    }
+
+    FSFDamageTextRecord& Record = ActiveRecords.AddDefaulted_GetRef();
+    Record.WorldLocation = CalcDamageTextLocation(TargetActor, HitLocation) + FMath::VRand() * 10.f;
+    Record.Text = FString::FromInt(FMath::RoundToInt(DamageAmount));
+    Record.bCritical = bIsCritical;
+
+    // 텍스트 크기는 생성 시 한 번만 측정 (스케일 1 기준)
+    if (FSlateApplication::IsInitialized())
+    {
+        const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+        Record.TextSize = FVector2f(FontMeasure->Measure(Record.Text, DamageTextFont));
+    }
+}
+
+void USFDamageTextSubSystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SFDamageText_Update);
+
+    if (ActiveRecords.Num() == 0)
+    {
+        SET_DWORD_STAT(STAT_SFDamageText_Active, 0);
+        return;
+    }
+
+    // 1) 수명 경과 + 만료 제거. 수명이 모두 같으므로 만료된 레코드는 항상 배열 앞쪽에 모여 있음
+    int32 NumExpired = 0;
+    for (FSFDamageTextRecord& Record : ActiveRecords)
+    {
+        Record.Age += DeltaTime;
+        if (Record.Age >= Lifetime)
         {
-            Pair.Value->DestroyComponent();
+            ++NumExpired;
         }
     }
-    for (auto& Comp  : AvailablePool)
+    if (NumExpired > 0)
+    {
+        ActiveRecords.RemoveAt(0, NumExpired, EAllowShrinking::No);
+    }
+
+    // 2) 뷰 투영 행렬은 프레임당 한 번만 계산
+    FSceneViewProjectionData ProjectionData;
+    bool bHasProjection = false;
+    if (const APlayerController* PC = GetWorld()->GetFirstPlayerController())
     {
-        if (IsValid(Comp))
+        if (const ULocalPlayer* LocalPlayer = PC->GetLocalPlayer())
         {
-            Comp->DestroyComponent();
+            if (LocalPlayer->ViewportClient)
+            {
+                bHasProjection = LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData);
+            }
         }
     }
 
-    if (PoolOwnerActor)
+    if (!bHasProjection)
     {
-        PoolOwnerActor->Destroy();
+        for (FSFDamageTextRecord& Record : ActiveRecords)
+        {
+            Record.bOnScreen = false;
+        }
+        SET_DWORD_STAT(STAT_SFDamageText_Active, ActiveRecords.Num());
+        return;
     }
 
-    Super::Deinitialize();
-}
+    const FMatrix ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+    const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+    const float InvLifetime = 1.f / Lifetime;
 
-void USFDamageTextSubSystem::ShowDamage(float DamageAmount, AActor* TargetActor, FVector HitLocation, bool bIsCritical)
-{
-    if (!TargetActor || !DamageWidgetClass) return;
+    // 3) 투영 + 커브 평가 한 번에
+    for (FSFDamageTextRecord& Record : ActiveRecords)
+    {
+        FVector2D ScreenPosition;
+        Record.bOnScreen = FSceneView::ProjectWorldToScreen(Record.WorldLocation, ViewRect, ViewProjectionMatrix, ScreenPosition);
+        if (!Record.bOnScreen)
+        {
+            continue;
+        }
 
-    UWidgetComponent* WidgetComp = GetFromPool();
-    if (!WidgetComp) return;
-    
-    FVector SpawnLocation = CalcDamageTextLocation(TargetActor, HitLocation);
-    
-    SpawnLocation += FMath::VRand() * 10.f;
+        const float Alpha = FMath::Clamp(Record.Age * InvLifetime, 0.f, 1.f);
 
-    WidgetComp->SetWorldLocation(SpawnLocation);
-    WidgetComp->SetVisibility(true);
+        const float Rise = RiseCurve ? RiseCurve->GetFloatValue(Alpha) : FMath::InterpEaseOut(0.f, 1.f, Alpha, 2.f);
+        Record.Scale = ScaleCurve ? ScaleCurve->GetFloatValue(Alpha) : (Alpha < 0.1f ? FMath::Lerp(1.5f, 1.f, Alpha * 10.f) : 1.f);
+        Record.Opacity = OpacityCurve ? OpacityCurve->GetFloatValue(Alpha) : FMath::Clamp((1.f - Alpha) / 0.3f, 0.f, 1.f);
 
-    if (USFDamageWidget* DamageWidget = Cast<USFDamageWidget>(WidgetComp->GetUserWidgetObject()))
-    {
-        ActiveWidgetMap.Add(DamageWidget, WidgetComp);
-        DamageWidget->OnFinished.RemoveAll(this);
-        DamageWidget->OnFinished.AddDynamic(this, &ThisClass::OnWidgetAnimationFinished);
-        DamageWidget->PlayDamageEffect(DamageAmount, bIsCritical);
+        Record.ScreenPosition = ScreenPosition - FVector2D(0.f, Rise * RiseDistance);
     }
+
+    SET_DWORD_STAT(STAT_SFDamageText_Active, ActiveRecords.Num());
 }
 
-UWidgetComponent* USFDamageTextSubSystem::GetFromPool()
+void USFDamageTextSubSystem::EnsureLayer()
 {
-    if (AvailablePool.Num() > 0)
+    if (DamageTextLayer.IsValid())
     {
-        return AvailablePool.Pop();
+        return;
     }
 
-    if (!PoolOwnerActor)
+    UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport();
+    if (!ViewportClient)
     {
-        PoolOwnerActor = GetWorld()->SpawnActor<AActor>();
+        return;
     }
 
-    UWidgetComponent* NewComp = NewObject<UWidgetComponent>(PoolOwnerActor);
-    NewComp->SetWidgetClass(DamageWidgetClass);
-    NewComp->SetWidgetSpace(EWidgetSpace::Screen); 
-    NewComp->SetDrawAtDesiredSize(true);
-    NewComp->RegisterComponent();
-    
-    return NewComp;
+    DamageTextLayer = SNew(SSFDamageTextLayer).DamageTextSubsystem(this);
+    ViewportClient->AddViewportWidgetContent(DamageTextLayer.ToSharedRef(), DamageTextLayerZOrder);
 }
 
-void USFDamageTextSubSystem::OnWidgetAnimationFinished(UUserWidget* Widget)
+void USFDamageTextSubSystem::RemoveLayer()
 {
-    if (auto* FoundComp = ActiveWidgetMap.Find(Widget))
+    if (!DamageTextLayer.IsValid())
     {
-        ReturnToPool(*FoundComp);
-        ActiveWidgetMap.Remove(Widget);
+        return;
     }
-}
 
-void USFDamageTextSubSystem::ReturnToPool(UWidgetComponent* Component)
-{
-    if (Component)
+    if (UWorld* World = GetWorld())
     {
-        Component->SetVisibility(false);
-        AvailablePool.Add(Component);
+        if (UGameViewportClient* ViewportClient = World->GetGameViewport())
+        {
+            ViewportClient->RemoveViewportWidgetContent(DamageTextLayer.ToSharedRef());
+        }
     }
+    DamageTextLayer.Reset();
 }
 
 FVector USFDamageTextSubSystem::CalcDamageTextLocation(AActor* TargetActor, FVector HitLocation)
@@ -124,4 +227,4 @@ FVector USFDamageTextSubSystem::CalcDamageTextLocation(AActor* TargetActor, FVec
     }
     
     return TargetActor->GetActorLocation();
-}
\ No newline at end of file
+}
@@ -3,44 +3,96 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameFramework/GameplayMessageSubsystem.h"
+#include "Fonts/SlateFontInfo.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "SFDamageTextSubSystem.generated.h"
 
+class SSFDamageTextLayer;
+class UCurveFloat;
 
-class USFDamageWidget;
-class UWidgetComponent;
 /**
- * 
+ * 화면에 표시 중인 데미지 텍스트 하나
+ * 위젯 대신 가벼운 레코드로 보관하고, SSFDamageTextLayer가 한 번에 그린다
+ */
+struct FSFDamageTextRecord
+{
+	// 표시 기준 월드 위치
+	FVector WorldLocation = FVector::ZeroVector;
+
+	// 이번 프레임에 투영 + 애니메이션이 적용된 뷰포트 픽셀 좌표 (텍스트 중심)
+	FVector2D ScreenPosition = FVector2D::ZeroVector;
+
+	// 생성 시 한 번만 포맷/측정
+	FString Text;
+	FVector2f TextSize = FVector2f::ZeroVector;
+
+	float Age = 0.f;
+	float Scale = 1.f;
+	float Opacity = 1.f;
+
+	bool bCritical = false;
+	bool bOnScreen = false;
+};
+
+/**
+ * USFDamageTextSubSystem
+ * 클라이언트 데미지 텍스트 렌더러
+ * - 히트마다 UMG 위젯을 만들지 않고 레코드(위치/값/크리티컬/수명)만 추가
+ * - 투영과 애니메이션 커브 평가는 Tick에서 프레임당 한 번에 처리
+ * - MaxActiveDamageTexts 초과 시 가장 오래된 레코드부터 제거
+ * - 비용은 stat SFDamageText 로 측정
  */
 UCLASS()
-class SF_API USFDamageTextSubSystem : public UWorldSubsystem
+class SF_API USFDamageTextSubSystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+
+	//~UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of UTickableWorldSubsystem interface
 	
 	void ShowDamage(float DamageAmount, AActor* TargetActor, FVector HitLocation, bool bIsCritical);
 
+	// SSFDamageTextLayer용
+	const TArray<FSFDamageTextRecord>& GetActiveRecords() const { return ActiveRecords; }
+	const FSlateFontInfo& GetDamageTextFont() const { return DamageTextFont; }
+	const FLinearColor& GetNormalColor() const { return NormalColor; }
+	const FLinearColor& GetCriticalColor() const { return CriticalColor; }
+	float GetCriticalScale() const { return CriticalScale; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
 private:
-	UWidgetComponent* GetFromPool();
-	void ReturnToPool(UWidgetComponent* Component);
+	void EnsureLayer();
+	void RemoveLayer();
 	FVector CalcDamageTextLocation(AActor* TargetActor, FVector HitLocation);
 
-	UFUNCTION()
-	void OnWidgetAnimationFinished(UUserWidget* Widget);
+private:
+	// 오래된 순으로 정렬 (수명이 같으므로 앞쪽부터 만료)
+	TArray<FSFDamageTextRecord> ActiveRecords;
 
-	UPROPERTY()
-	TSubclassOf<USFDamageWidget> DamageWidgetClass;
+	TSharedPtr<SSFDamageTextLayer> DamageTextLayer;
 
 	UPROPERTY()
-	TObjectPtr<AActor> PoolOwnerActor;
+	TObjectPtr<UCurveFloat> RiseCurve;
 
 	UPROPERTY()
-	TArray<TObjectPtr<UWidgetComponent>> AvailablePool;
+	TObjectPtr<UCurveFloat> ScaleCurve;
 
 	UPROPERTY()
-	TMap<TObjectPtr<UUserWidget>, TObjectPtr<UWidgetComponent>> ActiveWidgetMap;
+	TObjectPtr<UCurveFloat> OpacityCurve;
+
+	FSlateFontInfo DamageTextFont;
+	FLinearColor NormalColor = FLinearColor::White;
+	FLinearColor CriticalColor = FLinearColor::Red;
+	float CriticalScale = 1.f;
+	float Lifetime = 1.f;
+	float RiseDistance = 0.f;
+	int32 MaxActiveRecords = 0;
 };
@@ -0,0 +1,272 @@
+#include "System/SFEnemyHealthBarSubsystem.h"
+#include "SFDamageSettings.h"
+#include "Algo/Reverse.h"
+#include "Character/Enemy/Component/SFEnemyWidgetComponent.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+#include "UI/Slate/SFEnemyHealthBarLayer.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFEnemyHealthBarSubsystem)
+
+DECLARE_STATS_GROUP(TEXT("SF Enemy Health Bar"), STATGROUP_SFEnemyHealthBar, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("HealthBar Update"), STAT_SFEnemyHealthBar_Update, STATGROUP_SFEnemyHealthBar);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Health Bars"), STAT_SFEnemyHealthBar_Active, STATGROUP_SFEnemyHealthBar);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Visible Health Bars"), STAT_SFEnemyHealthBar_Visible, STATGROUP_SFEnemyHealthBar);
+
+// 체력바 레이어 ZOrder (데미지 텍스트보다 아래)
+static constexpr int32 EnemyHealthBarLayerZOrder = 4;
+
+USFEnemyHealthBarSubsystem* USFEnemyHealthBarSubsystem::Get(const UObject* WorldContextObject)
+{
+    if (!WorldContextObject)
+    {
+        return nullptr;
+    }
+
+    const UWorld* World = WorldContextObject->GetWorld();
+    return World ? World->GetSubsystem<USFEnemyHealthBarSubsystem>() : nullptr;
+}
+
+void USFEnemyHealthBarSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (const USFDamageSettings* Settings = GetDefault<USFDamageSettings>())
+    {
+        BarSize = FVector2f(Settings->EnemyHealthBarSize);
+        BackgroundColor = Settings->EnemyHealthBarBackgroundColor;
+        DelayedColor = Settings->EnemyHealthBarDelayedColor;
+        InterpSpeed = Settings->EnemyHealthBarInterpSpeed;
+        FadeStartRatio = FMath::Clamp(Settings->EnemyHealthBarFadeStartRatio, 0.f, 1.f);
+        FadeOutTime = FMath::Max(0.f, Settings->EnemyHealthBarFadeOutTime);
+        MaxVisibleBars = FMath::Max(1, Settings->MaxVisibleEnemyHealthBars);
+    }
+
+    VisibleRecordIndices.Reserve(MaxVisibleBars);
+}
+
+void USFEnemyHealthBarSubsystem::Deinitialize()
+{
+    RemoveLayer();
+    ActiveRecords.Empty();
+    RecordIndexByAnchor.Empty();
+    VisibleRecordIndices.Empty();
+
+    Super::Deinitialize();
+}
+
+bool USFEnemyHealthBarSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USFEnemyHealthBarSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USFEnemyHealthBarSubsystem, STATGROUP_Tickables);
+}
+
+void USFEnemyHealthBarSubsystem::ShowHealthBar(const USFEnemyWidgetComponent* Anchor, float HealthPercent, float Duration, float MaxRenderDistance, const FLinearColor& FillColor)
+{
+    if (!Anchor || GetWorld()->GetNetMode() == NM_DedicatedServer) return;
+
+    EnsureLayer();
+
+    if (const int32* ExistingIndex = RecordIndexByAnchor.Find(FObjectKey(Anchor)))
+    {
+        FSFEnemyHealthBarRecord& Record = ActiveRecords[*ExistingIndex];
+        Record.TimeRemaining = Duration;
+        Record.MaxRenderDistance = MaxRenderDistance;
+        Record.FillColor = FillColor;
+        UpdateHealthPercent(Anchor, HealthPercent);
+        return;
+    }
+
+    // 새로 표시되는 바는 보간 없이 현재 체력에서 시작
+    FSFEnemyHealthBarRecord& Record = ActiveRecords.AddDefaulted_GetRef();
+    Record.Anchor = Anchor;
+    Record.AnchorKey = FObjectKey(Anchor);
+    Record.FillColor = FillColor;
+    Record.MaxRenderDistance = MaxRenderDistance;
+    Record.TimeRemaining = Duration;
+    Record.TargetPercent = Record.CurrentPercent = Record.DelayedPercent = FMath::Clamp(HealthPercent, 0.f, 1.f);
+
+    RecordIndexByAnchor.Add(Record.AnchorKey, ActiveRecords.Num() - 1);
+}
+
+void USFEnemyHealthBarSubsystem::UpdateHealthPercent(const USFEnemyWidgetComponent* Anchor, float HealthPercent)
+{
+    const int32* Index = RecordIndexByAnchor.Find(FObjectKey(Anchor));
+    if (!Index)
+    {
+        return;
+    }
+
+    FSFEnemyHealthBarRecord& Record = ActiveRecords[*Index];
+    Record.TargetPercent = FMath::Clamp(HealthPercent, 0.f, 1.f);
+
+    // 감소: 현재 바 즉시, 잔상 바가 따라감 / 회복: 잔상 바 즉시, 현재 바가 따라감
+    if (Record.TargetPercent < Record.CurrentPercent)
+    {
+        Record.CurrentPercent = Record.TargetPercent;
+    }
+    else
+    {
+        Record.DelayedPercent = Record.TargetPercent;
+    }
+}
+
+void USFEnemyHealthBarSubsystem::HideHealthBar(const USFEnemyWidgetComponent* Anchor)
+{
+    if (const int32* Index = RecordIndexByAnchor.Find(FObjectKey(Anchor)))
+    {
+        RemoveRecordAt(*Index);
+    }
+}
+
+void USFEnemyHealthBarSubsystem::RemoveRecordAt(int32 Index)
+{
+    RecordIndexByAnchor.Remove(ActiveRecords[Index].AnchorKey);
+
+    const int32 LastIndex = ActiveRecords.Num() - 1;
+    if (Index != LastIndex)
+    {
+        RecordIndexByAnchor[ActiveRecords[LastIndex].AnchorKey] = Index;
+    }
+
+    ActiveRecords.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void USFEnemyHealthBarSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SFEnemyHealthBar_Update);
+
+    VisibleRecordIndices.Reset();
+
+    if (ActiveRecords.Num() == 0)
+    {
+        SET_DWORD_STAT(STAT_SFEnemyHealthBar_Active, 0);
+        SET_DWORD_STAT(STAT_SFEnemyHealthBar_Visible, 0);
+        return;
+    }
+
+    // 1) 표시 시간 경과 + 만료/파괴된 앵커 제거, 바 보간
+    for (int32 Index = ActiveRecords.Num() - 1; Index >= 0; --Index)
+    {
+        FSFEnemyHealthBarRecord& Record = ActiveRecords[Index];
+        Record.TimeRemaining -= DeltaTime;
+        if (Record.TimeRemaining <= 0.f || !Record.Anchor.IsValid())
+        {
+            RemoveRecordAt(Index);
+            continue;
+        }
+
+        Record.CurrentPercent = FMath::FInterpTo(Record.CurrentPercent, Record.TargetPercent, DeltaTime, InterpSpeed);
+        Record.DelayedPercent = FMath::FInterpTo(Record.DelayedPercent, Record.TargetPercent, DeltaTime, InterpSpeed);
+    }
+
+    // 2) 뷰 투영 행렬은 프레임당 한 번만 계산
+    FSceneViewProjectionData ProjectionData;
+    bool bHasProjection = false;
+    if (const APlayerController* PC = GetWorld()->GetFirstPlayerController())
+    {
+        if (const ULocalPlayer* LocalPlayer = PC->GetLocalPlayer())
+        {
+            if (LocalPlayer->ViewportClient)
+            {
+                bHasProjection = LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData);
+            }
+        }
+    }
+
+    if (!bHasProjection)
+    {
+        SET_DWORD_STAT(STAT_SFEnemyHealthBar_Active, ActiveRecords.Num());
+        SET_DWORD_STAT(STAT_SFEnemyHealthBar_Visible, 0);
+        return;
+    }
+
+    const FMatrix ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+    const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+    const FVector ViewOrigin = ProjectionData.ViewOrigin;
+
+    // 3) 거리 컬링/페이드 + 투영 한 번에
+    for (int32 Index = 0; Index < ActiveRecords.Num(); ++Index)
+    {
+        FSFEnemyHealthBarRecord& Record = ActiveRecords[Index];
+        const FVector AnchorLocation = Record.Anchor->GetComponentLocation();
+
+        Record.DistanceSq = FVector::DistSquared(ViewOrigin, AnchorLocation);
+        if (Record.DistanceSq > FMath::Square(Record.MaxRenderDistance))
+        {
+            continue;
+        }
+
+        if (!FSceneView::ProjectWorldToScreen(AnchorLocation, ViewRect, ViewProjectionMatrix, Record.ScreenPosition))
+        {
+            continue;
+        }
+
+        const float Distance = FMath::Sqrt(Record.DistanceSq);
+        const float FadeStart = Record.MaxRenderDistance * FadeStartRatio;
+        const float DistanceAlpha = FadeStart < Record.MaxRenderDistance
+            ? 1.f - FMath::Clamp((Distance - FadeStart) / (Record.MaxRenderDistance - FadeStart), 0.f, 1.f)
+            : 1.f;
+        const float TimeAlpha = FadeOutTime > 0.f ? FMath::Clamp(Record.TimeRemaining / FadeOutTime, 0.f, 1.f) : 1.f;
+
+        Record.Opacity = DistanceAlpha * TimeAlpha;
+        if (Record.Opacity > 0.f)
+        {
+            VisibleRecordIndices.Add(Index);
+        }
+    }
+
+    // 4) 상한 초과 시 가까운 바만 남기고, 먼 바부터 그리도록 정렬
+    VisibleRecordIndices.Sort([this](int32 A, int32 B)
+    {
+        return ActiveRecords[A].DistanceSq < ActiveRecords[B].DistanceSq;
+    });
+    if (VisibleRecordIndices.Num() > MaxVisibleBars)
+    {
+        VisibleRecordIndices.SetNum(MaxVisibleBars, EAllowShrinking::No);
+    }
+    Algo::Reverse(VisibleRecordIndices);
+
+    SET_DWORD_STAT(STAT_SFEnemyHealthBar_Active, ActiveRecords.Num());
+    SET_DWORD_STAT(STAT_SFEnemyHealthBar_Visible, VisibleRecordIndices.Num());
+}
+
+void USFEnemyHealthBarSubsystem::EnsureLayer()
+{
+    if (HealthBarLayer.IsValid())
+    {
+        return;
+    }
+
+    UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport();
+    if (!ViewportClient)
+    {
+        return;
+    }
+
+    HealthBarLayer = SNew(SSFEnemyHealthBarLayer).HealthBarSubsystem(this);
+    ViewportClient->AddViewportWidgetContent(HealthBarLayer.ToSharedRef(), EnemyHealthBarLayerZOrder);
+}
+
+void USFEnemyHealthBarSubsystem::RemoveLayer()
+{
+    if (!HealthBarLayer.IsValid())
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UGameViewportClient* ViewportClient = World->GetGameViewport())
+        {
+            ViewportClient->RemoveViewportWidgetContent(HealthBarLayer.ToSharedRef());
+        }
+    }
+    HealthBarLayer.Reset();
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SFEnemyHealthBarSubsystem.generated.h"
+
+class SSFEnemyHealthBarLayer;
+class USFEnemyWidgetComponent;
+
+/**
+ * 최근 피격되어 체력바를 표시 중인 적 하나
+ */
+struct FSFEnemyHealthBarRecord
+{
+	// 체력바 기준 위치 (적 머리 위)
+	TWeakObjectPtr<const USFEnemyWidgetComponent> Anchor;
+
+	// 앵커가 GC된 뒤에도 인덱스 맵을 정리할 수 있도록 키를 따로 보관
+	FObjectKey AnchorKey;
+
+	FLinearColor FillColor = FLinearColor::Red;
+	float MaxRenderDistance = 0.f;
+	float TimeRemaining = 0.f;
+
+	// 실제 체력 비율 / 표시 중인 현재 바 / 잔상 바 (UCommonBarBase와 같은 방식: 감소는 잔상이, 회복은 현재 바가 따라감)
+	float TargetPercent = 1.f;
+	float CurrentPercent = 1.f;
+	float DelayedPercent = 1.f;
+
+	// 이번 프레임에 투영된 뷰포트 픽셀 좌표 (바 상단 중앙)
+	FVector2D ScreenPosition = FVector2D::ZeroVector;
+	float Opacity = 0.f;
+	double DistanceSq = 0.0;
+};
+
+/**
+ * USFEnemyHealthBarSubsystem
+ * 클라이언트 적 체력바 렌더러
+ * - 적마다 월드 공간 위젯 컴포넌트(렌더 타깃)를 두지 않고, 피격된 적만 레코드로 등록
+ * - Tick에서 프레임당 한 번 뷰 투영 행렬을 구해 모든 앵커를 투영 + 거리 페이드
+ * - MaxVisibleEnemyHealthBars 초과 시 카메라에서 가까운 순으로 표시
+ * - SSFEnemyHealthBarLayer가 한 번의 OnPaint로 모두 그림
+ * - 비용은 stat SFEnemyHealthBar 로 측정
+ */
+UCLASS()
+class SF_API USFEnemyHealthBarSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFEnemyHealthBarSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//~UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of UTickableWorldSubsystem interface
+
+	// 피격 시 표시 (이미 표시 중이면 시간만 갱신)
+	void ShowHealthBar(const USFEnemyWidgetComponent* Anchor, float HealthPercent, float Duration, float MaxRenderDistance, const FLinearColor& FillColor);
+
+	// 표시 중일 때만 체력 비율 갱신
+	void UpdateHealthPercent(const USFEnemyWidgetComponent* Anchor, float HealthPercent);
+
+	void HideHealthBar(const USFEnemyWidgetComponent* Anchor);
+
+	// SSFEnemyHealthBarLayer용
+	const TArray<FSFEnemyHealthBarRecord>& GetActiveRecords() const { return ActiveRecords; }
+
+	// 이번 프레임에 그릴 레코드 인덱스 (먼 순서 → 가까운 바가 위에 그려짐)
+	const TArray<int32>& GetVisibleRecordIndices() const { return VisibleRecordIndices; }
+
+	const FVector2f& GetBarSize() const { return BarSize; }
+	const FLinearColor& GetBackgroundColor() const { return BackgroundColor; }
+	const FLinearColor& GetDelayedColor() const { return DelayedColor; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void RemoveRecordAt(int32 Index);
+
+	void EnsureLayer();
+	void RemoveLayer();
+
+private:
+	TArray<FSFEnemyHealthBarRecord> ActiveRecords;
+	TMap<FObjectKey, int32> RecordIndexByAnchor;
+
+	TArray<int32> VisibleRecordIndices;
+
+	TSharedPtr<SSFEnemyHealthBarLayer> HealthBarLayer;
+
+	FVector2f BarSize = FVector2f(100.f, 10.f);
+	FLinearColor BackgroundColor = FLinearColor::Black;
+	FLinearColor DelayedColor = FLinearColor::White;
+	float InterpSpeed = 2.5f;
+	float FadeStartRatio = 0.7f;
+	float FadeOutTime = 0.3f;
+	int32 MaxVisibleBars = 16;
+};
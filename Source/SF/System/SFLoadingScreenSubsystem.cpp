@@ -2,6 +2,8 @@
 #include "MoviePlayer.h"
 #include "Framework/Application/SlateApplication.h"
 #include "SFLogChannels.h"
+#include "LoadingScreenManager.h"
+#include "System/SFAssetManager.h"
 #include "Blueprint/UserWidget.h"
 #include "Engine/AssetManager.h"
 #include "Engine/GameViewportClient.h"
@@ -15,6 +17,13 @@ void USFLoadingScreenSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+    // 에셋 로드 단계가 끝날 때까지 로딩 화면 유지
+    Collection.InitializeDependency<ULoadingScreenManager>();
+    if (ULoadingScreenManager* LoadingScreenManager = GetGameInstance()->GetSubsystem<ULoadingScreenManager>())
+    {
+        LoadingScreenManager->RegisterLoadingProcessor(this);
+    }
+
     if (!LoadingConfigTable.IsNull())
     {
         FStreamableDelegate OnLoaded = FStreamableDelegate::CreateUObject(
@@ -42,6 +51,11 @@ void USFLoadingScreenSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void USFLoadingScreenSubsystem::Deinitialize()
 {
     RemoveWidgetFromViewport();
+
+    if (ULoadingScreenManager* LoadingScreenManager = GetGameInstance()->GetSubsystem<ULoadingScreenManager>())
+    {
+        LoadingScreenManager->UnregisterLoadingProcessor(this);
+    }
     
     FCoreUObjectDelegates::PreLoadMap.RemoveAll(this);
     FCoreUObjectDelegates::PostLoadMapWithWorld.RemoveAll(this);
@@ -60,6 +74,27 @@ bool USFLoadingScreenSubsystem::ShouldCreateSubsystem(UObject* Outer) const
     return !bIsServerWorld;
 }
 
+bool USFLoadingScreenSubsystem::ShouldShowLoadingScreen(FString& OutReason) const
+{
+    const USFAssetManager& AssetManager = USFAssetManager::Get();
+    if (!AssetManager.HasPendingLoadPhases())
+    {
+        return false;
+    }
+
+    TArray<FName> PendingPhases;
+    AssetManager.GetPendingLoadPhases(PendingPhases);
+    OutReason = FString::Printf(TEXT("Streaming asset load phases [%s] (%.0f%%)"),
+        *FString::JoinBy(PendingPhases, TEXT(", "), [](const FName& PhaseName) { return PhaseName.ToString(); }),
+        AssetManager.GetPendingLoadProgress() * 100.f);
+    return true;
+}
+
+float USFLoadingScreenSubsystem::GetAssetLoadProgress() const
+{
+    return USFAssetManager::Get().GetPendingLoadProgress();
+}
+
 void USFLoadingScreenSubsystem::PreloadLoadingScreenForLevel(const FString& NextLevelName)
 {
     PendingLevelName = NextLevelName;
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "LoadingProcessInterface.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "SFLoadingScreenSubsystem.generated.h"
 
@@ -32,10 +33,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FPreLoadingScreenWidgetChangedDelega
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FLoadingScreenWidgetChangedDelegate, TSubclassOf<UUserWidget>, NewWidgetClass);
 
 /**
- * 
+ * USFLoadingScreenSubsystem
+ * - 맵별 로딩 스크린 위젯 Preload / Hard Travel 로딩 스크린
+ * - USFAssetManager의 로드 단계가 진행 중이면 CommonLoadingScreen 로딩 화면 유지 (ILoadingProcessInterface)
  */
 UCLASS(config = Game)
-class SF_API USFLoadingScreenSubsystem : public UGameInstanceSubsystem
+class SF_API USFLoadingScreenSubsystem : public UGameInstanceSubsystem, public ILoadingProcessInterface
 {
 	GENERATED_BODY()
 public:
@@ -43,6 +46,14 @@ public:
 	virtual void Deinitialize() override;
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
 
+	//~ILoadingProcessInterface interface
+	virtual bool ShouldShowLoadingScreen(FString& OutReason) const override;
+	//~End of ILoadingProcessInterface interface
+
+	// 진행 중인 에셋 로드 단계의 진행률 (0~1, 없으면 1). 로딩 위젯 프로그레스 바용
+	UFUNCTION(BlueprintPure, Category = "SF|Loading")
+	float GetAssetLoadProgress() const;
+
 	/** 
 	 * 다음 레벨의 로딩 스크린 미리 로드 
 	 * @param NextLevelName 이동할 레벨 이름
@@ -3,8 +3,17 @@
 
 #include "SFMinimapSubsystem.h"
 
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AbilitySystemInterface.h"
+#include "Character/SFCharacterGameplayTags.h"
 #include "Interface/SFMiniMapTrackable.h"
 
+DECLARE_STATS_GROUP(TEXT("SF MiniMap"), STATGROUP_SFMiniMap, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Refresh Targets"), STAT_SFMiniMap_Refresh, STATGROUP_SFMiniMap);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targets"), STAT_SFMiniMap_NumTargets, STATGROUP_SFMiniMap);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interface Position Calls"), STAT_SFMiniMap_InterfaceCalls, STATGROUP_SFMiniMap);
+
 void USFMinimapSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -14,16 +23,48 @@ void USFMinimapSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void USFMinimapSubsystem::Deinitialize()
 {
 	Targets.Empty();
+	Positions.Empty();
+	Types.Empty();
+	PositionSources.Empty();
+	AbilitySystems.Empty();
+	CanHaveASCBits.Empty();
+	DownedBits.Empty();
+	TargetKeys.Empty();
+	IndexByObject.Empty();
 	Super::Deinitialize();
 }
 
 void USFMinimapSubsystem::RegisterTarget(TScriptInterface<ISFMiniMapTrackable> Target)
 {
-	if (Targets.Contains(Target))
+	UObject* TargetObj = Target.GetObject();
+	if (!TargetObj || IndexByObject.Contains(TargetObj))
 	{
 		return;
 	}
-	Targets.Add(Target);
+
+	// 위치를 BP에서 바꾸지 않은 액터는 루트 컴포넌트 위치를 직접 사용
+	USceneComponent* PositionSource = nullptr;
+	if (const AActor* Actor = Cast<AActor>(TargetObj))
+	{
+		if (!TargetObj->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ISFMiniMapTrackable, GetMiniMapWorldPosition)))
+		{
+			PositionSource = Actor->GetRootComponent();
+		}
+	}
+
+	const int32 Index = Targets.Add(Target);
+	Types.Add(ISFMiniMapTrackable::Execute_GetMiniMapIconType(TargetObj));
+	Positions.Add(PositionSource ? PositionSource->GetComponentLocation() : ISFMiniMapTrackable::Execute_GetMiniMapWorldPosition(TargetObj));
+	PositionSources.Add(PositionSource);
+	// ASC도 IAbilitySystemInterface도 없는 대상(상자, 포탈 등)은 "ASC 없음"을 캐시해 갱신 때 다시 조회하지 않음
+	AActor* TargetActor = Cast<AActor>(TargetObj);
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(TargetActor);
+	AbilitySystems.Add(ASC);
+	CanHaveASCBits.Add(ASC || Cast<IAbilitySystemInterface>(TargetActor));
+	DownedBits.Add(false);
+	TargetKeys.Add(TargetObj);
+	IndexByObject.Add(TargetObj, Index);
+
 	OnTargetRegistered.Broadcast(Target);
 }
 
@@ -34,22 +75,86 @@ void USFMinimapSubsystem::UnregisterTarget(TScriptInterface<ISFMiniMapTrackable>
 		return;
 	}
 
-	int32 Removed = Targets.Remove(Target);
-	if (Removed > 0)
+	if (const int32* Index = IndexByObject.Find(Target.GetObject()))
 	{
+		RemoveTargetAt(*Index);
 		OnTargetUnregistered.Broadcast(Target);
+	}
+}
+
+void USFMinimapSubsystem::RemoveTargetAt(int32 Index)
+{
+	IndexByObject.Remove(TargetKeys[Index]);
+
+	const int32 LastIndex = Targets.Num() - 1;
+	if (Index != LastIndex)
+	{
+		IndexByObject[TargetKeys[LastIndex]] = Index;
+	}
+
+	Targets.RemoveAtSwap(Index);
+	Positions.RemoveAtSwap(Index);
+	Types.RemoveAtSwap(Index);
+	PositionSources.RemoveAtSwap(Index);
+	AbilitySystems.RemoveAtSwap(Index);
+	CanHaveASCBits.RemoveAtSwap(Index);
+	DownedBits.RemoveAtSwap(Index);
+	TargetKeys.RemoveAtSwap(Index);
+}
+
+void USFMinimapSubsystem::RefreshTargets()
+{
+	if (LastRefreshFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastRefreshFrame = GFrameCounter;
+
+	SCOPE_CYCLE_COUNTER(STAT_SFMiniMap_Refresh);
+
+	int32 NumInterfaceCalls = 0;
 
+	for (int32 Index = Targets.Num() - 1; Index >= 0; --Index)
+	{
+		UObject* TargetObj = Targets[Index].GetObject();
+		if (!IsValid(TargetObj))
+		{
+			// 해제 없이 파괴된 대상 정리
+			RemoveTargetAt(Index);
+			continue;
+		}
+
+		if (const USceneComponent* PositionSource = PositionSources[Index].Get())
+		{
+			Positions[Index] = PositionSource->GetComponentLocation();
+		}
+		else
+		{
+			Positions[Index] = ISFMiniMapTrackable::Execute_GetMiniMapWorldPosition(TargetObj);
+			++NumInterfaceCalls;
+		}
+
+		const UAbilitySystemComponent* ASC = AbilitySystems[Index].Get();
+		if (!ASC && CanHaveASCBits[Index])
+		{
+			ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Cast<AActor>(TargetObj));
+			AbilitySystems[Index] = const_cast<UAbilitySystemComponent*>(ASC);
+		}
+		DownedBits[Index] = ASC && ASC->HasMatchingGameplayTag(SFGameplayTags::Character_State_Downed);
 	}
+
+	SET_DWORD_STAT(STAT_SFMiniMap_NumTargets, Targets.Num());
+	SET_DWORD_STAT(STAT_SFMiniMap_InterfaceCalls, NumInterfaceCalls);
 }
 
 TArray<TScriptInterface<ISFMiniMapTrackable>> USFMinimapSubsystem::GetTargetsByType(EMiniMapIconType Type) const
 {
 	TArray<TScriptInterface<ISFMiniMapTrackable>> Filtered;
-	for (const auto& Target : Targets)
+	for (int32 Index = 0; Index < Types.Num(); ++Index)
 	{
-		if (Target && Target->Execute_GetMiniMapIconType(Target.GetObject()) == Type)
+		if (Types[Index] == Type && Targets[Index])
 		{
-			Filtered.Add(Target);
+			Filtered.Add(Targets[Index]);
 		}
 	}
 	return Filtered;
@@ -59,5 +164,3 @@ const TArray<TScriptInterface<ISFMiniMapTrackable>>& USFMinimapSubsystem::GetAll
 {
 	return Targets;
 }
-
-
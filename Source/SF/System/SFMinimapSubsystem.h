@@ -5,14 +5,22 @@
 #include "CoreMinimal.h"
 #include "Interface/SFMiniMapTrackable.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "SFMinimapSubsystem.generated.h"
 
+class UAbilitySystemComponent;
+class USceneComponent;
+
 
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMiniMapTargetChanged, TScriptInterface<ISFMiniMapTrackable>, Target);
 
 /**
- * 
+ * USFMinimapSubsystem
+ * 미니맵 대상 등록 + 대상 위치/타입을 구조체 배열(SoA)로 보관
+ * - 타입/위치 소스(루트 컴포넌트)/ASC는 등록 시 한 번만 조회
+ * - RefreshTargets: 프레임당 한 번 루트 컴포넌트의 캐시된 트랜스폼에서 위치 갱신 (위젯이 여러 개여도 한 번)
+ * - 위치 함수를 BP에서 오버라이드했거나 액터가 아닌 대상만 인터페이스 호출
  */
 UCLASS()
 class SF_API USFMinimapSubsystem : public UWorldSubsystem
@@ -34,6 +42,16 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category = "MiniMap")
 	TArray<TScriptInterface<ISFMiniMapTrackable>> GetTargetsByType(EMiniMapIconType Type) const;
+
+	// 이번 프레임 위치/상태 갱신 (같은 프레임에 다시 호출하면 무시)
+	void RefreshTargets();
+
+	// SoA 접근 (모두 GetAllTargets와 같은 인덱스, 값은 마지막 RefreshTargets 기준)
+	int32 GetNumTargets() const { return Targets.Num(); }
+	const TArray<FVector>& GetTargetPositions() const { return Positions; }
+	const TArray<EMiniMapIconType>& GetTargetTypes() const { return Types; }
+	bool IsTargetDowned(int32 Index) const { return DownedBits[Index]; }
+	UObject* GetTargetObject(int32 Index) const { return Targets[Index].GetObject(); }
 	
 	UPROPERTY(BlueprintAssignable, Category = "MiniMap")
 	FOnMiniMapTargetChanged OnTargetRegistered;
@@ -41,7 +59,30 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "MiniMap")
 	FOnMiniMapTargetChanged OnTargetUnregistered;
 	
+private:
+	void RemoveTargetAt(int32 Index);
+
 private:
 	UPROPERTY()
 	TArray<TScriptInterface<ISFMiniMapTrackable>> Targets;
+
+	TArray<FVector> Positions;
+	TArray<EMiniMapIconType> Types;
+
+	// 루트 컴포넌트 위치를 그대로 쓰는 대상 (null이면 GetMiniMapWorldPosition 호출)
+	TArray<TWeakObjectPtr<USceneComponent>> PositionSources;
+
+	// 다운 상태 확인용 (영웅 ASC는 PlayerState에 있어 등록 후에 생길 수 있으므로 비어 있으면 갱신 때 다시 조회)
+	TArray<TWeakObjectPtr<UAbilitySystemComponent>> AbilitySystems;
+
+	// ASC를 가질 수 있는 대상 (등록 시 ASC 또는 IAbilitySystemInterface가 있었음). 꺼져 있으면 갱신 때 다시 조회하지 않음
+	TBitArray<> CanHaveASCBits;
+
+	TBitArray<> DownedBits;
+
+	// 대상이 GC된 뒤에도 인덱스 맵을 정리할 수 있도록 키를 따로 보관
+	TArray<TObjectKey<UObject>> TargetKeys;
+	TMap<TObjectKey<UObject>, int32> IndexByObject;
+
+	uint64 LastRefreshFrame = MAX_uint64;
 };
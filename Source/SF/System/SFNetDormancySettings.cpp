@@ -0,0 +1 @@
+#include "SFNetDormancySettings.h"
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "SFNetDormancySettings.generated.h"
+
+/**
+ * 월드 상호작용 액터 Net Dormancy(USFNetDormancySubsystem) 설정
+ */
+UCLASS(Config=Game, DefaultConfig, meta = (DisplayName = "SF Net Dormancy Settings"))
+class SF_API USFNetDormancySettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	// false면 등록된 액터를 항상 깨어 있는 상태로 두고 기존처럼 매 틱 복제 대상으로 고려
+	UPROPERTY(Config, EditAnywhere, Category = "Dormancy")
+	bool bEnableNetDormancy = true;
+
+	// WakeActor 후 다시 Dormant로 돌아가기까지의 시간(초). 변경된 프로퍼티/RPC가 전송될 만큼만 유지
+	UPROPERTY(Config, EditAnywhere, Category = "Dormancy", meta = (ClampMin = "0.1", Units = "s"))
+	float AwakeDuration = 1.f;
+};
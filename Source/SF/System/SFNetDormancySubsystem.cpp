@@ -0,0 +1,333 @@
+#include "System/SFNetDormancySubsystem.h"
+
+#include "SFLogChannels.h"
+#include "SFNetDormancySettings.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFNetDormancySubsystem)
+
+DECLARE_STATS_GROUP(TEXT("SF Net Dormancy"), STATGROUP_SFNetDormancy, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("NetDormancy Tick"), STAT_SFNetDormancy_Tick, STATGROUP_SFNetDormancy);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Actors"), STAT_SFNetDormancy_Managed, STATGROUP_SFNetDormancy);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Awake Actors"), STAT_SFNetDormancy_Awake, STATGROUP_SFNetDormancy);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Network Objects"), STAT_SFNetDormancy_ActiveObjects, STATGROUP_SFNetDormancy);
+
+// 프로파일 전환 후 채널이 열리고/닫힐 때까지 기다리는 프레임 수
+static constexpr int32 NetDormancyProfileSettleFrames = 60;
+
+USFNetDormancySubsystem* USFNetDormancySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<USFNetDormancySubsystem>() : nullptr;
+}
+
+void USFNetDormancySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (const USFNetDormancySettings* Settings = GetDefault<USFNetDormancySettings>())
+	{
+		bDormancyEnabled = Settings->bEnableNetDormancy;
+		DefaultAwakeDuration = FMath::Max(0.1f, Settings->AwakeDuration);
+	}
+}
+
+void USFNetDormancySubsystem::Deinitialize()
+{
+	ManagedActors.Empty();
+	NumAwakeActors = 0;
+	ProfilePhase = EProfilePhase::None;
+
+	Super::Deinitialize();
+}
+
+bool USFNetDormancySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USFNetDormancySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USFNetDormancySubsystem, STATGROUP_Tickables);
+}
+
+bool USFNetDormancySubsystem::IsServerWorld() const
+{
+	const ENetMode NetMode = GetWorld()->GetNetMode();
+	return NetMode == NM_DedicatedServer || NetMode == NM_ListenServer;
+}
+
+void USFNetDormancySubsystem::RegisterActor(AActor* Actor)
+{
+	if (!Actor || !Actor->HasAuthority() || !IsServerWorld())
+	{
+		return;
+	}
+
+	// 클래스 기본값/인스턴스에서 Awake로 지정한 액터는 관리하지 않음
+	if (Actor->NetDormancy != DORM_Initial && Actor->NetDormancy != DORM_DormantAll)
+	{
+		return;
+	}
+
+	FManagedActor& Entry = ManagedActors.FindOrAdd(FObjectKey(Actor));
+	Entry.Actor = Actor;
+
+	if (!bDormancyEnabled)
+	{
+		SetAwake(Entry, true);
+		return;
+	}
+
+	// DORM_Initial은 레벨 배치 액터에만 의미가 있음. 스폰 액터는 최초 복제 후 채널을 닫음
+	if (Actor->NetDormancy == DORM_Initial && !Actor->IsNetStartupActor())
+	{
+		Actor->SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+void USFNetDormancySubsystem::UnregisterActor(AActor* Actor)
+{
+	if (const FManagedActor* Entry = ManagedActors.Find(FObjectKey(Actor)))
+	{
+		NumAwakeActors -= Entry->bAwake ? 1 : 0;
+		ManagedActors.Remove(FObjectKey(Actor));
+	}
+}
+
+void USFNetDormancySubsystem::WakeActor(AActor* Actor, float AwakeDuration)
+{
+	if (!Actor || !Actor->HasAuthority())
+	{
+		return;
+	}
+
+	FManagedActor* Entry = ManagedActors.Find(FObjectKey(Actor));
+	if (!Entry)
+	{
+		// 관리 대상이 아니면 일반 액터처럼 즉시 갱신만
+		Actor->ForceNetUpdate();
+		return;
+	}
+
+	const double WakeUntil = GetWorld()->GetTimeSeconds() + (AwakeDuration > 0.f ? AwakeDuration : DefaultAwakeDuration);
+	Entry->AwakeUntil = FMath::Max(Entry->AwakeUntil, WakeUntil);
+
+	if (Entry->bAwake)
+	{
+		Actor->ForceNetUpdate();
+	}
+	else
+	{
+		SetAwake(*Entry, true);
+	}
+}
+
+void USFNetDormancySubsystem::SetActorPinnedAwake(AActor* Actor, bool bPinned)
+{
+	FManagedActor* Entry = Actor ? ManagedActors.Find(FObjectKey(Actor)) : nullptr;
+	if (!Entry || Entry->bPinned == bPinned)
+	{
+		return;
+	}
+
+	Entry->bPinned = bPinned;
+
+	// 고정 시 깨우고, 해제 시 마지막 변경분이 전송될 시간만큼 더 유지
+	WakeActor(Actor);
+}
+
+void USFNetDormancySubsystem::SetAwake(FManagedActor& Entry, bool bAwake)
+{
+	AActor* Actor = Entry.Actor.Get();
+	if (!Actor || Entry.bAwake == bAwake)
+	{
+		return;
+	}
+
+	Entry.bAwake = bAwake;
+	NumAwakeActors += bAwake ? 1 : -1;
+
+	if (bAwake)
+	{
+		Actor->SetNetDormancy(DORM_Awake);
+		Actor->ForceNetUpdate();
+	}
+	else
+	{
+		// 대기 중인 변경분을 모두 보낸 뒤 채널이 닫힘
+		Actor->SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+void USFNetDormancySubsystem::SetDormancyEnabled(bool bEnabled)
+{
+	if (bDormancyEnabled == bEnabled)
+	{
+		return;
+	}
+
+	bDormancyEnabled = bEnabled;
+
+	// 끌 때는 전부 깨우고, 켤 때는 Tick에서 만료된 액터부터 Dormant로 돌아감
+	if (!bEnabled)
+	{
+		for (TPair<FObjectKey, FManagedActor>& Pair : ManagedActors)
+		{
+			SetAwake(Pair.Value, true);
+		}
+	}
+}
+
+void USFNetDormancySubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SFNetDormancy_Tick);
+
+	if (NumAwakeActors > 0 && bDormancyEnabled)
+	{
+		const double Now = GetWorld()->GetTimeSeconds();
+		for (auto It = ManagedActors.CreateIterator(); It; ++It)
+		{
+			FManagedActor& Entry = It.Value();
+			if (!Entry.Actor.IsValid())
+			{
+				NumAwakeActors -= Entry.bAwake ? 1 : 0;
+				It.RemoveCurrent();
+				continue;
+			}
+
+			if (Entry.bAwake && !Entry.bPinned && Now >= Entry.AwakeUntil)
+			{
+				SetAwake(Entry, false);
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_SFNetDormancy_Managed, ManagedActors.Num());
+	SET_DWORD_STAT(STAT_SFNetDormancy_Awake, NumAwakeActors);
+	SET_DWORD_STAT(STAT_SFNetDormancy_ActiveObjects, GetNumActiveNetworkObjects());
+
+	if (ProfilePhase != EProfilePhase::None)
+	{
+		TickProfile();
+	}
+}
+
+int32 USFNetDormancySubsystem::GetNumActiveNetworkObjects() const
+{
+	const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	return NetDriver ? NetDriver->GetNetworkObjectList().GetActiveObjects().Num() : 0;
+}
+
+int32 USFNetDormancySubsystem::GetNumClientConnections() const
+{
+	const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	return NetDriver ? NetDriver->ClientConnections.Num() : 0;
+}
+
+void USFNetDormancySubsystem::StartProfile(int32 SampleFrames)
+{
+	if (!IsServerWorld())
+	{
+		UE_LOG(LogSF, Warning, TEXT("SF.NetDormancy.Profile: run on the server (listen or dedicated)"));
+		return;
+	}
+
+	ProfileSampleFrames = FMath::Max(1, SampleFrames);
+	ProfileFramesRemaining = NetDormancyProfileSettleFrames;
+	ProfileActiveObjectSum = 0;
+	ProfileAwakeAverage = 0.0;
+	ProfilePhase = EProfilePhase::SettleAwake;
+
+	SetDormancyEnabled(false);
+
+	UE_LOG(LogSF, Display, TEXT("SF.NetDormancy.Profile: sampling %d frames with dormancy off, then on (%d managed actors, %d connections)"),
+		ProfileSampleFrames, ManagedActors.Num(), GetNumClientConnections());
+}
+
+void USFNetDormancySubsystem::TickProfile()
+{
+	if (ProfilePhase == EProfilePhase::SampleAwake || ProfilePhase == EProfilePhase::SampleDormant)
+	{
+		ProfileActiveObjectSum += GetNumActiveNetworkObjects();
+	}
+
+	if (--ProfileFramesRemaining > 0)
+	{
+		return;
+	}
+
+	switch (ProfilePhase)
+	{
+	case EProfilePhase::SettleAwake:
+		ProfilePhase = EProfilePhase::SampleAwake;
+		ProfileFramesRemaining = ProfileSampleFrames;
+		ProfileActiveObjectSum = 0;
+		break;
+
+	case EProfilePhase::SampleAwake:
+		ProfileAwakeAverage = static_cast<double>(ProfileActiveObjectSum) / ProfileSampleFrames;
+		SetDormancyEnabled(true);
+		ProfilePhase = EProfilePhase::SettleDormant;
+		ProfileFramesRemaining = NetDormancyProfileSettleFrames;
+		break;
+
+	case EProfilePhase::SettleDormant:
+		ProfilePhase = EProfilePhase::SampleDormant;
+		ProfileFramesRemaining = ProfileSampleFrames;
+		ProfileActiveObjectSum = 0;
+		break;
+
+	case EProfilePhase::SampleDormant:
+	{
+		const double DormantAverage = static_cast<double>(ProfileActiveObjectSum) / ProfileSampleFrames;
+		const int32 NumConnections = FMath::Max(1, GetNumClientConnections());
+		const double Reduction = ProfileAwakeAverage > 0.0 ? (1.0 - DormantAverage / ProfileAwakeAverage) * 100.0 : 0.0;
+
+		// 연결별 관련성/우선순위 평가는 ActiveObjects 수에 비례
+		UE_LOG(LogSF, Display, TEXT("SF.NetDormancy.Profile: %d frames, %d connections, %d managed actors"), ProfileSampleFrames, NumConnections, ManagedActors.Num());
+		UE_LOG(LogSF, Display, TEXT("  Dormancy off: %8.1f active net objects/frame, %9.1f considerations/frame"), ProfileAwakeAverage, ProfileAwakeAverage * NumConnections);
+		UE_LOG(LogSF, Display, TEXT("  Dormancy on : %8.1f active net objects/frame, %9.1f considerations/frame"), DormantAverage, DormantAverage * NumConnections);
+		UE_LOG(LogSF, Display, TEXT("  Reduction   : %.1f%% (compare NetBroadcastTickTime with 'stat net')"), Reduction);
+
+		// 설정값으로 복원
+		SetDormancyEnabled(GetDefault<USFNetDormancySettings>()->bEnableNetDormancy);
+		ProfilePhase = EProfilePhase::None;
+		break;
+	}
+
+	default:
+		ProfilePhase = EProfilePhase::None;
+		break;
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+// 사용법: SF.NetDormancy.Profile [SampleFrames]
+// 관리 액터를 모두 깨운 상태와 Dormant 상태에서 NetDriver가 매 프레임 고려하는 액터 수를 비교
+static FAutoConsoleCommandWithWorldAndArgs CVarSFNetDormancyProfile(
+	TEXT("SF.NetDormancy.Profile"),
+	TEXT("Compare replicated actors considered per frame with world interactable dormancy off and on. Args: [SampleFrames=300]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		USFNetDormancySubsystem* NetDormancy = USFNetDormancySubsystem::Get(World);
+		if (!NetDormancy)
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.NetDormancy.Profile: no net dormancy subsystem in this world"));
+			return;
+		}
+
+		const int32 SampleFrames = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 300;
+		NetDormancy->StartProfile(SampleFrames);
+	}));
+
+#endif
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SFNetDormancySubsystem.generated.h"
+
+/**
+ * USFNetDormancySubsystem
+ * 상태가 스테이지당 몇 번만 바뀌는 월드 액터(포탈, 상자, 월드 픽업 등)의 Net Dormancy 관리 (서버 전용)
+ * - 등록 시 배치 액터는 DORM_Initial, 스폰 액터는 DORM_DormantAll로 시작 → NetDriver가 매 틱 복제 대상으로 고려하지 않음
+ * - 복제 프로퍼티 변경/RPC 직전에 WakeActor로 잠깐 깨우고, AwakeDuration 뒤 다시 Dormant
+ * - 상호작용 홀드 중이거나 낙하 중인 액터는 SetActorPinnedAwake로 깨어 있는 상태 유지
+ * - 액터 클래스 기본값에서 NetDormancy를 Awake로 바꾸면 관리하지 않음
+ * - 설정은 USFNetDormancySettings. SF.NetDormancy.Profile 로 Dormancy 전/후 NetDriver 고려 액터 수 비교
+ */
+UCLASS()
+class SF_API USFNetDormancySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFNetDormancySubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//~UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of UTickableWorldSubsystem interface
+
+	// BeginPlay에서 호출 (클라이언트/스탠드얼론에서는 무시)
+	void RegisterActor(AActor* Actor);
+	void UnregisterActor(AActor* Actor);
+
+	// 복제 프로퍼티 변경/RPC 전에 호출. AwakeDuration(0 이하면 설정값) 뒤 다시 Dormant
+	void WakeActor(AActor* Actor, float AwakeDuration = 0.f);
+
+	// 고정 해제 전까지 깨어 있음. 해제 시 마지막 상태 전송을 위해 AwakeDuration만큼 더 유지
+	void SetActorPinnedAwake(AActor* Actor, bool bPinned);
+
+	int32 GetNumManagedActors() const { return ManagedActors.Num(); }
+	int32 GetNumAwakeActors() const { return NumAwakeActors; }
+
+	// Dormancy 끔/켬 상태에서 NetDriver가 고려하는 액터 수 비교 (SF.NetDormancy.Profile)
+	void StartProfile(int32 SampleFrames);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FManagedActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		double AwakeUntil = 0.0;
+		bool bPinned = false;
+		bool bAwake = false;
+	};
+
+	enum class EProfilePhase : uint8
+	{
+		None,
+		SettleAwake,
+		SampleAwake,
+		SettleDormant,
+		SampleDormant
+	};
+
+	bool IsServerWorld() const;
+	void SetAwake(FManagedActor& Entry, bool bAwake);
+	void SetDormancyEnabled(bool bEnabled);
+
+	// NetDriver가 이번 틱에 복제 대상으로 고려하는 액터 수 (Dormant 액터는 ActiveObjects에서 빠짐)
+	int32 GetNumActiveNetworkObjects() const;
+	int32 GetNumClientConnections() const;
+
+	void TickProfile();
+
+private:
+	TMap<FObjectKey, FManagedActor> ManagedActors;
+	int32 NumAwakeActors = 0;
+
+	bool bDormancyEnabled = true;
+	float DefaultAwakeDuration = 1.f;
+
+	EProfilePhase ProfilePhase = EProfilePhase::None;
+	int32 ProfileSampleFrames = 0;
+	int32 ProfileFramesRemaining = 0;
+	int64 ProfileActiveObjectSum = 0;
+	double ProfileAwakeAverage = 0.0;
+};
@@ -2,7 +2,9 @@
 
 #include "Interfaces/OnlineIdentityInterface.h"
 #include "OnlineSubsystem.h"
+#include "OnlineSubsystemNames.h"
 #include "SFPlayFabSubsystem.h"
+#include "SFStageSubsystem.h"
 #include "Online/OnlineSessionNames.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
@@ -28,6 +30,7 @@ void USFOSSGameInstance::Init()
 
 	//현재 OS의 인터페이스를 가져옴
 	SessionInterface = OnlineSubsystem->GetSessionInterface();
+	SessionBrowser.SetMaxMissedSearches(SessionCacheMissedSearches);
 	
 	//Steam 로그인 상태 확인
 	if (IOnlineIdentityPtr Identity = OnlineSubsystem->GetIdentityInterface())
@@ -64,13 +67,17 @@ void USFOSSGameInstance::CreateGameSession(const FString& RoomName, bool bProtec
 		return;
 	}
 
+	//검색 필터용 진행 스테이지 (이후 변경은 UpdateAdvertisedStage)
+	const USFStageSubsystem* StageSubsystem = GetSubsystem<USFStageSubsystem>();
+	const int32 AdvertisedStageIndex = StageSubsystem ? StageSubsystem->GetCurrentStageIndex() : INDEX_NONE;
+
 	//기존 세션이 존재하면 삭제 후 생성
 	if (SessionInterface->GetNamedSession(GAME_SESSION_NAME))
 	{
 		bWantsCreateAfterDestroy = true;
 
 		PendingCreateSettings = MakeShared<FOnlineSessionSettings>();
-		PendingCreateSettings->bIsLANMatch = false;
+		PendingCreateSettings->bIsLANMatch = IsUsingNullSubsystem();
 		PendingCreateSettings->bIsDedicated = false;
 		PendingCreateSettings->NumPublicConnections = MaxPlayers;
 		PendingCreateSettings->bShouldAdvertise = true;
@@ -80,9 +87,10 @@ void USFOSSGameInstance::CreateGameSession(const FString& RoomName, bool bProtec
 		PendingCreateSettings->bUseLobbiesIfAvailable = true;
 		PendingCreateSettings->BuildUniqueId = 1;
 
-		PendingCreateSettings->Set(TEXT("PASSWORD"), SessionPassword, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
-		PendingCreateSettings->Set(TEXT("ROOM_NAME"), RoomName, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
-		PendingCreateSettings->Set(TEXT("PROTECTED"), bProtected, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		PendingCreateSettings->Set(SFSessionKeys::Password, SessionPassword, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		PendingCreateSettings->Set(SFSessionKeys::RoomName, RoomName, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		PendingCreateSettings->Set(SFSessionKeys::Protected, bProtected, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		PendingCreateSettings->Set(SFSessionKeys::Stage, AdvertisedStageIndex, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
 
 		SessionInterface->AddOnDestroySessionCompleteDelegate_Handle(
 			FOnDestroySessionCompleteDelegate::CreateUObject(this, &USFOSSGameInstance::OnDestroySessionComplete));
@@ -92,7 +100,7 @@ void USFOSSGameInstance::CreateGameSession(const FString& RoomName, bool bProtec
 
 	//없을 경우 바로 생성
 	PendingCreateSettings = MakeShared<FOnlineSessionSettings>();
-	PendingCreateSettings->bIsLANMatch = false;
+	PendingCreateSettings->bIsLANMatch = IsUsingNullSubsystem();
 	PendingCreateSettings->bIsDedicated = false;
 	PendingCreateSettings->NumPublicConnections = MaxPlayers;
 	PendingCreateSettings->bShouldAdvertise = true;
@@ -102,9 +110,10 @@ void USFOSSGameInstance::CreateGameSession(const FString& RoomName, bool bProtec
 	PendingCreateSettings->bUseLobbiesIfAvailable = true;
 	PendingCreateSettings->BuildUniqueId = 1;
 
-	PendingCreateSettings->Set(TEXT("PASSWORD"), SessionPassword, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
-	PendingCreateSettings->Set(TEXT("ROOM_NAME"), RoomName, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
-	PendingCreateSettings->Set(TEXT("PROTECTED"), bProtected, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	PendingCreateSettings->Set(SFSessionKeys::Password, SessionPassword, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	PendingCreateSettings->Set(SFSessionKeys::RoomName, RoomName, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	PendingCreateSettings->Set(SFSessionKeys::Protected, bProtected, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	PendingCreateSettings->Set(SFSessionKeys::Stage, AdvertisedStageIndex, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
 
 	//실제 생성 호출
 	InternalCreateSession();
@@ -210,13 +219,51 @@ void USFOSSGameInstance::OnDestroySessionComplete(FName SessionName, bool bWasSu
 }
 //================================================================================
 
+//===============================세션 정보 갱신=====================================
+void USFOSSGameInstance::UpdateAdvertisedStage(int32 StageIndex)
+{
+	if (!SessionInterface.IsValid())
+	{
+		return;
+	}
+
+	//호스트만 세션 설정 변경 가능
+	FNamedOnlineSession* Session = SessionInterface->GetNamedSession(GAME_SESSION_NAME);
+	if (!Session || !Session->bHosting)
+	{
+		return;
+	}
+
+	int32 CurrentStageIndex = INDEX_NONE;
+	if (Session->SessionSettings.Get(SFSessionKeys::Stage, CurrentStageIndex) && CurrentStageIndex == StageIndex)
+	{
+		return;
+	}
+
+	FOnlineSessionSettings UpdatedSettings = Session->SessionSettings;
+	UpdatedSettings.Set(SFSessionKeys::Stage, StageIndex, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	SessionInterface->UpdateSession(GAME_SESSION_NAME, UpdatedSettings, true);
+}
+//================================================================================
+
 //===================================세션 찾기======================================
 void USFOSSGameInstance::FindSessions(bool bIncludePasswordProtected)
 {
+	//비밀 방 표시 여부 (캐시에서 바로 다시 거름)
+	FSFSessionFilter Filter = SessionBrowser.GetFilter();
+	Filter.bIncludePasswordProtected = bIncludePasswordProtected;
+	SetSessionFilter(Filter);
+
 	//유효성 검사
 	if (!bIsLoggedIn || !SessionInterface.IsValid())
 	{
-		OnSessionsUpdated.Broadcast(AvailableSessions);
+		OnSessionsUpdated.Broadcast();
+		return;
+	}
+
+	//이전 검색이 아직 진행 중이면 결과를 기다림 (새로고침 연타 방지)
+	if (IsSearchingSessions())
+	{
 		return;
 	}
 
@@ -227,12 +274,9 @@ void USFOSSGameInstance::FindSessions(bool bIncludePasswordProtected)
 		SessionInterface->DestroySession(GAME_SESSION_NAME);
 	}
 
-	//비밀 방 표시 여부
-	bShowPasswordProtected = bIncludePasswordProtected;
-	
 	SessionSearch = MakeShareable(new FOnlineSessionSearch());
-	SessionSearch->bIsLanQuery = false;
-	SessionSearch->MaxSearchResults = 999999;
+	SessionSearch->bIsLanQuery = IsUsingNullSubsystem();
+	SessionSearch->MaxSearchResults = FMath::Max(1, MaxSearchResults);
 	SessionSearch->QuerySettings.Set(SEARCH_PRESENCE, true, EOnlineComparisonOp::Equals);
 	
 	SessionInterface->AddOnFindSessionsCompleteDelegate_Handle(
@@ -245,60 +289,99 @@ void USFOSSGameInstance::FindSessions(bool bIncludePasswordProtected)
 //세션 찾기 완료 시 호출
 void USFOSSGameInstance::OnFindSessionsComplete(bool bWasSuccessful)
 {
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->ClearOnFindSessionsCompleteDelegates(this);
+	}
+
 	//유효성 검사
 	if (!SessionSearch.IsValid())
 	{
 		UE_LOG(LogTemp, Error, TEXT("[FindSessionsComplete] SessionSearch invalid"));
-		OnSessionsUpdated.Broadcast(AvailableSessions);
+		OnSessionsUpdated.Broadcast();
 		return;
 	}
 
-	//기존 방 리스트 초기화
-	AvailableSessions.Empty();
-
-	//검색 결과 반복 처리
-	for (const auto& SearchResult : SessionSearch->SearchResults)
+	//실패 시 캐시는 그대로 유지
+	if (!bWasSuccessful)
 	{
-		FSessionInfo Info;
-		Info.HostName = SearchResult.Session.OwningUserName;
-		Info.MaxPlayers = SearchResult.Session.SessionSettings.NumPublicConnections;
-		Info.CurrentPlayers = Info.MaxPlayers - SearchResult.Session.NumOpenPublicConnections;
+		UE_LOG(LogTemp, Warning, TEXT("[FindSessionsComplete] Search failed, keeping %d cached sessions"), SessionBrowser.GetNumCached());
+		OnSessionsUpdated.Broadcast();
+		return;
+	}
 
-		SearchResult.Session.SessionSettings.Get(TEXT("ROOM_NAME"), Info.RoomName);
+	ApplySearchResults(SessionSearch->SearchResults);
+}
 
-		bool bProtected = false;
-		SearchResult.Session.SessionSettings.Get(TEXT("PROTECTED"), bProtected);
-		Info.bIsPasswordProtected = bProtected;
+void USFOSSGameInstance::ApplySearchResults(const TArray<FOnlineSessionSearchResult>& Results)
+{
+	//기존 캐시에 병합 (같은 세션은 갱신, 안 보이는 세션은 일정 횟수 후 제거)
+	const FSFSessionBrowser::FMergeStats Stats = SessionBrowser.Merge(Results);
 
-		if (Info.bIsPasswordProtected && !bShowPasswordProtected)
-		{
-			continue;
-		}
+	UE_LOG(LogTemp, Log, TEXT("[FindSessionsComplete] %d results: %d added, %d updated, %d removed (%d cached, %d shown)"),
+		Results.Num(), Stats.Added, Stats.Updated, Stats.Removed, SessionBrowser.GetNumCached(), SessionBrowser.GetNumFiltered());
+
+	//UI는 필요한 페이지만 캐시에서 가져감
+	OnSessionsUpdated.Broadcast();
+}
 
-		Info.SearchResult = SearchResult;
-		AvailableSessions.Add(MoveTemp(Info));
+void USFOSSGameInstance::SetSessionFilter(const FSFSessionFilter& InFilter)
+{
+	if (SessionBrowser.GetFilter() == InFilter)
+	{
+		return;
 	}
 
-	//Info 사용해서 UI 업데이트
-	OnSessionsUpdated.Broadcast(AvailableSessions);
+	SessionBrowser.SetFilter(InFilter);
+	OnSessionsUpdated.Broadcast();
+}
 
-	if (SessionInterface.IsValid())
+void USFOSSGameInstance::GetSessionPage(int32 PageIndex, TArray<FSessionInfo>& OutSessions) const
+{
+	TArray<const FSessionInfo*> Page;
+	SessionBrowser.GetPage(PageIndex, GetSessionPageSize(), Page);
+
+	OutSessions.Reset(Page.Num());
+	for (const FSessionInfo* Info : Page)
 	{
-		SessionInterface->ClearOnFindSessionsCompleteDelegates(this);
+		OutSessions.Add(*Info);
 	}
 }
+
+bool USFOSSGameInstance::FindSessionInfo(const FString& SessionId, FSessionInfo& OutInfo) const
+{
+	if (const FSessionInfo* Info = SessionBrowser.Find(SessionId))
+	{
+		OutInfo = *Info;
+		return true;
+	}
+	return false;
+}
 //=================================================================================
 
 //===================================세션 입장=======================================
 void USFOSSGameInstance::JoinGameSession(int32 SessionIndex, const FString& InputPasswordOptional)
 {
-	//유효성 검사
-	if (!bIsLoggedIn || !SessionInterface.IsValid() || SessionIndex < 0 || SessionIndex >= AvailableSessions.Num())
+	const FString* SessionId = SessionBrowser.GetFilteredSessionId(SessionIndex);
+	if (!SessionId)
 	{
 		OnJoinSessionComplete_Sig.Broadcast(false, TEXT("Invalid session index or not logged in"));
 		return;
 	}
 
+	JoinGameSessionById(*SessionId, InputPasswordOptional);
+}
+
+void USFOSSGameInstance::JoinGameSessionById(const FString& SessionId, const FString& InputPasswordOptional)
+{
+	//유효성 검사 (목록에서 사라졌거나 테스트용 가짜 세션이면 입장 불가)
+	const FSessionInfo* Info = SessionBrowser.Find(SessionId);
+	if (!bIsLoggedIn || !SessionInterface.IsValid() || !Info || !Info->SearchResult.IsValid())
+	{
+		OnJoinSessionComplete_Sig.Broadcast(false, TEXT("Invalid session or not logged in"));
+		return;
+	}
+
 	//UI에서 입력된 비밀번호 저장
 	LastInputPassword = InputPasswordOptional;
 
@@ -306,7 +389,7 @@ void USFOSSGameInstance::JoinGameSession(int32 SessionIndex, const FString& Inpu
 		FOnJoinSessionCompleteDelegate::CreateUObject(this, &USFOSSGameInstance::OnJoinSessionComplete));
 
 	//실제 Join 호출
-	if (!SessionInterface->JoinSession(0, GAME_SESSION_NAME, AvailableSessions[SessionIndex].SearchResult))
+	if (!SessionInterface->JoinSession(0, GAME_SESSION_NAME, Info->SearchResult))
 	{
 		OnJoinSessionComplete_Sig.Broadcast(false, TEXT("JoinSession call failed"));
 	}
@@ -397,10 +480,16 @@ void USFOSSGameInstance::LoadWaitingLevel_AsHost()
 	}
 }
 
-//검색 결과 초기화(사용 안하는 중)
+//검색 결과 초기화
 void USFOSSGameInstance::ClearSessionSearch()
 {
-	AvailableSessions.Empty();
+	SessionBrowser.Reset();
 	SessionSearch.Reset();
+	OnSessionsUpdated.Broadcast();
+}
+
+bool USFOSSGameInstance::IsUsingNullSubsystem() const
+{
+	return OnlineSubsystem && OnlineSubsystem->GetSubsystemName() == NULL_SUBSYSTEM;
 }
 //=================================================================================
\ No newline at end of file
@@ -4,36 +4,11 @@
 #include "Engine/GameInstance.h"
 #include "Interfaces/OnlineSessionInterface.h"
 #include "OnlineSessionSettings.h"
+#include "System/SFSessionBrowser.h"
 #include "SFOSSGameInstance.generated.h"
 
-USTRUCT(BlueprintType)
-
-//======================================세션 정보==========================================
-struct FSessionInfo
-{
-	GENERATED_BODY()
-
-	UPROPERTY(BlueprintReadOnly)
-	FString RoomName; //방 제목
-
-	UPROPERTY(BlueprintReadOnly)
-	FString HostName; //호스트 이름
-
-	UPROPERTY(BlueprintReadOnly)
-	int32 CurrentPlayers = 0; //현재 플레이어
-
-	UPROPERTY(BlueprintReadOnly)
-	int32 MaxPlayers = 0; //최대 플레이어
-
-	UPROPERTY(BlueprintReadOnly)
-	bool bIsPasswordProtected = false; // UI 표시용
-
-	FOnlineSessionSearchResult SearchResult; //Join에 사용
-};
-//========================================================================================
-
 //===================================델리게이트 선언========================================
-DECLARE_MULTICAST_DELEGATE_OneParam(FOnSessionsUpdated, const TArray<FSessionInfo>&);
+DECLARE_MULTICAST_DELEGATE(FOnSessionsUpdated);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnCreateSessionComplete_Sig, bool, const FString&);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnJoinSessionComplete_Sig, bool, const FString&);
 //========================================================================================
@@ -61,11 +36,38 @@ public:
 	void FindSessions(bool bIncludePasswordProtected = true);
 
 	void OnFindSessionsComplete(bool bWasSuccessful);
+
+	//검색 결과를 캐시에 병합 후 UI 갱신 (OSS 검색 완료 / 테스트용 가짜 결과 공용)
+	void ApplySearchResults(const TArray<FOnlineSessionSearchResult>& Results);
+
+	//필터 변경 (재검색 없이 캐시에서 다시 거름)
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	void SetSessionFilter(const FSFSessionFilter& InFilter);
+
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	const FSFSessionFilter& GetSessionFilter() const { return SessionBrowser.GetFilter(); }
+
+	//필터 적용된 목록의 한 페이지 (SessionPageSize 단위)
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	void GetSessionPage(int32 PageIndex, TArray<FSessionInfo>& OutSessions) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	int32 GetNumFilteredSessions() const { return SessionBrowser.GetNumFiltered(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	bool FindSessionInfo(const FString& SessionId, FSessionInfo& OutInfo) const;
+
+	//검색 결과 초기화
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	void ClearSessionSearch();
 	//========================================================================================
 	
 	//======================================세션 입장===========================================
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	void JoinGameSession(int32 SessionIndex, const FString& InputPasswordOptional = TEXT(""));
+	void JoinGameSession(int32 SessionIndex, const FString& InputPasswordOptional = TEXT("")); //필터 적용된 목록 기준 인덱스
+
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	void JoinGameSessionById(const FString& SessionId, const FString& InputPasswordOptional = TEXT(""));
 
 	void OnJoinSessionComplete(FName SessionName, EOnJoinSessionCompleteResult::Type Result);
 	//========================================================================================
@@ -76,6 +78,11 @@ public:
 
 	void OnDestroySessionComplete(FName SessionName, bool bWasSuccessful);
 	//========================================================================================
+
+	//=====================================세션 정보 갱신========================================
+	//호스트 중인 세션의 광고 스테이지 갱신 (검색 필터용)
+	void UpdateAdvertisedStage(int32 StageIndex);
+	//========================================================================================
 	
 	//=======================================레벨 로드==========================================
 	UFUNCTION(BlueprintCallable, Category = "Level")
@@ -95,8 +102,13 @@ public:
 	//========================================================================================
 	
 	//=========================================Get()==========================================
+	const FSFSessionBrowser& GetSessionBrowser() const { return SessionBrowser; }
+
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	const TArray<FSessionInfo>& GetAvailableSessions() const { return AvailableSessions; }
+	int32 GetSessionPageSize() const { return FMath::Max(1, SessionPageSize); }
+
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	bool IsSearchingSessions() const { return SessionSearch.IsValid() && SessionSearch->SearchState == EOnlineAsyncTaskState::InProgress; }
 
 	UFUNCTION(BlueprintCallable, Category = "Session")
 	bool IsLoggedIn() const { return bIsLoggedIn; }
@@ -123,14 +135,27 @@ protected:
 	FString PlayerName;
 	FString CurrentSessionName;
 
-	TArray<FSessionInfo> AvailableSessions;
-	bool bShowPasswordProtected = true;
+	FSFSessionBrowser SessionBrowser;
+
+	//한 번의 검색에서 받을 최대 결과 수 (나머지는 재검색 때 캐시에 병합)
+	UPROPERTY(EditDefaultsOnly, Category = "Session", meta = (ClampMin = "1"))
+	int32 MaxSearchResults = 100;
+
+	//검색 목록 한 페이지 크기 (스크롤이 끝에 가까워질 때마다 한 페이지씩 추가)
+	UPROPERTY(EditDefaultsOnly, Category = "Session", meta = (ClampMin = "1"))
+	int32 SessionPageSize = 20;
+
+	//검색 결과에서 연속으로 빠져도 목록에 남겨둘 횟수
+	UPROPERTY(EditDefaultsOnly, Category = "Session", meta = (ClampMin = "0"))
+	int32 SessionCacheMissedSearches = 1;
 	
 	bool bWantsCreateAfterDestroy = false;
 	TSharedPtr<FOnlineSessionSettings> PendingCreateSettings;
 	
 	void InternalCreateSession();
-	void ClearSessionSearch();
+
+	//NULL OSS는 LAN 검색만 지원 (Steam 없이 로컬 테스트)
+	bool IsUsingNullSubsystem() const;
 
 private:
 	FString SessionPassword;
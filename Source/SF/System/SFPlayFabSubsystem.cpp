@@ -2,13 +2,25 @@
 
 #include "JsonObjectConverter.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/Paths.h"
 #include "OnlineSubsystem.h"
 #include "Interfaces/OnlineIdentityInterface.h"
 #include "PlayFabRuntimeSettings.h"
 
 #include "Player/SFPlayerState.h"
+#include "System/SFPlayerDataSettings.h"
+#include "System/SFPlayerDataWriteQueue.h"
 #include "System/Data/SFPermanentUpgradeTypes.h"
 
+namespace SFPlayFab
+{
+	// 키 단위 저장 이전에 문서 전체를 담던 키 (로드 시 한 번 변환)
+	static const TCHAR* LegacySaveJsonKey = TEXT("SaveJson");
+
+	// 쓰기 큐 갱신 주기(초). 월드 타이머가 아닌 코어 티커라 레벨 이동 중에도 계속 돌아감
+	static constexpr float WriteQueueTickInterval = 0.1f;
+}
+
 //===================초기화 및 PlayFab 로그인 실행=======================
 void USFPlayFabSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -17,8 +29,38 @@ void USFPlayFabSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	// Title ID 설정
 	GetMutableDefault<UPlayFabRuntimeSettings>()->TitleId = TEXT("1508CD");
 
-	UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] Initialized"));
-	LoginToPlayFab();
+	const USFPlayerDataSettings* Settings = GetDefault<USFPlayerDataSettings>();
+	if (Settings->bUseFileBackend)
+	{
+		const FString FilePath = FPaths::ProjectSavedDir() / TEXT("PlayerData") / (Settings->FileBackendSlotName + TEXT(".json"));
+		PlayerDataBackend = MakeShared<FSFFilePlayerDataBackend>(FilePath);
+	}
+	else
+	{
+		PlayerDataBackend = MakeShared<FSFPlayFabPlayerDataBackend>();
+	}
+
+	FSFPlayerDataWriteQueue::FConfig QueueConfig;
+	QueueConfig.FlushInterval = Settings->FlushInterval;
+	QueueConfig.RetryBaseDelay = Settings->RetryBaseDelay;
+	QueueConfig.RetryMaxDelay = Settings->RetryMaxDelay;
+	QueueConfig.MaxKeysPerWrite = Settings->MaxKeysPerWrite;
+	PlayerDataWriteQueue = MakeShared<FSFPlayerDataWriteQueue>(PlayerDataBackend.ToSharedRef(), QueueConfig);
+
+	PlayerDataTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &ThisClass::TickPlayerDataWriteQueue), SFPlayFab::WriteQueueTickInterval);
+
+	UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] Initialized (%s backend)"), *PlayerDataBackend->GetBackendName());
+
+	// 파일 저장소는 로그인 없이 바로 로드
+	if (Settings->bUseFileBackend)
+	{
+		LoadPlayerData();
+	}
+	else
+	{
+		LoginToPlayFab();
+	}
 }
 //====================================================================
 
@@ -30,6 +72,27 @@ void USFPlayFabSubsystem::Deinitialize()
 		World->GetTimerManager().ClearTimer(RetrySendUpgradeTimerHandle);
 	}
 
+	FTSTicker::GetCoreTicker().RemoveTicker(PlayerDataTickerHandle);
+
+	// 종료 직전 남은 변경은 재시도 대기와 관계없이 한 번 더 전송 시도
+	if (PlayerDataWriteQueue.IsValid())
+	{
+		if (bHasLoadedPlayerData)
+		{
+			// 파일 저장소는 Tick에서 쓰기가 완료되므로 한 번 더 갱신
+			const double Now = FPlatformTime::Seconds();
+			PlayerDataWriteQueue->Flush(Now, true);
+			PlayerDataWriteQueue->Tick(Now);
+		}
+
+		const FSFPlayerDataWriteQueue::FStats& Stats = PlayerDataWriteQueue->GetStats();
+		UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] Write queue | Saves=%d Writes=%d (Failed=%d) Keys=%d Coalescing=%.1f PendingKeys=%d"),
+			Stats.SaveRequests, Stats.WritesSent, Stats.WritesFailed, Stats.KeysSent, PlayerDataWriteQueue->GetCoalescingRatio(), PlayerDataWriteQueue->GetNumPendingKeys());
+	}
+
+	PlayerDataWriteQueue.Reset();
+	PlayerDataBackend.Reset();
+
 	Super::Deinitialize();
 }
 //====================================================================
@@ -91,58 +154,115 @@ void USFPlayFabSubsystem::AddGold(int32 Amount)
 //===========================데이터 저장================================
 void USFPlayFabSubsystem::SavePlayerData()
 {
-	FString JsonString;
-	FJsonObjectConverter::UStructToJsonObjectString(PlayerStats, JsonString);
+	FSFPlayerDataValues Values;
+	ExportPlayerStatsValues(Values);
 
-	PlayFab::ClientModels::FUpdateUserDataRequest Request;
-	Request.Data.Add(TEXT("SaveJson"), JsonString);
+	// 바뀐 키만 큐에 올라가고, 연속 호출은 FlushInterval 안에서 한 번의 쓰기로 합쳐짐
+	PlayerDataWriteQueue->Stage(Values, FPlatformTime::Seconds());
+}
 
-	PlayFab::UPlayFabClientAPI::FUpdateUserDataDelegate Success;
-	PlayFab::FPlayFabErrorDelegate Error;
+void USFPlayFabSubsystem::FlushPlayerData()
+{
+	if (!bHasLoadedPlayerData)
+	{
+		return;
+	}
 
-	Success.BindUObject(this, &USFPlayFabSubsystem::OnDataSaved);
-	Error.BindUObject(this, &USFPlayFabSubsystem::OnSaveError);
+	PlayerDataWriteQueue->Flush(FPlatformTime::Seconds());
+}
 
-	PlayFab::UPlayFabClientAPI().UpdateUserData(Request, Success, Error);
+bool USFPlayFabSubsystem::TickPlayerDataWriteQueue(float DeltaTime)
+{
+	// 로드 전에는 전송하지 않음 (기본값이 저장된 데이터를 덮어쓰지 않도록)
+	if (bHasLoadedPlayerData)
+	{
+		PlayerDataWriteQueue->Tick(FPlatformTime::Seconds());
+	}
+	else if (NextLoadRetryTime > 0.0 && FPlatformTime::Seconds() >= NextLoadRetryTime)
+	{
+		LoadPlayerData();
+	}
+	return true;
 }
 
-void USFPlayFabSubsystem::OnDataSaved(const PlayFab::ClientModels::FUpdateUserDataResult& Result)
+void USFPlayFabSubsystem::ExportPlayerStatsValues(FSFPlayerDataValues& OutValues) const
 {
-	UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] Save Success"));
+	for (TFieldIterator<FProperty> It(FPlayerStats::StaticStruct()); It; ++It)
+	{
+		FString Value;
+		It->ExportTextItem_InContainer(Value, &PlayerStats, nullptr, nullptr, PPF_None);
+		OutValues.Add(It->GetName(), MoveTemp(Value));
+	}
 }
 
-void USFPlayFabSubsystem::OnSaveError(const PlayFab::FPlayFabCppError& Error)
+bool USFPlayFabSubsystem::ImportPlayerStatsValues(const FSFPlayerDataValues& Values)
 {
-	UE_LOG(LogTemp, Error, TEXT("[PlayFabSubsystem] Save Failed: %s"), *Error.GenerateErrorReport());
+	bool bImportedAny = false;
+	for (TFieldIterator<FProperty> It(FPlayerStats::StaticStruct()); It; ++It)
+	{
+		if (const FString* Value = Values.Find(It->GetName()))
+		{
+			bImportedAny |= It->ImportText_InContainer(**Value, &PlayerStats, nullptr, PPF_None) != nullptr;
+		}
+	}
+	return bImportedAny;
 }
 //====================================================================
 
 //============================데이터 로드===============================
 void USFPlayFabSubsystem::LoadPlayerData()
 {
-	PlayFab::ClientModels::FGetUserDataRequest Request;
-
-	PlayFab::UPlayFabClientAPI::FGetUserDataDelegate Success;
-	PlayFab::FPlayFabErrorDelegate Error;
-
-	Success.BindUObject(this, &USFPlayFabSubsystem::OnDataLoaded);
-	Error.BindUObject(this, &USFPlayFabSubsystem::OnSaveError);
+	// 재시도를 모두 실패한 뒤 다시 호출하면 처음부터 재시도
+	if (bPlayerDataLoadFailed)
+	{
+		bPlayerDataLoadFailed = false;
+		LoadAttempts = 0;
+	}
 
-	PlayFab::UPlayFabClientAPI().GetUserData(Request, Success, Error);
+	NextLoadRetryTime = 0.0;
+	++LoadAttempts;
+	PlayerDataBackend->ReadAll(FSFPlayerDataReadComplete::CreateUObject(this, &ThisClass::OnPlayerDataRead));
 }
 
-void USFPlayFabSubsystem::OnDataLoaded(const PlayFab::ClientModels::FGetUserDataResult& Result)
+void USFPlayFabSubsystem::OnPlayerDataRead(bool bSuccess, const FSFPlayerDataValues& Values)
 {
+	if (!bSuccess)
+	{
+		// 로드 전에는 쓰기가 전부 보류되므로 포기하지 않고 쓰기 큐와 같은 지수 백오프로 재시도
+		const USFPlayerDataSettings* Settings = GetDefault<USFPlayerDataSettings>();
+		if (LoadAttempts >= Settings->MaxLoadAttempts)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[PlayFabSubsystem] Load Failed after %d attempts - saves are on hold until LoadPlayerData succeeds"), LoadAttempts);
+			bPlayerDataLoadFailed = true;
+			OnPlayerDataLoadFailed.Broadcast();
+			return;
+		}
+
+		const double Backoff = FMath::Min(Settings->RetryBaseDelay * FMath::Pow(2.0, LoadAttempts - 1), static_cast<double>(Settings->RetryMaxDelay));
+		NextLoadRetryTime = FPlatformTime::Seconds() + Backoff * FMath::FRandRange(0.8, 1.2);
+		UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] Load Failed (attempt %d/%d), retry in %.1fs"), LoadAttempts, Settings->MaxLoadAttempts, NextLoadRetryTime - FPlatformTime::Seconds());
+		return;
+	}
+
 	bHasLoadedPlayerData = true;
+	LoadAttempts = 0;
 
-	const PlayFab::ClientModels::FUserDataRecord* Record = Result.Data.Find(TEXT("SaveJson"));
-	if (Record && !Record->Value.IsEmpty())
+	bool bNeedsMigration = false;
+	if (ImportPlayerStatsValues(Values))
 	{
-		const FString JsonString = Record->Value;
-
-		UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] Raw SaveJson: %s"), *JsonString);
+		UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] Loaded | Gold=%d Wrath=%d Pride=%d Lust=%d Sloth=%d Greed=%d"),
+			PlayerStats.Gold, PlayerStats.Wrath, PlayerStats.Pride, PlayerStats.Lust, PlayerStats.Sloth, PlayerStats.Greed);
+	}
+	else if (const FString* JsonString = Values.Find(SFPlayFab::LegacySaveJsonKey); JsonString && !JsonString->IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] Raw SaveJson: %s"), **JsonString);
 
-		if (!FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &PlayerStats, 0, 0))
+		if (FJsonObjectConverter::JsonObjectStringToUStruct(*JsonString, &PlayerStats, 0, 0))
+		{
+			// 키 단위로 다시 저장
+			bNeedsMigration = true;
+		}
+		else
 		{
 			UE_LOG(LogTemp, Error, TEXT("[PlayFabSubsystem] JSON Parse Failed"));
 		}
@@ -152,6 +272,13 @@ void USFPlayFabSubsystem::OnDataLoaded(const PlayFab::ClientModels::FGetUserData
 		UE_LOG(LogTemp, Warning, TEXT("[PlayFabSubsystem] No Save Data (use defaults)"));
 	}
 
+	// 저장소에 있는 값이 기준. 로드 전에 쌓인 변경은 버림
+	PlayerDataWriteQueue->SetPersistedValues(Values);
+	if (bNeedsMigration)
+	{
+		SavePlayerData();
+	}
+
 	// 여기서 "한 번" 보내는 것만으로 충분한 경우도 있지만,
 	// 멀티/SeamlessTravel/재진입에서 클라이언트가 안 보내는 케이스가 생기므로
 	// 실제 트리거는 SFHero(로컬)에서 한 번 더 보장해주는 게 안전함.
@@ -4,9 +4,15 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Core/PlayFabClientAPI.h"
 #include "Core/PlayFabClientDataModels.h"
+#include "Containers/Ticker.h"
+#include "System/SFPlayerDataBackend.h"
 #include "TimerManager.h"
 #include "SFPlayFabSubsystem.generated.h"
 
+class FSFPlayerDataWriteQueue;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPlayerDataLoadFailed);
+
 //=========================세이브 데이터(임시)===========================
 USTRUCT(BlueprintType)
 struct FPlayerStats
@@ -50,9 +56,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category="SF|PlayFab")
 	int32 GetGold() const { return PlayerStats.Gold; }
 
+	// 변경된 키만 쓰기 큐에 올림. 실제 전송은 FlushInterval 뒤 합쳐서 (USFPlayerDataSettings)
 	UFUNCTION(BlueprintCallable, Category="SF|PlayFab")
 	void SavePlayerData();
 
+	// 모으는 시간 없이 대기 중인 변경을 바로 전송 (게임 종료 직전 등)
+	UFUNCTION(BlueprintCallable, Category="SF|PlayFab")
+	void FlushPlayerData();
+
 	UFUNCTION(BlueprintCallable, Category="SF|PlayFab")
 	void LoadPlayerData();
 
@@ -86,6 +97,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category="SF|PlayFab")
 	bool HasLoadedPlayerData() const { return bHasLoadedPlayerData; }
 
+	// 로드 재시도를 모두 실패함 (LoadPlayerData를 다시 호출하기 전까지 저장 보류)
+	UFUNCTION(BlueprintCallable, Category="SF|PlayFab")
+	bool HasPlayerDataLoadFailed() const { return bPlayerDataLoadFailed; }
+
+	// 로드 재시도를 모두 실패하면 한 번 브로드캐스트 (UI 안내용)
+	UPROPERTY(BlueprintAssignable, Category="SF|PlayFab")
+	FOnPlayerDataLoadFailed OnPlayerDataLoadFailed;
+
+	const FSFPlayerDataWriteQueue* GetPlayerDataWriteQueue() const { return PlayerDataWriteQueue.Get(); }
+
 	void TryStartPermanentUpgradeForThisGame();
 	void ResetPermanentUpgradeForNewGameSession();
 	//====================================================================
@@ -103,10 +124,22 @@ private:
 	void OnLoginError(const PlayFab::FPlayFabCppError& Error);
 	//====================================================================
 
-	//========================저장 & 로드 콜백 함수==========================
-	void OnDataSaved(const PlayFab::ClientModels::FUpdateUserDataResult& Result);
-	void OnSaveError(const PlayFab::FPlayFabCppError& Error);
-	void OnDataLoaded(const PlayFab::ClientModels::FGetUserDataResult& Result);
+	//========================저장 & 로드 (쓰기 큐)==========================
+	void OnPlayerDataRead(bool bSuccess, const FSFPlayerDataValues& Values);
+	bool TickPlayerDataWriteQueue(float DeltaTime);
+
+	// FPlayerStats 프로퍼티 하나 = User Data 키 하나
+	void ExportPlayerStatsValues(FSFPlayerDataValues& OutValues) const;
+	bool ImportPlayerStatsValues(const FSFPlayerDataValues& Values);
+
+	TSharedPtr<ISFPlayerDataBackend> PlayerDataBackend;
+	TSharedPtr<FSFPlayerDataWriteQueue> PlayerDataWriteQueue;
+	FTSTicker::FDelegateHandle PlayerDataTickerHandle;
+
+	// 로드 실패 시 쓰기 큐와 같은 백오프로 재시도 (0이면 대기 중인 재시도 없음)
+	int32 LoadAttempts = 0;
+	double NextLoadRetryTime = 0.0;
+	bool bPlayerDataLoadFailed = false;
 	//====================================================================
 
 	//========================업그레이드 데이터 서버 전송======================
@@ -0,0 +1,184 @@
+#include "SFPlayerDataBackend.h"
+
+#include "SFLogChannels.h"
+#include "Core/PlayFabClientAPI.h"
+#include "Core/PlayFabClientDataModels.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+//=========================PlayFab 저장소==============================
+void FSFPlayFabPlayerDataBackend::ReadAll(const FSFPlayerDataReadComplete& OnComplete)
+{
+	PlayFab::ClientModels::FGetUserDataRequest Request;
+
+	PlayFab::UPlayFabClientAPI::FGetUserDataDelegate Success = PlayFab::UPlayFabClientAPI::FGetUserDataDelegate::CreateLambda(
+		[OnComplete](const PlayFab::ClientModels::FGetUserDataResult& Result)
+		{
+			FSFPlayerDataValues Values;
+			for (const TPair<FString, PlayFab::ClientModels::FUserDataRecord>& Pair : Result.Data)
+			{
+				Values.Add(Pair.Key, Pair.Value.Value);
+			}
+			OnComplete.ExecuteIfBound(true, Values);
+		});
+
+	PlayFab::FPlayFabErrorDelegate Error = PlayFab::FPlayFabErrorDelegate::CreateLambda(
+		[OnComplete](const PlayFab::FPlayFabCppError& InError)
+		{
+			UE_LOG(LogSF, Error, TEXT("[PlayerData] PlayFab read failed: %s"), *InError.GenerateErrorReport());
+			OnComplete.ExecuteIfBound(false, FSFPlayerDataValues());
+		});
+
+	PlayFab::UPlayFabClientAPI().GetUserData(Request, Success, Error);
+}
+
+void FSFPlayFabPlayerDataBackend::WriteKeys(const FSFPlayerDataValues& Values, const FSFPlayerDataWriteComplete& OnComplete)
+{
+	PlayFab::ClientModels::FUpdateUserDataRequest Request;
+	Request.Data = Values;
+
+	PlayFab::UPlayFabClientAPI::FUpdateUserDataDelegate Success = PlayFab::UPlayFabClientAPI::FUpdateUserDataDelegate::CreateLambda(
+		[OnComplete](const PlayFab::ClientModels::FUpdateUserDataResult& Result)
+		{
+			OnComplete.ExecuteIfBound(true, FString());
+		});
+
+	PlayFab::FPlayFabErrorDelegate Error = PlayFab::FPlayFabErrorDelegate::CreateLambda(
+		[OnComplete](const PlayFab::FPlayFabCppError& InError)
+		{
+			OnComplete.ExecuteIfBound(false, InError.GenerateErrorReport());
+		});
+
+	PlayFab::UPlayFabClientAPI().UpdateUserData(Request, Success, Error);
+}
+//====================================================================
+
+//===========================파일 저장소===============================
+FSFFilePlayerDataBackend::FSFFilePlayerDataBackend(const FString& InFilePath)
+	: FilePath(InFilePath)
+{
+}
+
+void FSFFilePlayerDataBackend::SetSimulatedFailureRate(float InFailureRate, int32 Seed)
+{
+	SimulatedFailureRate = FMath::Clamp(InFailureRate, 0.f, 1.f);
+	FailureStream.Initialize(Seed);
+}
+
+void FSFFilePlayerDataBackend::ReadAll(const FSFPlayerDataReadComplete& OnComplete)
+{
+	LoadFile();
+	OnComplete.ExecuteIfBound(true, StoredValues);
+}
+
+void FSFFilePlayerDataBackend::WriteKeys(const FSFPlayerDataValues& Values, const FSFPlayerDataWriteComplete& OnComplete)
+{
+	// 네트워크 요청처럼 다음 Tick 이후 완료
+	FPendingWrite& PendingWrite = PendingWrites.AddDefaulted_GetRef();
+	PendingWrite.Values = Values;
+	PendingWrite.OnComplete = OnComplete;
+	PendingWrite.CompleteTime = LastTickTime + SimulatedLatency;
+}
+
+void FSFFilePlayerDataBackend::Tick(double Now)
+{
+	LastTickTime = Now;
+
+	// 콜백에서 새 쓰기가 들어올 수 있으므로 완료 대상만 먼저 떼어냄
+	TArray<FPendingWrite> CompletedWrites;
+	for (int32 Index = 0; Index < PendingWrites.Num();)
+	{
+		if (PendingWrites[Index].CompleteTime <= Now)
+		{
+			CompletedWrites.Add(MoveTemp(PendingWrites[Index]));
+			PendingWrites.RemoveAt(Index, 1, EAllowShrinking::No);
+		}
+		else
+		{
+			++Index;
+		}
+	}
+
+	for (FPendingWrite& Write : CompletedWrites)
+	{
+		if (SimulatedFailureRate > 0.f && FailureStream.FRand() < SimulatedFailureRate)
+		{
+			Write.OnComplete.ExecuteIfBound(false, TEXT("Simulated failure"));
+			continue;
+		}
+
+		LoadFile();
+		const FSFPlayerDataValues PreviousValues = StoredValues;
+		StoredValues.Append(Write.Values);
+
+		if (!SaveFile())
+		{
+			StoredValues = PreviousValues;
+			Write.OnComplete.ExecuteIfBound(false, FString::Printf(TEXT("Failed to write %s"), *FilePath));
+			continue;
+		}
+
+		Write.OnComplete.ExecuteIfBound(true, FString());
+	}
+}
+
+void FSFFilePlayerDataBackend::LoadFile()
+{
+	if (bFileLoaded)
+	{
+		return;
+	}
+	bFileLoaded = true;
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogSF, Error, TEXT("[PlayerData] Failed to parse %s"), *FilePath);
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonObject->Values)
+	{
+		FString Value;
+		if (Pair.Value.IsValid() && Pair.Value->TryGetString(Value))
+		{
+			StoredValues.Add(Pair.Key, Value);
+		}
+	}
+}
+
+bool FSFFilePlayerDataBackend::SaveFile() const
+{
+	const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, FString>& Pair : StoredValues)
+	{
+		JsonObject->SetStringField(Pair.Key, Pair.Value);
+	}
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	if (!FJsonSerializer::Serialize(JsonObject, Writer))
+	{
+		return false;
+	}
+
+	// 임시 파일에 쓴 뒤 교체 → 쓰는 도중 종료돼도 이전 내용 유지
+	const FString TempPath = FilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveStringToFile(JsonString, *TempPath))
+	{
+		return false;
+	}
+	return IFileManager::Get().Move(*FilePath, *TempPath, true, true);
+}
+//====================================================================
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+// 키 → 문자열 값 (PlayFab User Data 한 항목)
+using FSFPlayerDataValues = TMap<FString, FString>;
+
+DECLARE_DELEGATE_TwoParams(FSFPlayerDataWriteComplete, bool /*bSuccess*/, const FString& /*Error*/);
+DECLARE_DELEGATE_TwoParams(FSFPlayerDataReadComplete, bool /*bSuccess*/, const FSFPlayerDataValues& /*Values*/);
+
+/**
+ * ISFPlayerDataBackend
+ * 플레이어 세이브 데이터 저장소 (키 단위 읽기/부분 쓰기)
+ * - WriteKeys는 넘긴 키만 갱신하고 나머지 키는 유지
+ * - 완료 콜백은 비동기로 호출될 수 있음. Tick은 쓰기 큐가 매 갱신마다 호출
+ */
+class SF_API ISFPlayerDataBackend
+{
+public:
+	virtual ~ISFPlayerDataBackend() = default;
+
+	virtual void ReadAll(const FSFPlayerDataReadComplete& OnComplete) = 0;
+	virtual void WriteKeys(const FSFPlayerDataValues& Values, const FSFPlayerDataWriteComplete& OnComplete) = 0;
+
+	virtual void Tick(double Now) {}
+	virtual FString GetBackendName() const = 0;
+};
+
+/**
+ * FSFPlayFabPlayerDataBackend
+ * PlayFab Client API User Data (UpdateUserData / GetUserData). 로그인 이후에만 사용
+ */
+class SF_API FSFPlayFabPlayerDataBackend : public ISFPlayerDataBackend
+{
+public:
+	virtual void ReadAll(const FSFPlayerDataReadComplete& OnComplete) override;
+	virtual void WriteKeys(const FSFPlayerDataValues& Values, const FSFPlayerDataWriteComplete& OnComplete) override;
+	virtual FString GetBackendName() const override { return TEXT("PlayFab"); }
+};
+
+/**
+ * FSFFilePlayerDataBackend
+ * 프로세스 내 JSON 파일 저장소 (오프라인 플레이/테스트용)
+ * - SimulatedLatency 뒤 Tick에서 완료 → 실제 네트워크처럼 요청이 겹치는 상황 재현
+ * - SimulatedFailureRate 확률로 쓰기 실패 (재시도/복구 테스트용, 파일은 갱신하지 않음)
+ */
+class SF_API FSFFilePlayerDataBackend : public ISFPlayerDataBackend
+{
+public:
+	explicit FSFFilePlayerDataBackend(const FString& InFilePath);
+
+	void SetSimulatedLatency(double InLatency) { SimulatedLatency = FMath::Max(0.0, InLatency); }
+	void SetSimulatedFailureRate(float InFailureRate, int32 Seed = 0);
+
+	virtual void ReadAll(const FSFPlayerDataReadComplete& OnComplete) override;
+	virtual void WriteKeys(const FSFPlayerDataValues& Values, const FSFPlayerDataWriteComplete& OnComplete) override;
+	virtual void Tick(double Now) override;
+	virtual FString GetBackendName() const override { return TEXT("File"); }
+
+	const FString& GetFilePath() const { return FilePath; }
+
+	// 완료된 쓰기만 반영된 현재 파일 내용
+	const FSFPlayerDataValues& GetStoredValues() const { return StoredValues; }
+
+private:
+	void LoadFile();
+	bool SaveFile() const;
+
+	struct FPendingWrite
+	{
+		FSFPlayerDataValues Values;
+		FSFPlayerDataWriteComplete OnComplete;
+		double CompleteTime = 0.0;
+	};
+
+	FString FilePath;
+	FSFPlayerDataValues StoredValues;
+	bool bFileLoaded = false;
+
+	TArray<FPendingWrite> PendingWrites;
+	double LastTickTime = 0.0;
+
+	double SimulatedLatency = 0.0;
+	float SimulatedFailureRate = 0.f;
+	FRandomStream FailureStream;
+};
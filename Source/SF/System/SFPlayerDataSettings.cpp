@@ -0,0 +1 @@
+#include "SFPlayerDataSettings.h"
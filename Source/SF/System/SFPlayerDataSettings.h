@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "SFPlayerDataSettings.generated.h"
+
+/**
+ * 플레이어 세이브 데이터 쓰기 큐(FSFPlayerDataWriteQueue) / 저장소 설정
+ */
+UCLASS(Config=Game, DefaultConfig, meta = (DisplayName = "SF Player Data Settings"))
+class SF_API USFPlayerDataSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	// SavePlayerData 후 실제 전송까지 모으는 시간(초). 그 사이 저장 요청은 변경된 키만 합쳐서 한 번에 전송
+	UPROPERTY(Config, EditAnywhere, Category = "Write Queue", meta = (ClampMin = "0", Units = "s"))
+	float FlushInterval = 2.f;
+
+	// 전송 실패 시 첫 재시도 대기 시간(초). 연속 실패마다 두 배
+	UPROPERTY(Config, EditAnywhere, Category = "Write Queue", meta = (ClampMin = "0.1", Units = "s"))
+	float RetryBaseDelay = 1.f;
+
+	// 재시도 대기 시간 상한(초)
+	UPROPERTY(Config, EditAnywhere, Category = "Write Queue", meta = (ClampMin = "0.1", Units = "s"))
+	float RetryMaxDelay = 30.f;
+
+	// 시작 시 로드(ReadAll) 실패 후 재시도 포함 최대 시도 횟수. 대기 시간은 RetryBaseDelay/RetryMaxDelay 백오프를 같이 사용
+	UPROPERTY(Config, EditAnywhere, Category = "Load", meta = (ClampMin = "1"))
+	int32 MaxLoadAttempts = 5;
+
+	// 요청 하나에 담는 최대 키 수 (PlayFab UpdateUserData 제한 10)
+	UPROPERTY(Config, EditAnywhere, Category = "Write Queue", meta = (ClampMin = "1", ClampMax = "10"))
+	int32 MaxKeysPerWrite = 10;
+
+	// true면 PlayFab 대신 Saved/PlayerData 아래 JSON 파일에 저장 (Steam 없이 오프라인 테스트용)
+	UPROPERTY(Config, EditAnywhere, Category = "Backend")
+	bool bUseFileBackend = false;
+
+	// 파일 저장소 슬롯 이름 (Saved/PlayerData/<SlotName>.json)
+	UPROPERTY(Config, EditAnywhere, Category = "Backend", meta = (EditCondition = "bUseFileBackend"))
+	FString FileBackendSlotName = TEXT("Local");
+};
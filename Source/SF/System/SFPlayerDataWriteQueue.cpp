@@ -0,0 +1,281 @@
+#include "System/SFPlayerDataWriteQueue.h"
+
+#include "SFLogChannels.h"
+#include "SFPlayerDataSettings.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+FSFPlayerDataWriteQueue::FSFPlayerDataWriteQueue(const TSharedRef<ISFPlayerDataBackend>& InBackend, const FConfig& InConfig)
+	: Backend(InBackend)
+	, Config(InConfig)
+{
+	Config.MaxKeysPerWrite = FMath::Max(1, Config.MaxKeysPerWrite);
+}
+
+void FSFPlayerDataWriteQueue::SetPersistedValues(const FSFPlayerDataValues& Values)
+{
+	PersistedValues = Values;
+	PendingValues.Reset();
+	bFlushScheduled = false;
+	bFlushRequested = false;
+}
+
+void FSFPlayerDataWriteQueue::Stage(const FSFPlayerDataValues& Values, double Now)
+{
+	++Stats.SaveRequests;
+
+	for (const TPair<FString, FString>& Pair : Values)
+	{
+		// 전송 중인 값이 있으면 그 값이 곧 저장소 값이 됨
+		const FString* ExpectedValue = InFlightValues.Find(Pair.Key);
+		if (!ExpectedValue)
+		{
+			ExpectedValue = PersistedValues.Find(Pair.Key);
+		}
+
+		if (ExpectedValue && *ExpectedValue == Pair.Value)
+		{
+			PendingValues.Remove(Pair.Key);
+			continue;
+		}
+
+		if (FString* PendingValue = PendingValues.Find(Pair.Key))
+		{
+			*PendingValue = Pair.Value;
+		}
+		else
+		{
+			PendingValues.Add(Pair.Key, Pair.Value);
+			++Stats.KeysStaged;
+		}
+	}
+
+	if (PendingValues.Num() > 0 && !bFlushScheduled)
+	{
+		bFlushScheduled = true;
+		NextFlushTime = Now + Config.FlushInterval;
+	}
+}
+
+void FSFPlayerDataWriteQueue::Tick(double Now)
+{
+	CurrentTime = Now;
+	Backend->Tick(Now);
+
+	if (bFlushRequested || (bFlushScheduled && Now >= NextFlushTime))
+	{
+		TrySend(Now);
+	}
+}
+
+void FSFPlayerDataWriteQueue::Flush(double Now, bool bIgnoreRetryDelay)
+{
+	CurrentTime = Now;
+	bFlushRequested = PendingValues.Num() > 0;
+	if (bIgnoreRetryDelay)
+	{
+		NextRetryTime = 0.0;
+	}
+
+	TrySend(Now);
+}
+
+void FSFPlayerDataWriteQueue::TrySend(double Now)
+{
+	if (bWriteInFlight || Now < NextRetryTime)
+	{
+		return;
+	}
+
+	if (PendingValues.Num() == 0)
+	{
+		bFlushScheduled = false;
+		bFlushRequested = false;
+		return;
+	}
+
+	for (auto It = PendingValues.CreateIterator(); It && InFlightValues.Num() < Config.MaxKeysPerWrite; ++It)
+	{
+		InFlightValues.Add(It.Key(), MoveTemp(It.Value()));
+		It.RemoveCurrent();
+	}
+
+	// 한 요청에 다 못 담은 키는 다음 Tick에 바로 이어서 전송
+	bFlushScheduled = false;
+	bFlushRequested = PendingValues.Num() > 0;
+
+	bWriteInFlight = true;
+	++Stats.WritesSent;
+	Stats.KeysSent += InFlightValues.Num();
+
+	Backend->WriteKeys(InFlightValues, FSFPlayerDataWriteComplete::CreateSP(this, &FSFPlayerDataWriteQueue::OnWriteComplete));
+}
+
+void FSFPlayerDataWriteQueue::OnWriteComplete(bool bSuccess, const FString& Error)
+{
+	bWriteInFlight = false;
+
+	if (bSuccess)
+	{
+		++Stats.WritesSucceeded;
+		ConsecutiveFailures = 0;
+		NextRetryTime = 0.0;
+		PersistedValues.Append(MoveTemp(InFlightValues));
+		InFlightValues.Reset();
+	}
+	else
+	{
+		++Stats.WritesFailed;
+		++ConsecutiveFailures;
+
+		// 전송 중 새로 들어온 값이 있으면 그 값이 우선
+		for (TPair<FString, FString>& Pair : InFlightValues)
+		{
+			if (!PendingValues.Contains(Pair.Key))
+			{
+				PendingValues.Add(Pair.Key, MoveTemp(Pair.Value));
+			}
+		}
+		InFlightValues.Reset();
+
+		const double Backoff = FMath::Min(Config.RetryBaseDelay * FMath::Pow(2.0, ConsecutiveFailures - 1), Config.RetryMaxDelay);
+		NextRetryTime = CurrentTime + Backoff * FMath::FRandRange(0.8, 1.2);
+		bFlushRequested = true;
+
+		UE_LOG(LogSF, Warning, TEXT("[PlayerData] %s write failed (%d in a row), retrying in %.1fs: %s"),
+			*Backend->GetBackendName(), ConsecutiveFailures, NextRetryTime - CurrentTime, *Error);
+	}
+
+	if (PendingValues.Num() > 0 && !bFlushScheduled && !bFlushRequested)
+	{
+		bFlushScheduled = true;
+		NextFlushTime = CurrentTime + Config.FlushInterval;
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+// 사용법: SF.PlayerData.Benchmark [Saves] [FailureRate] [Latency]
+// 파일 저장소로 저장 요청 버스트를 가상 시간에서 재생하고 처리량/합치기 비율/실패 복구를 검증
+static FAutoConsoleCommandWithArgs CVarSFPlayerDataBenchmark(
+	TEXT("SF.PlayerData.Benchmark"),
+	TEXT("Replay save bursts through the player data write queue against the file backend. Args: [Saves=2000] [FailureRate=0.2] [Latency=0.15]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumSaves = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+		const float FailureRate = Args.Num() > 1 ? FMath::Clamp(FCString::Atof(*Args[1]), 0.f, 0.95f) : 0.2f;
+		const double Latency = Args.Num() > 2 ? FMath::Max(0.0, FCString::Atod(*Args[2])) : 0.15;
+
+		const FString FilePath = FPaths::ProjectSavedDir() / TEXT("Profiling") / TEXT("PlayerDataBenchmark.json");
+		IFileManager::Get().Delete(*FilePath);
+
+		const TSharedRef<FSFFilePlayerDataBackend> Backend = MakeShared<FSFFilePlayerDataBackend>(FilePath);
+		Backend->SetSimulatedLatency(Latency);
+		Backend->SetSimulatedFailureRate(FailureRate, 1337);
+
+		const USFPlayerDataSettings* Settings = GetDefault<USFPlayerDataSettings>();
+		FSFPlayerDataWriteQueue::FConfig Config;
+		Config.FlushInterval = Settings->FlushInterval;
+		Config.RetryBaseDelay = Settings->RetryBaseDelay;
+		Config.RetryMaxDelay = Settings->RetryMaxDelay;
+		Config.MaxKeysPerWrite = Settings->MaxKeysPerWrite;
+
+		const TSharedRef<FSFPlayerDataWriteQueue> Queue = MakeShared<FSFPlayerDataWriteQueue>(Backend, Config);
+
+		// 골드 + 영구 강화 5종 (FPlayerStats와 같은 키 구성)
+		static const TCHAR* UpgradeKeys[] = { TEXT("Wrath"), TEXT("Pride"), TEXT("Lust"), TEXT("Sloth"), TEXT("Greed") };
+		TMap<FString, int32> State;
+		State.Add(TEXT("Gold"), 0);
+		for (const TCHAR* Key : UpgradeKeys)
+		{
+			State.Add(Key, 0);
+		}
+
+		FSFPlayerDataValues Values;
+		auto BuildValues = [&State, &Values]()
+		{
+			Values.Reset();
+			for (const TPair<FString, int32>& Pair : State)
+			{
+				Values.Add(Pair.Key, FString::FromInt(Pair.Value));
+			}
+		};
+
+		FRandomStream Stream(42);
+		constexpr double FrameTime = 1.0 / 60.0;
+		constexpr double DrainTimeout = 600.0;
+		double SimTime = 0.0;
+		int32 SavesIssued = 0;
+
+		const double WallStart = FPlatformTime::Seconds();
+
+		// 골드 획득마다 저장 + 가끔 스테이지 종료 버스트 (같은 값으로 연속 저장)
+		while (SavesIssued < NumSaves)
+		{
+			const bool bStageEndBurst = Stream.FRand() < 0.01f;
+			const int32 NumThisFrame = bStageEndBurst ? Stream.RandRange(4, 8) : Stream.RandRange(0, 2);
+			for (int32 Index = 0; Index < NumThisFrame && SavesIssued < NumSaves; ++Index)
+			{
+				if (!bStageEndBurst)
+				{
+					State[TEXT("Gold")] += Stream.RandRange(1, 50);
+					if (Stream.FRand() < 0.05f)
+					{
+						State[UpgradeKeys[Stream.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(UpgradeKeys)) - 1)]]++;
+					}
+				}
+
+				BuildValues();
+				Queue->Stage(Values, SimTime);
+				++SavesIssued;
+			}
+
+			SimTime += FrameTime;
+			Queue->Tick(SimTime);
+		}
+
+		// 마지막 변경이 저장소에 반영될 때까지
+		const double LastSaveTime = SimTime;
+		Queue->Flush(SimTime);
+		while (Queue->HasPendingWrites() && SimTime - LastSaveTime < DrainTimeout)
+		{
+			SimTime += FrameTime;
+			Queue->Tick(SimTime);
+		}
+
+		const double WallSeconds = FPlatformTime::Seconds() - WallStart;
+
+		// 파일 내용과 최종 상태 비교
+		BuildValues();
+		int32 NumMismatches = 0;
+		for (const TPair<FString, FString>& Pair : Values)
+		{
+			const FString* Stored = Backend->GetStoredValues().Find(Pair.Key);
+			if (!Stored || *Stored != Pair.Value)
+			{
+				++NumMismatches;
+			}
+		}
+
+		const FSFPlayerDataWriteQueue::FStats& Stats = Queue->GetStats();
+		UE_LOG(LogSF, Display, TEXT("SF.PlayerData.Benchmark: %d saves over %.1fs simulated (failure rate %.0f%%, latency %.0f ms)"),
+			Stats.SaveRequests, LastSaveTime, FailureRate * 100.f, Latency * 1000.0);
+		UE_LOG(LogSF, Display, TEXT("  Writes sent     : %d (%d ok, %d failed), %d keys, %.2f keys/write"),
+			Stats.WritesSent, Stats.WritesSucceeded, Stats.WritesFailed, Stats.KeysSent, Stats.WritesSent > 0 ? static_cast<double>(Stats.KeysSent) / Stats.WritesSent : 0.0);
+		UE_LOG(LogSF, Display, TEXT("  Coalescing      : %.1f save requests per write (full-document saves would send %d writes, %d keys)"),
+			Queue->GetCoalescingRatio(), Stats.SaveRequests, Stats.SaveRequests * State.Num());
+		UE_LOG(LogSF, Display, TEXT("  Drain           : %.2fs after last save, %d consecutive failures at end"), SimTime - LastSaveTime, Queue->GetConsecutiveFailures());
+		UE_LOG(LogSF, Display, TEXT("  Throughput      : %.0f save requests/s wall (%.2f ms total, file %s)"),
+			WallSeconds > 0.0 ? Stats.SaveRequests / WallSeconds : 0.0, WallSeconds * 1000.0, *FilePath);
+
+		if (Queue->HasPendingWrites() || NumMismatches > 0)
+		{
+			UE_LOG(LogSF, Error, TEXT("  Recovery FAILED: %d keys differ from final state, %d still pending"), NumMismatches, Queue->GetNumPendingKeys());
+		}
+		else
+		{
+			UE_LOG(LogSF, Display, TEXT("  Recovery OK     : stored file matches final state"));
+		}
+	}));
+
+#endif
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "System/SFPlayerDataBackend.h"
+
+/**
+ * FSFPlayerDataWriteQueue
+ * 플레이어 세이브 데이터 Write-Behind 큐
+ * - Stage: 현재 값 스냅샷을 받아 저장소에 있는(또는 전송 중인) 값과 다른 키만 대기열에 올림
+ * - 첫 변경 후 FlushInterval 동안 들어온 저장 요청은 한 번의 부분 쓰기로 합쳐서 전송
+ * - 동시에 하나의 쓰기만 진행. 실패하면 키를 대기열로 되돌리고 지수 백오프 후 재시도
+ * - 시간은 호출자가 넘김 (게임: FPlatformTime, 벤치마크: 가상 시간)
+ */
+class SF_API FSFPlayerDataWriteQueue : public TSharedFromThis<FSFPlayerDataWriteQueue>
+{
+public:
+	struct FConfig
+	{
+		double FlushInterval = 2.0;
+		double RetryBaseDelay = 1.0;
+		double RetryMaxDelay = 30.0;
+		int32 MaxKeysPerWrite = 10;
+	};
+
+	struct FStats
+	{
+		int32 SaveRequests = 0;
+		int32 KeysStaged = 0;
+		int32 WritesSent = 0;
+		int32 KeysSent = 0;
+		int32 WritesSucceeded = 0;
+		int32 WritesFailed = 0;
+	};
+
+	FSFPlayerDataWriteQueue(const TSharedRef<ISFPlayerDataBackend>& InBackend, const FConfig& InConfig);
+
+	// 저장소에서 읽은 값으로 기준을 다시 잡음. 대기 중인 변경은 버림 (로드 전 값이 덮어쓰지 않도록)
+	void SetPersistedValues(const FSFPlayerDataValues& Values);
+
+	void Stage(const FSFPlayerDataValues& Values, double Now);
+	void Tick(double Now);
+
+	// 모으는 시간을 건너뛰고 바로 전송. bIgnoreRetryDelay면 재시도 대기도 무시 (종료 직전 등)
+	void Flush(double Now, bool bIgnoreRetryDelay = false);
+
+	bool HasPendingWrites() const { return PendingValues.Num() > 0 || bWriteInFlight; }
+	bool IsWriteInFlight() const { return bWriteInFlight; }
+	int32 GetNumPendingKeys() const { return PendingValues.Num(); }
+	int32 GetConsecutiveFailures() const { return ConsecutiveFailures; }
+
+	const FStats& GetStats() const { return Stats; }
+
+	// 저장 요청 수 / 실제 전송 수
+	double GetCoalescingRatio() const { return Stats.WritesSent > 0 ? static_cast<double>(Stats.SaveRequests) / Stats.WritesSent : 0.0; }
+
+	ISFPlayerDataBackend& GetBackend() const { return *Backend; }
+
+private:
+	void TrySend(double Now);
+	void OnWriteComplete(bool bSuccess, const FString& Error);
+
+private:
+	TSharedRef<ISFPlayerDataBackend> Backend;
+	FConfig Config;
+	FStats Stats;
+
+	// 저장소에 반영이 확인된 값 / 아직 보내지 않은 변경 / 전송 중인 값
+	FSFPlayerDataValues PersistedValues;
+	FSFPlayerDataValues PendingValues;
+	FSFPlayerDataValues InFlightValues;
+
+	bool bWriteInFlight = false;
+	bool bFlushScheduled = false;
+	bool bFlushRequested = false;
+	double NextFlushTime = 0.0;
+	double NextRetryTime = 0.0;
+	int32 ConsecutiveFailures = 0;
+
+	// 완료 콜백 시점의 시간 (백오프 계산용)
+	double CurrentTime = 0.0;
+};
@@ -0,0 +1 @@
+#include "SFProjectilePoolSettings.h"
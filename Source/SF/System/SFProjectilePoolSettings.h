@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "SFProjectilePoolSettings.generated.h"
+
+/**
+ * 투사체 풀(USFProjectilePoolSubsystem) 설정
+ */
+UCLASS(Config=Game, DefaultConfig, meta = (DisplayName = "SF Projectile Pool Settings"))
+class SF_API USFProjectilePoolSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	// false면 풀을 거치지 않고 기존처럼 SpawnActor/Destroy 사용
+	UPROPERTY(Config, EditAnywhere, Category = "Pool")
+	bool bEnableProjectilePool = true;
+
+	// 클래스별로 보관할 최대 대기 투사체 수. 초과분은 반환 시 Destroy
+	UPROPERTY(Config, EditAnywhere, Category = "Pool", meta = (ClampMin = "0"))
+	int32 MaxPooledPerClass = 64;
+
+	// 월드 시작 시 미리 생성해 둘 투사체 클래스와 개수 (서버 전용)
+	UPROPERTY(Config, EditAnywhere, Category = "Pool", meta = (AllowAbstract = "false"))
+	TMap<TSoftClassPtr<AActor>, int32> PrewarmClasses;
+};
@@ -0,0 +1,433 @@
+#include "SFProjectilePoolSubsystem.h"
+
+#include "Actors/SFAttackProjectile.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Interface/SFPoolableActorInterface.h"
+#include "SFLogChannels.h"
+#include "System/SFProjectilePoolSettings.h"
+#include "UObject/UObjectArray.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFProjectilePoolSubsystem)
+
+DECLARE_STATS_GROUP(TEXT("SF Projectile Pool"), STATGROUP_SFProjectilePool, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Free Actors"), STAT_SFProjectilePool_Free, STATGROUP_SFProjectilePool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Actors"), STAT_SFProjectilePool_Active, STATGROUP_SFProjectilePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawns Per Frame"), STAT_SFProjectilePool_Spawns, STATGROUP_SFProjectilePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reuses Per Frame"), STAT_SFProjectilePool_Reuses, STATGROUP_SFProjectilePool);
+
+USFProjectilePoolSubsystem* USFProjectilePoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<USFProjectilePoolSubsystem>() : nullptr;
+}
+
+void USFProjectilePoolSubsystem::ReleaseOrDestroy(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	USFProjectilePoolSubsystem* Pool = Actor->HasAuthority() ? Get(Actor) : nullptr;
+	if (Pool && Pool->IsPooledActor(Actor))
+	{
+		Pool->ReleaseActor(Actor);
+		return;
+	}
+
+	Actor->Destroy();
+}
+
+void USFProjectilePoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	bPoolingEnabled = GetDefault<USFProjectilePoolSettings>()->bEnableProjectilePool;
+}
+
+void USFProjectilePoolSubsystem::Deinitialize()
+{
+	// 액터는 월드 정리 시 함께 파괴되므로 참조만 해제
+	Buckets.Empty();
+	PooledActors.Empty();
+
+	Super::Deinitialize();
+}
+
+void USFProjectilePoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!CanPoolInWorld())
+	{
+		return;
+	}
+
+	for (const TPair<TSoftClassPtr<AActor>, int32>& Pair : GetDefault<USFProjectilePoolSettings>()->PrewarmClasses)
+	{
+		if (UClass* ActorClass = Pair.Key.LoadSynchronous())
+		{
+			Prewarm(ActorClass, Pair.Value);
+		}
+	}
+}
+
+bool USFProjectilePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool USFProjectilePoolSubsystem::CanPoolInWorld() const
+{
+	// 복제 투사체는 서버만 스폰하므로 클라이언트에서는 풀을 만들지 않음
+	const UWorld* World = GetWorld();
+	return bPoolingEnabled && World && World->GetNetMode() != NM_Client;
+}
+
+AActor* USFProjectilePoolSubsystem::BeginAcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator)
+{
+	UWorld* World = GetWorld();
+	if (!World || !ActorClass)
+	{
+		return nullptr;
+	}
+
+	const bool bPoolable = CanPoolInWorld() && ActorClass->ImplementsInterface(USFPoolableActorInterface::StaticClass());
+
+	if (bPoolable)
+	{
+		if (FSFActorPoolBucket* Bucket = Buckets.Find(ActorClass.Get()))
+		{
+			while (Bucket->FreeActors.Num() > 0)
+			{
+				AActor* Actor = Bucket->FreeActors.Pop(EAllowShrinking::No);
+				if (!IsValid(Actor) || Actor->IsActorBeingDestroyed())
+				{
+					continue;
+				}
+
+				// 아직 숨김/콜리전 꺼진 상태로 배치만 해 두고 FinishAcquireActor에서 깨움
+				PooledActors.Add(Actor, false);
+				Actor->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+				Actor->SetOwner(Owner);
+				Actor->SetInstigator(Instigator);
+
+				INC_DWORD_STAT(STAT_SFProjectilePool_Reuses);
+				return Actor;
+			}
+		}
+	}
+
+	if (!bPoolable)
+	{
+		INC_DWORD_STAT(STAT_SFProjectilePool_Spawns);
+		return World->SpawnActorDeferred<AActor>(ActorClass, SpawnTransform, Owner, Instigator, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	}
+
+	return SpawnPooledActor(ActorClass, SpawnTransform, Owner, Instigator);
+}
+
+AActor* USFProjectilePoolSubsystem::SpawnPooledActor(UClass* ActorClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator)
+{
+	AActor* Actor = GetWorld()->SpawnActorDeferred<AActor>(ActorClass, SpawnTransform, Owner, Instigator, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (Actor)
+	{
+		PooledActors.Add(Actor, false);
+		Actor->OnDestroyed.AddDynamic(this, &ThisClass::HandlePooledActorDestroyed);
+	}
+
+	INC_DWORD_STAT(STAT_SFProjectilePool_Spawns);
+	return Actor;
+}
+
+void USFProjectilePoolSubsystem::FinishAcquireActor(AActor* Actor, const FTransform& SpawnTransform)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	if (!Actor->IsActorInitialized())
+	{
+		Actor->FinishSpawning(SpawnTransform);
+	}
+	else
+	{
+		ActivateActor(Actor);
+	}
+
+	UpdateStats();
+}
+
+AActor* USFProjectilePoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator)
+{
+	AActor* Actor = BeginAcquireActor(ActorClass, SpawnTransform, Owner, Instigator);
+	FinishAcquireActor(Actor, SpawnTransform);
+	return Actor;
+}
+
+void USFProjectilePoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || Actor->IsActorBeingDestroyed())
+	{
+		return;
+	}
+
+	bool* bIsFree = PooledActors.Find(Actor);
+	if (!bIsFree)
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	// 같은 프레임에 Hit/Overlap이 모두 반환을 요청하는 경우
+	if (*bIsFree)
+	{
+		return;
+	}
+
+	FSFActorPoolBucket& Bucket = Buckets.FindOrAdd(Actor->GetClass());
+	if (!bPoolingEnabled || Bucket.FreeActors.Num() >= GetDefault<USFProjectilePoolSettings>()->MaxPooledPerClass)
+	{
+		PooledActors.Remove(Actor);
+		Actor->OnDestroyed.RemoveDynamic(this, &ThisClass::HandlePooledActorDestroyed);
+		Actor->Destroy();
+		UpdateStats();
+		return;
+	}
+
+	*bIsFree = true;
+	DeactivateActor(Actor);
+	Bucket.FreeActors.Add(Actor);
+
+	UpdateStats();
+}
+
+void USFProjectilePoolSubsystem::Prewarm(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+	if (!CanPoolInWorld() || !ActorClass || !ActorClass->ImplementsInterface(USFPoolableActorInterface::StaticClass()))
+	{
+		return;
+	}
+
+	FSFActorPoolBucket& Bucket = Buckets.FindOrAdd(ActorClass.Get());
+	const int32 TargetCount = FMath::Min(Count, GetDefault<USFProjectilePoolSettings>()->MaxPooledPerClass);
+
+	// 플레이 공간 아래에 숨긴 채 스폰 → BeginPlay 직후 바로 대기 상태로 전환
+	const FTransform HiddenTransform(FVector(0.f, 0.f, -50000.f));
+
+	while (Bucket.FreeActors.Num() < TargetCount)
+	{
+		AActor* Actor = SpawnPooledActor(ActorClass, HiddenTransform, nullptr, nullptr);
+		if (!Actor)
+		{
+			break;
+		}
+
+		Actor->SetActorHiddenInGame(true);
+		Actor->FinishSpawning(HiddenTransform);
+
+		PooledActors.Add(Actor, true);
+		DeactivateActor(Actor);
+		Bucket.FreeActors.Add(Actor);
+	}
+
+	UpdateStats();
+}
+
+void USFProjectilePoolSubsystem::DrainPool(TSubclassOf<AActor> ActorClass)
+{
+	for (auto It = Buckets.CreateIterator(); It; ++It)
+	{
+		if (ActorClass && It.Key() != ActorClass.Get())
+		{
+			continue;
+		}
+
+		// Destroy 콜백에서 버킷을 건드리지 않도록 먼저 비움
+		TArray<TObjectPtr<AActor>> FreeActors = MoveTemp(It.Value().FreeActors);
+		It.RemoveCurrent();
+
+		for (AActor* Actor : FreeActors)
+		{
+			if (IsValid(Actor))
+			{
+				PooledActors.Remove(Actor);
+				Actor->OnDestroyed.RemoveDynamic(this, &ThisClass::HandlePooledActorDestroyed);
+				Actor->Destroy();
+			}
+		}
+	}
+
+	UpdateStats();
+}
+
+int32 USFProjectilePoolSubsystem::GetNumFreeActors() const
+{
+	int32 NumFree = 0;
+	for (const TPair<TObjectPtr<UClass>, FSFActorPoolBucket>& Pair : Buckets)
+	{
+		NumFree += Pair.Value.FreeActors.Num();
+	}
+	return NumFree;
+}
+
+void USFProjectilePoolSubsystem::DeactivateActor(AActor* Actor)
+{
+	if (ISFPoolableActorInterface* Poolable = Cast<ISFPoolableActorInterface>(Actor))
+	{
+		Poolable->OnReleasedToPool();
+	}
+
+	Actor->SetLifeSpan(0.f);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetOwner(nullptr);
+	Actor->SetInstigator(nullptr);
+
+	// 숨김 상태를 마지막으로 보낸 뒤 채널을 닫음. 클라이언트 액터는 유지되어 다음 사용 시 그대로 재활용
+	// (숨김+콜리전 없음은 비관련 판정이지만 RelevantTimeout보다 Dormancy 전환이 훨씬 빠름)
+	Actor->ForceNetUpdate();
+	Actor->SetNetDormancy(DORM_DormantAll);
+}
+
+void USFProjectilePoolSubsystem::ActivateActor(AActor* Actor)
+{
+	Actor->SetNetDormancy(DORM_Awake);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(true);
+
+	if (Actor->InitialLifeSpan > 0.f)
+	{
+		Actor->SetLifeSpan(Actor->InitialLifeSpan);
+	}
+
+	if (ISFPoolableActorInterface* Poolable = Cast<ISFPoolableActorInterface>(Actor))
+	{
+		Poolable->OnAcquiredFromPool();
+	}
+
+	Actor->ForceNetUpdate();
+}
+
+void USFProjectilePoolSubsystem::HandlePooledActorDestroyed(AActor* DestroyedActor)
+{
+	if (!DestroyedActor)
+	{
+		return;
+	}
+
+	PooledActors.Remove(DestroyedActor);
+
+	if (FSFActorPoolBucket* Bucket = Buckets.Find(DestroyedActor->GetClass()))
+	{
+		Bucket->FreeActors.RemoveSingleSwap(DestroyedActor, EAllowShrinking::No);
+	}
+
+	UpdateStats();
+}
+
+void USFProjectilePoolSubsystem::UpdateStats() const
+{
+#if STATS
+	const int32 NumFree = GetNumFreeActors();
+	SET_DWORD_STAT(STAT_SFProjectilePool_Free, NumFree);
+	SET_DWORD_STAT(STAT_SFProjectilePool_Active, PooledActors.Num() - NumFree);
+#endif
+}
+
+#if !UE_BUILD_SHIPPING
+
+// 사용법: SF.Projectile.Benchmark [Count] [Burst]
+// 데디케이티드 서버(-nullrhi)에서도 -ExecCmds로 실행 가능
+// Burst개씩 동시에 살아 있는 투사체를 Count개 발사/제거하여 SpawnActor+Destroy와 풀 Acquire+Release의
+// 소요 시간, 새로 생성된 UObject 수, 이후 GC 시간을 비교
+static FAutoConsoleCommandWithWorldAndArgs CVarSFProjectilePoolBenchmark(
+	TEXT("SF.Projectile.Benchmark"),
+	TEXT("Compare SpawnActor/Destroy against projectile pool Acquire/Release. Args: [Count=1000] [Burst=50]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		USFProjectilePoolSubsystem* Pool = USFProjectilePoolSubsystem::Get(World);
+		if (!Pool || World->GetNetMode() == NM_Client)
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Projectile.Benchmark: run on the server (no projectile pool in this world)"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const int32 MaxPooled = GetDefault<USFProjectilePoolSettings>()->MaxPooledPerClass;
+		const int32 Burst = FMath::Clamp(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 50, 1, FMath::Max(1, MaxPooled));
+		const TSubclassOf<AActor> ProjectileClass = ASFAttackProjectile::StaticClass();
+		const bool bWasEnabled = Pool->IsPoolingEnabled();
+
+		struct FRunResult
+		{
+			double FireMs = 0.0;
+			double GCMs = 0.0;
+			int32 NewObjects = 0;
+		};
+
+		auto RunBenchmark = [&](bool bUsePool)
+		{
+			FRunResult Result;
+
+			Pool->SetPoolingEnabled(bUsePool);
+			Pool->DrainPool(ProjectileClass);
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+			TArray<AActor*> Alive;
+			Alive.Reserve(Burst);
+
+			const double FireStart = FPlatformTime::Seconds();
+			for (int32 Fired = 0; Fired < Count; )
+			{
+				const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+				for (int32 i = 0; i < Burst && Fired < Count; ++i, ++Fired)
+				{
+					const FTransform SpawnTransform(FVector(i * 100.f, 0.f, 100000.f));
+					if (AActor* Projectile = Pool->AcquireActor(ProjectileClass, SpawnTransform, nullptr, nullptr))
+					{
+						Alive.Add(Projectile);
+					}
+				}
+
+				Result.NewObjects += FMath::Max(0, GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore);
+
+				for (AActor* Projectile : Alive)
+				{
+					USFProjectilePoolSubsystem::ReleaseOrDestroy(Projectile);
+				}
+				Alive.Reset();
+			}
+			Result.FireMs = (FPlatformTime::Seconds() - FireStart) * 1000.0;
+
+			const double GCStart = FPlatformTime::Seconds();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+			Result.GCMs = (FPlatformTime::Seconds() - GCStart) * 1000.0;
+
+			return Result;
+		};
+
+		const FRunResult SpawnResult = RunBenchmark(false);
+		const FRunResult PoolResult = RunBenchmark(true);
+
+		Pool->DrainPool(ProjectileClass);
+		Pool->SetPoolingEnabled(bWasEnabled);
+
+		UE_LOG(LogSF, Display, TEXT("[ProjectilePoolBenchmark] Count=%d Burst=%d | Spawn/Destroy: %8.3f ms (%.3f us/shot, new UObjects %d, GC %.3f ms) | Pool: %8.3f ms (%.3f us/shot, new UObjects %d, GC %.3f ms)"),
+			Count, Burst,
+			SpawnResult.FireMs, SpawnResult.FireMs * 1000.0 / Count, SpawnResult.NewObjects, SpawnResult.GCMs,
+			PoolResult.FireMs, PoolResult.FireMs * 1000.0 / Count, PoolResult.NewObjects, PoolResult.GCMs);
+	})
+);
+
+#endif
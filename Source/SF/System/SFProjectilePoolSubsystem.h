@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SFProjectilePoolSubsystem.generated.h"
+
+/**
+ * 클래스 하나에 대한 대기(비활성) 액터 목록
+ */
+USTRUCT()
+struct FSFActorPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> FreeActors;
+};
+
+/**
+ * USFProjectilePoolSubsystem
+ * 서버에서 투사체 액터를 클래스별로 재사용하는 월드 서브시스템
+ * - Acquire: 대기 액터가 있으면 재배치 후 ISFPoolableActorInterface::OnAcquiredFromPool, 없으면 새로 스폰
+ * - Release: 숨김/콜리전 해제 후 DORM_DormantAll로 전환 → 액터 채널을 닫되 클라이언트 액터는 유지
+ *   (다시 꺼낼 때 Dormancy를 깨워 같은 액터에 변경분만 복제, 액터 채널/스폰 번치 재생성 없음)
+ * - 풀을 거치지 않은 액터는 ReleaseOrDestroy에서 기존처럼 Destroy
+ * - 풀 상태는 stat SFProjectilePool 로 확인
+ */
+UCLASS()
+class SF_API USFProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFProjectilePoolSubsystem* Get(const UObject* WorldContextObject);
+
+	// 풀 소속 액터면 반환, 아니면 Destroy (클라이언트에서는 아무 것도 하지 않는 기존 Destroy와 동일)
+	static void ReleaseOrDestroy(AActor* Actor);
+
+	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~UWorldSubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	//~End of UWorldSubsystem interface
+
+	// SpawnActorDeferred와 같은 흐름: 대기 액터를 꺼내 배치(아직 숨김/콜리전 꺼짐)하거나 지연 스폰만 수행
+	// 반환된 액터에 초기화 값을 넣은 뒤 반드시 FinishAcquireActor 호출
+	AActor* BeginAcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator);
+
+	// 새 스폰이면 FinishSpawning(BeginPlay), 재사용이면 깨워서 OnAcquiredFromPool 호출
+	void FinishAcquireActor(AActor* Actor, const FTransform& SpawnTransform);
+
+	// Begin + Finish 한 번에 (초기화 값이 필요 없는 경우)
+	AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator);
+
+	template<typename T>
+	T* BeginAcquire(TSubclassOf<T> ActorClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator)
+	{
+		return Cast<T>(BeginAcquireActor(ActorClass, SpawnTransform, Owner, Instigator));
+	}
+
+	template<typename T>
+	T* Acquire(TSubclassOf<T> ActorClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator)
+	{
+		return Cast<T>(AcquireActor(ActorClass, SpawnTransform, Owner, Instigator));
+	}
+
+	// 액터를 풀로 반환. 풀 소속이 아니거나 클래스별 상한을 넘으면 Destroy
+	void ReleaseActor(AActor* Actor);
+
+	// 대기 액터를 Count개까지 미리 생성
+	void Prewarm(TSubclassOf<AActor> ActorClass, int32 Count);
+
+	// 클래스의 대기 액터를 모두 파괴 (ActorClass가 null이면 전체)
+	void DrainPool(TSubclassOf<AActor> ActorClass = nullptr);
+
+	bool IsPooledActor(const AActor* Actor) const { return Actor && PooledActors.Contains(Actor); }
+
+	bool IsPoolingEnabled() const { return bPoolingEnabled; }
+	void SetPoolingEnabled(bool bEnabled) { bPoolingEnabled = bEnabled; }
+
+	int32 GetNumFreeActors() const;
+	int32 GetNumActiveActors() const { return PooledActors.Num() - GetNumFreeActors(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 풀 소속으로 등록된 액터를 지연 스폰 (FinishSpawning은 호출 측 책임)
+	AActor* SpawnPooledActor(UClass* ActorClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator);
+
+	// 풀 대기 상태로 전환 (숨김, 콜리전 해제, 수명 타이머 정지, Dormancy)
+	void DeactivateActor(AActor* Actor);
+
+	// 대기 상태에서 깨워 다시 보이게 함
+	void ActivateActor(AActor* Actor);
+
+	void UpdateStats() const;
+
+	bool CanPoolInWorld() const;
+
+	UFUNCTION()
+	void HandlePooledActorDestroyed(AActor* DestroyedActor);
+
+private:
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FSFActorPoolBucket> Buckets;
+
+	// 풀이 생성한 액터 (활성 + 대기). 값은 대기 중 여부 (중복 반환 방지)
+	TMap<TObjectKey<AActor>, bool> PooledActors;
+
+	bool bPoolingEnabled = true;
+};
@@ -0,0 +1,323 @@
+#include "SFLogChannels.h"
+#include "Character/Enemy/SFEnemy.h"
+#include "Containers/Ticker.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetworkObjectList.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameModes/SFEnemyManagerComponent.h"
+#include "GameModes/SFGameState.h"
+#include "HAL/IConsoleManager.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace SFPushModelBenchmark
+{
+	// 푸시 모델 전환 후 모든 채널이 한 번씩 비교/전송을 마칠 때까지 기다리는 프레임 수
+	static constexpr int32 SettleFrames = 60;
+
+	// 추가 스폰 적 배치 간격
+	static constexpr float SpawnSpacing = 150.f;
+
+	enum class EPhase : uint8
+	{
+		SettleCompare,
+		SampleCompare,
+		SettlePush,
+		SamplePush
+	};
+
+	struct FPhaseResult
+	{
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+		int64 ActiveObjectSum = 0;
+	};
+
+	/**
+	 * 서버 NetDriver TickFlush 시간을 푸시 모델 끔/켬 상태로 번갈아 측정
+	 * - 끔: 모든 복제 프로퍼티를 매 프레임 비교 / 켬: Dirty 표시된 프로퍼티만 비교
+	 * - 두 구간의 차이 ≈ 프로퍼티 비교 비용
+	 */
+	class FRunner : public TSharedFromThis<FRunner>
+	{
+	public:
+		bool Start(UWorld* InWorld, int32 TargetEnemyCount, int32 InSampleFrames);
+
+	private:
+		void SpawnEnemies(int32 TargetEnemyCount);
+		void SetPushModelEnabled(bool bEnabled) const;
+		void OnTickFlush(float DeltaSeconds);
+		void OnPostTickFlush();
+		void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+		void AdvancePhase();
+		void Report() const;
+		void Finish();
+
+	private:
+		TWeakObjectPtr<UWorld> World;
+		TArray<TWeakObjectPtr<ASFEnemy>> SpawnedEnemies;
+
+		FDelegateHandle TickFlushHandle;
+		FDelegateHandle PostTickFlushHandle;
+		FDelegateHandle WorldCleanupHandle;
+
+		EPhase Phase = EPhase::SettleCompare;
+		int32 SampleFrames = 0;
+		int32 FramesRemaining = 0;
+		double FlushStartTime = 0.0;
+
+		bool bOriginalPushModelEnabled = true;
+		FPhaseResult CompareResult;
+		FPhaseResult PushResult;
+	};
+
+	static TSharedPtr<FRunner> ActiveRunner;
+
+	bool FRunner::Start(UWorld* InWorld, int32 TargetEnemyCount, int32 InSampleFrames)
+	{
+		World = InWorld;
+		SampleFrames = InSampleFrames;
+		FramesRemaining = SettleFrames;
+		Phase = EPhase::SettleCompare;
+
+		IConsoleVariable* PushModelCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.IsPushModelEnabled"));
+		if (!PushModelCVar)
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Net.PushModelBenchmark: net.IsPushModelEnabled not found (build without WITH_PUSH_MODEL)"));
+			return false;
+		}
+		bOriginalPushModelEnabled = PushModelCVar->GetBool();
+
+		SpawnEnemies(TargetEnemyCount);
+
+		// Broadcast는 역순 호출 → NetDriver보다 나중에 바인딩한 TickFlush가 먼저 불려 시작 시각이 됨
+		TickFlushHandle = InWorld->OnTickFlush().AddSP(this, &FRunner::OnTickFlush);
+		PostTickFlushHandle = InWorld->OnPostTickFlush().AddSP(this, &FRunner::OnPostTickFlush);
+		WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddSP(this, &FRunner::OnWorldCleanup);
+
+		SetPushModelEnabled(false);
+
+		const AGameStateBase* GameState = InWorld->GetGameState();
+		const int32 NumPlayers = GameState ? GameState->PlayerArray.Num() : 0;
+		const ASFGameState* SFGameState = Cast<ASFGameState>(GameState);
+		const USFEnemyManagerComponent* EnemyManager = SFGameState ? SFGameState->GetEnemyManager() : nullptr;
+
+		UE_LOG(LogSF, Display, TEXT("SF.Net.PushModelBenchmark: %d players, %d enemies (%d spawned), %d connections, sampling %d frames per mode"),
+			NumPlayers, EnemyManager ? EnemyManager->GetAliveEnemyCount() : 0, SpawnedEnemies.Num(),
+			InWorld->GetNetDriver()->ClientConnections.Num(), SampleFrames);
+
+		if (NumPlayers < 4)
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Net.PushModelBenchmark: fewer than 4 players connected, results will understate the per-connection cost"));
+		}
+
+		return true;
+	}
+
+	void FRunner::SpawnEnemies(int32 TargetEnemyCount)
+	{
+		UWorld* LocalWorld = World.Get();
+		const ASFGameState* SFGameState = LocalWorld->GetGameState<ASFGameState>();
+		USFEnemyManagerComponent* EnemyManager = SFGameState ? SFGameState->GetEnemyManager() : nullptr;
+		if (!EnemyManager)
+		{
+			return;
+		}
+
+		const int32 NumToSpawn = TargetEnemyCount - EnemyManager->GetAliveEnemyCount();
+		if (NumToSpawn <= 0)
+		{
+			return;
+		}
+
+		// 스테이지에 배치된 적을 템플릿으로 주변 격자에 복제
+		const ASFEnemy* Template = nullptr;
+		for (const FSFEnemyRegistryEntry& Entry : EnemyManager->GetAliveEnemies())
+		{
+			if (Entry.Enemy.IsValid())
+			{
+				Template = Entry.Enemy.Get();
+				break;
+			}
+		}
+
+		if (!Template)
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Net.PushModelBenchmark: no alive enemy to use as a spawn template, running with current enemies"));
+			return;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+		const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumToSpawn)));
+		const FVector Origin = Template->GetActorLocation();
+		for (int32 Index = 0; Index < NumToSpawn; ++Index)
+		{
+			const FVector Offset((Index % GridSize - GridSize / 2) * SpawnSpacing, (Index / GridSize - GridSize / 2) * SpawnSpacing, 0.f);
+			ASFEnemy* Enemy = LocalWorld->SpawnActor<ASFEnemy>(Template->GetClass(), Origin + Offset, Template->GetActorRotation(), SpawnParams);
+			if (!Enemy)
+			{
+				continue;
+			}
+
+			if (!Enemy->GetController())
+			{
+				Enemy->SpawnDefaultController();
+			}
+			SpawnedEnemies.Add(Enemy);
+		}
+	}
+
+	void FRunner::SetPushModelEnabled(bool bEnabled) const
+	{
+		if (IConsoleVariable* PushModelCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.IsPushModelEnabled")))
+		{
+			PushModelCVar->Set(bEnabled, ECVF_SetByConsole);
+		}
+	}
+
+	void FRunner::OnTickFlush(float DeltaSeconds)
+	{
+		FlushStartTime = FPlatformTime::Seconds();
+	}
+
+	void FRunner::OnPostTickFlush()
+	{
+		UWorld* LocalWorld = World.Get();
+		UNetDriver* NetDriver = LocalWorld ? LocalWorld->GetNetDriver() : nullptr;
+		if (!NetDriver)
+		{
+			Finish();
+			return;
+		}
+
+		if (Phase == EPhase::SampleCompare || Phase == EPhase::SamplePush)
+		{
+			const double FlushMs = (FPlatformTime::Seconds() - FlushStartTime) * 1000.0;
+
+			FPhaseResult& Result = Phase == EPhase::SampleCompare ? CompareResult : PushResult;
+			Result.TotalMs += FlushMs;
+			Result.MaxMs = FMath::Max(Result.MaxMs, FlushMs);
+			Result.ActiveObjectSum += NetDriver->GetNetworkObjectList().GetActiveObjects().Num();
+		}
+
+		if (--FramesRemaining <= 0)
+		{
+			AdvancePhase();
+		}
+	}
+
+	void FRunner::OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+	{
+		// 측정 중 맵 이동 → 결과 없이 푸시 모델 설정만 복원
+		if (InWorld == World.Get())
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Net.PushModelBenchmark: world cleaned up before sampling finished"));
+			Finish();
+		}
+	}
+
+	void FRunner::AdvancePhase()
+	{
+		switch (Phase)
+		{
+		case EPhase::SettleCompare:
+			Phase = EPhase::SampleCompare;
+			FramesRemaining = SampleFrames;
+			break;
+
+		case EPhase::SampleCompare:
+			SetPushModelEnabled(true);
+			Phase = EPhase::SettlePush;
+			FramesRemaining = SettleFrames;
+			break;
+
+		case EPhase::SettlePush:
+			Phase = EPhase::SamplePush;
+			FramesRemaining = SampleFrames;
+			break;
+
+		case EPhase::SamplePush:
+			Report();
+			Finish();
+			break;
+		}
+	}
+
+	void FRunner::Report() const
+	{
+		const double CompareAverage = CompareResult.TotalMs / SampleFrames;
+		const double PushAverage = PushResult.TotalMs / SampleFrames;
+		const double Saved = CompareAverage - PushAverage;
+
+		UE_LOG(LogSF, Display, TEXT("SF.Net.PushModelBenchmark: NetDriver TickFlush over %d frames"), SampleFrames);
+		UE_LOG(LogSF, Display, TEXT("  Push model off: avg %7.3f ms, max %7.3f ms, %6.1f active net objects/frame"),
+			CompareAverage, CompareResult.MaxMs, static_cast<double>(CompareResult.ActiveObjectSum) / SampleFrames);
+		UE_LOG(LogSF, Display, TEXT("  Push model on : avg %7.3f ms, max %7.3f ms, %6.1f active net objects/frame"),
+			PushAverage, PushResult.MaxMs, static_cast<double>(PushResult.ActiveObjectSum) / SampleFrames);
+		UE_LOG(LogSF, Display, TEXT("  Property compare saved: %.3f ms/frame (%.1f%%)"), Saved, CompareAverage > 0.0 ? Saved / CompareAverage * 100.0 : 0.0);
+	}
+
+	void FRunner::Finish()
+	{
+		SetPushModelEnabled(bOriginalPushModelEnabled);
+		FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+
+		if (UWorld* LocalWorld = World.Get())
+		{
+			LocalWorld->OnTickFlush().Remove(TickFlushHandle);
+			LocalWorld->OnPostTickFlush().Remove(PostTickFlushHandle);
+		}
+
+		for (const TWeakObjectPtr<ASFEnemy>& Enemy : SpawnedEnemies)
+		{
+			if (Enemy.IsValid())
+			{
+				Enemy->Destroy();
+			}
+		}
+		SpawnedEnemies.Reset();
+
+		// 브로드캐스트 중일 수 있으므로 다음 틱에 해제
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+		{
+			ActiveRunner.Reset();
+			return false;
+		}));
+	}
+}
+
+// 사용법: SF.Net.PushModelBenchmark [Enemies] [SampleFrames]
+// 서버에서 적을 목표 수까지 채운 뒤 푸시 모델 끔/켬 상태의 NetDriver TickFlush 시간을 비교 (4인 세션 권장)
+static FAutoConsoleCommandWithWorldAndArgs CVarSFPushModelBenchmark(
+	TEXT("SF.Net.PushModelBenchmark"),
+	TEXT("Compare server net flush time with push model replication off and on. Args: [Enemies=200] [SampleFrames=300]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		using namespace SFPushModelBenchmark;
+
+		if (!World || !World->GetNetDriver() || !World->GetNetDriver()->IsServer())
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Net.PushModelBenchmark: run on the server (listen or dedicated)"));
+			return;
+		}
+
+		if (ActiveRunner.IsValid())
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Net.PushModelBenchmark: already running"));
+			return;
+		}
+
+		const int32 TargetEnemyCount = Args.Num() > 0 ? FMath::Max(0, FCString::Atoi(*Args[0])) : 200;
+		const int32 SampleFrames = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 300;
+
+		ActiveRunner = MakeShared<FRunner>();
+		if (!ActiveRunner->Start(World, TargetEnemyCount, SampleFrames))
+		{
+			ActiveRunner.Reset();
+		}
+	}));
+
+#endif
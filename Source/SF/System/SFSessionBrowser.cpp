@@ -0,0 +1,175 @@
+#include "SFSessionBrowser.h"
+
+bool FSFSessionFilter::Matches(const FSessionInfo& Info) const
+{
+	if (Info.bIsPasswordProtected && !bIncludePasswordProtected)
+	{
+		return false;
+	}
+
+	if (MinOpenSlots > 0 && Info.MaxPlayers - Info.CurrentPlayers < MinOpenSlots)
+	{
+		return false;
+	}
+
+	if (StageIndex != INDEX_NONE && Info.StageIndex != StageIndex)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+FSFSessionBrowser::FMergeStats FSFSessionBrowser::Merge(const TArray<FOnlineSessionSearchResult>& Results)
+{
+	FMergeStats Stats;
+	++SearchCount;
+
+	for (const FOnlineSessionSearchResult& Result : Results)
+	{
+		if (!Result.IsSessionInfoValid())
+		{
+			continue;
+		}
+
+		FSessionInfo Info = MakeSessionInfo(Result);
+		if (FEntry* Entry = Sessions.Find(Info.SessionId))
+		{
+			// 같은 검색 결과에 중복으로 들어온 세션
+			if (Entry->LastSeenSearch == SearchCount)
+			{
+				continue;
+			}
+
+			if (Entry->Info.HasSameDisplayData(Info))
+			{
+				++Stats.Unchanged;
+			}
+			else
+			{
+				++Stats.Updated;
+			}
+
+			Entry->Info = MoveTemp(Info);
+			Entry->LastSeenSearch = SearchCount;
+			Entry->MissedSearches = 0;
+		}
+		else
+		{
+			FEntry& NewEntry = Sessions.Add(Info.SessionId);
+			NewEntry.Info = MoveTemp(Info);
+			NewEntry.FirstSeenSerial = NextSerial++;
+			NewEntry.LastSeenSearch = SearchCount;
+			++Stats.Added;
+		}
+	}
+
+	for (auto It = Sessions.CreateIterator(); It; ++It)
+	{
+		FEntry& Entry = It.Value();
+		if (Entry.LastSeenSearch != SearchCount && ++Entry.MissedSearches > MaxMissedSearches)
+		{
+			It.RemoveCurrent();
+			++Stats.Removed;
+		}
+	}
+
+	RebuildFilteredIds();
+	return Stats;
+}
+
+void FSFSessionBrowser::SetFilter(const FSFSessionFilter& InFilter)
+{
+	if (Filter != InFilter)
+	{
+		Filter = InFilter;
+		RebuildFilteredIds();
+	}
+}
+
+int32 FSFSessionBrowser::GetNumPages(int32 PageSize) const
+{
+	return PageSize > 0 ? FMath::DivideAndRoundUp(FilteredIds.Num(), PageSize) : 0;
+}
+
+void FSFSessionBrowser::GetPage(int32 PageIndex, int32 PageSize, TArray<const FSessionInfo*>& OutSessions) const
+{
+	OutSessions.Reset();
+	if (PageIndex < 0 || PageSize <= 0)
+	{
+		return;
+	}
+
+	const int32 First = PageIndex * PageSize;
+	const int32 Last = FMath::Min(First + PageSize, FilteredIds.Num());
+	for (int32 Index = First; Index < Last; ++Index)
+	{
+		if (const FEntry* Entry = Sessions.Find(FilteredIds[Index]))
+		{
+			OutSessions.Add(&Entry->Info);
+		}
+	}
+}
+
+const FString* FSFSessionBrowser::GetFilteredSessionId(int32 FilteredIndex) const
+{
+	return FilteredIds.IsValidIndex(FilteredIndex) ? &FilteredIds[FilteredIndex] : nullptr;
+}
+
+const FSessionInfo* FSFSessionBrowser::Find(const FString& SessionId) const
+{
+	const FEntry* Entry = Sessions.Find(SessionId);
+	return Entry ? &Entry->Info : nullptr;
+}
+
+void FSFSessionBrowser::Reset()
+{
+	Sessions.Reset();
+	FilteredIds.Reset();
+}
+
+FSessionInfo FSFSessionBrowser::MakeSessionInfo(const FOnlineSessionSearchResult& SearchResult)
+{
+	const FOnlineSessionSettings& Settings = SearchResult.Session.SessionSettings;
+
+	FSessionInfo Info;
+	Info.SessionId = SearchResult.GetSessionIdStr();
+	Info.HostName = SearchResult.Session.OwningUserName;
+	Info.MaxPlayers = Settings.NumPublicConnections;
+	Info.CurrentPlayers = Info.MaxPlayers - SearchResult.Session.NumOpenPublicConnections;
+
+	Settings.Get(SFSessionKeys::RoomName, Info.RoomName);
+
+	bool bProtected = false;
+	Settings.Get(SFSessionKeys::Protected, bProtected);
+	Info.bIsPasswordProtected = bProtected;
+
+	Settings.Get(SFSessionKeys::Stage, Info.StageIndex);
+
+	Info.SearchResult = SearchResult;
+	return Info;
+}
+
+void FSFSessionBrowser::RebuildFilteredIds()
+{
+	TArray<TPair<int64, const FString*>> Matching;
+	Matching.Reserve(Sessions.Num());
+	for (const TPair<FString, FEntry>& Pair : Sessions)
+	{
+		if (Filter.Matches(Pair.Value.Info))
+		{
+			Matching.Emplace(Pair.Value.FirstSeenSerial, &Pair.Key);
+		}
+	}
+
+	Matching.Sort([](const TPair<int64, const FString*>& A, const TPair<int64, const FString*>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	FilteredIds.Reset(Matching.Num());
+	for (const TPair<int64, const FString*>& Match : Matching)
+	{
+		FilteredIds.Add(*Match.Value);
+	}
+}
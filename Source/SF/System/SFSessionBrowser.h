@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSessionSettings.h"
+#include "SFSessionBrowser.generated.h"
+
+// 세션 광고 키 (생성/검색/입장에서 공통 사용)
+namespace SFSessionKeys
+{
+	inline const FName Password(TEXT("PASSWORD"));
+	inline const FName RoomName(TEXT("ROOM_NAME"));
+	inline const FName Protected(TEXT("PROTECTED"));
+	inline const FName Stage(TEXT("STAGE"));
+}
+
+USTRUCT(BlueprintType)
+
+//======================================세션 정보==========================================
+struct FSessionInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	FString SessionId; //검색 결과 캐시 키
+
+	UPROPERTY(BlueprintReadOnly)
+	FString RoomName; //방 제목
+
+	UPROPERTY(BlueprintReadOnly)
+	FString HostName; //호스트 이름
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 CurrentPlayers = 0; //현재 플레이어
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 MaxPlayers = 0; //최대 플레이어
+
+	UPROPERTY(BlueprintReadOnly)
+	bool bIsPasswordProtected = false; // UI 표시용
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 StageIndex = INDEX_NONE; //진행 중인 스테이지 (광고하지 않는 방은 -1)
+
+	FOnlineSessionSearchResult SearchResult; //Join에 사용
+
+	// UI에 보이는 값만 비교 (SearchResult는 매 검색마다 새로 받음)
+	bool HasSameDisplayData(const FSessionInfo& Other) const
+	{
+		return RoomName == Other.RoomName
+			&& HostName == Other.HostName
+			&& CurrentPlayers == Other.CurrentPlayers
+			&& MaxPlayers == Other.MaxPlayers
+			&& bIsPasswordProtected == Other.bIsPasswordProtected
+			&& StageIndex == Other.StageIndex;
+	}
+};
+//========================================================================================
+
+//======================================검색 필터==========================================
+USTRUCT(BlueprintType)
+struct FSFSessionFilter
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session")
+	bool bIncludePasswordProtected = true; //비밀방 포함 여부
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session", meta = (ClampMin = "0"))
+	int32 MinOpenSlots = 0; //남은 자리가 이 수 이상인 방만 (0이면 꽉 찬 방도 표시)
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Session")
+	int32 StageIndex = INDEX_NONE; //특정 스테이지 진행 중인 방만 (-1이면 전체)
+
+	bool Matches(const FSessionInfo& Info) const;
+
+	bool operator==(const FSFSessionFilter& Other) const
+	{
+		return bIncludePasswordProtected == Other.bIncludePasswordProtected
+			&& MinOpenSlots == Other.MinOpenSlots
+			&& StageIndex == Other.StageIndex;
+	}
+	bool operator!=(const FSFSessionFilter& Other) const { return !(*this == Other); }
+};
+//========================================================================================
+
+/**
+ * FSFSessionBrowser
+ * 세션 검색 결과 캐시 (세션 ID 기준)
+ * - Merge: 검색 결과를 기존 캐시에 병합. 같은 세션은 그 자리에서 갱신하고 새 세션만 추가
+ * - 검색 결과에서 MaxMissedSearches번 넘게 연속으로 빠진 세션만 제거 → 상한이 있는 검색에서 목록이 깜빡이지 않음
+ * - 필터 적용 결과는 처음 발견된 순서로 유지해 새로고침해도 행 위치가 바뀌지 않음
+ * - 페이지는 필터 적용 후 목록 기준 (OSS 검색에는 서버 측 오프셋이 없음)
+ */
+class SF_API FSFSessionBrowser
+{
+public:
+	struct FMergeStats
+	{
+		int32 Added = 0;
+		int32 Updated = 0;
+		int32 Unchanged = 0;
+		int32 Removed = 0;
+
+		bool HasChanges() const { return Added > 0 || Updated > 0 || Removed > 0; }
+	};
+
+	FMergeStats Merge(const TArray<FOnlineSessionSearchResult>& Results);
+
+	void SetFilter(const FSFSessionFilter& InFilter);
+	const FSFSessionFilter& GetFilter() const { return Filter; }
+
+	void SetMaxMissedSearches(int32 InMaxMissedSearches) { MaxMissedSearches = FMath::Max(0, InMaxMissedSearches); }
+
+	int32 GetNumCached() const { return Sessions.Num(); }
+	int32 GetNumFiltered() const { return FilteredIds.Num(); }
+	int32 GetNumPages(int32 PageSize) const;
+
+	// 필터 적용 후 목록의 [PageIndex * PageSize, +PageSize) 구간. 포인터는 다음 Merge/Reset 전까지 유효
+	void GetPage(int32 PageIndex, int32 PageSize, TArray<const FSessionInfo*>& OutSessions) const;
+
+	// 필터 적용 후 목록 기준 인덱스 → 세션 ID
+	const FString* GetFilteredSessionId(int32 FilteredIndex) const;
+	const FSessionInfo* Find(const FString& SessionId) const;
+
+	void Reset();
+
+	// 검색 결과 → 표시용 정보
+	static FSessionInfo MakeSessionInfo(const FOnlineSessionSearchResult& SearchResult);
+
+private:
+	void RebuildFilteredIds();
+
+	struct FEntry
+	{
+		FSessionInfo Info;
+		int64 FirstSeenSerial = 0;
+		int32 LastSeenSearch = 0;
+		int32 MissedSearches = 0;
+	};
+
+	TMap<FString, FEntry> Sessions;
+	TArray<FString> FilteredIds;
+	FSFSessionFilter Filter;
+
+	int64 NextSerial = 0;
+	int32 SearchCount = 0;
+	int32 MaxMissedSearches = 1;
+};
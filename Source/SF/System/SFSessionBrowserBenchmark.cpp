@@ -0,0 +1,349 @@
+#include "SFLogChannels.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/CoreDelegates.h"
+#include "OnlineSubsystemNames.h"
+#include "OnlineSubsystemTypes.h"
+#include "System/SFOSSGameInstance.h"
+#include "System/SFSessionBrowser.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace SFSessionBrowserBenchmark
+{
+	// 한 번 갱신할 때 인원이 바뀌는 방 / 사라지고 새로 생기는 방 비율
+	static constexpr float ChangeRate = 0.1f;
+	static constexpr float ChurnRate = 0.02f;
+
+	/**
+	 * NULL OSS 세션 정보 흉내 (ID만 있음)
+	 * - OwningUserId가 없어 FOnlineSessionSearchResult::IsValid()가 false → 입장 시도는 GameInstance에서 거부됨
+	 */
+	class FMockSessionInfo : public FOnlineSessionInfo
+	{
+	public:
+		explicit FMockSessionInfo(const FString& InSessionId)
+			: SessionId(FUniqueNetIdString::Create(InSessionId, NULL_SUBSYSTEM))
+		{
+		}
+
+		virtual const uint8* GetBytes() const override { return nullptr; }
+		virtual int32 GetSize() const override { return 0; }
+		virtual bool IsValid() const override { return true; }
+		virtual const FUniqueNetId& GetSessionId() const override { return *SessionId; }
+		virtual FString ToString() const override { return SessionId->ToString(); }
+		virtual FString ToDebugString() const override { return FString::Printf(TEXT("MockSession: %s"), *SessionId->ToString()); }
+
+	private:
+		FUniqueNetIdRef SessionId;
+	};
+
+	static void RandomizeOccupancy(FOnlineSessionSearchResult& Result, FRandomStream& Stream)
+	{
+		Result.Session.NumOpenPublicConnections = Stream.RandRange(0, Result.Session.SessionSettings.NumPublicConnections - 1);
+		Result.Session.SessionSettings.Set(SFSessionKeys::Stage, Stream.RandRange(0, 4), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+	}
+
+	static FOnlineSessionSearchResult MakeMockResult(int32 MockId, FRandomStream& Stream)
+	{
+		FOnlineSessionSearchResult Result;
+		Result.Session.SessionInfo = MakeShared<FMockSessionInfo>(FString::Printf(TEXT("Mock_%06d"), MockId));
+		Result.Session.OwningUserName = FString::Printf(TEXT("MockHost_%06d"), MockId);
+		Result.PingInMs = Stream.RandRange(10, 200);
+
+		FOnlineSessionSettings& Settings = Result.Session.SessionSettings;
+		Settings.bIsLANMatch = true;
+		Settings.NumPublicConnections = 4;
+
+		const bool bProtected = Stream.FRand() < 0.25f;
+		Settings.Set(SFSessionKeys::RoomName, FString::Printf(TEXT("Mock Room %d"), MockId), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		Settings.Set(SFSessionKeys::Protected, bProtected, EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+		Settings.Set(SFSessionKeys::Password, bProtected ? FString(TEXT("mock")) : FString(), EOnlineDataAdvertisementType::ViaOnlineServiceAndPing);
+
+		RandomizeOccupancy(Result, Stream);
+		return Result;
+	}
+
+	/** 검색 결과 한 번 분량의 가짜 방 목록. Advance로 인원 변화 / 방 교체를 흉내 */
+	struct FMockPool
+	{
+		TArray<FOnlineSessionSearchResult> Results;
+		FRandomStream Stream;
+		int32 NextMockId = 0;
+
+		FMockPool(int32 NumSessions, int32 Seed)
+			: Stream(Seed)
+		{
+			Results.Reserve(NumSessions);
+			for (int32 Index = 0; Index < NumSessions; ++Index)
+			{
+				Results.Add(MakeMockResult(NextMockId++, Stream));
+			}
+		}
+
+		void Advance()
+		{
+			for (FOnlineSessionSearchResult& Result : Results)
+			{
+				const float Roll = Stream.FRand();
+				if (Roll < ChurnRate)
+				{
+					Result = MakeMockResult(NextMockId++, Stream);
+				}
+				else if (Roll < ChurnRate + ChangeRate)
+				{
+					RandomizeOccupancy(Result, Stream);
+				}
+			}
+		}
+	};
+
+	static double ElapsedMs(double StartTime)
+	{
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+
+	// 캐시 단독 비용 (UI 없음)
+	static void MeasureBrowser(int32 NumSessions, int32 PageSize)
+	{
+		FMockPool Pool(NumSessions, 7);
+		FSFSessionBrowser Browser;
+
+		double StartTime = FPlatformTime::Seconds();
+		Browser.Merge(Pool.Results);
+		const double ColdMergeMs = ElapsedMs(StartTime);
+
+		Pool.Advance();
+		StartTime = FPlatformTime::Seconds();
+		const FSFSessionBrowser::FMergeStats Stats = Browser.Merge(Pool.Results);
+		const double WarmMergeMs = ElapsedMs(StartTime);
+
+		FSFSessionFilter Filter;
+		Filter.bIncludePasswordProtected = false;
+		Filter.MinOpenSlots = 1;
+		StartTime = FPlatformTime::Seconds();
+		Browser.SetFilter(Filter);
+		const double FilterMs = ElapsedMs(StartTime);
+		const int32 NumFiltered = Browser.GetNumFiltered();
+
+		Browser.SetFilter(FSFSessionFilter());
+		const int32 NumPages = Browser.GetNumPages(PageSize);
+		TArray<const FSessionInfo*> Page;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 PageIndex = 0; PageIndex < NumPages; ++PageIndex)
+		{
+			Browser.GetPage(PageIndex, PageSize, Page);
+		}
+		const double PageMs = NumPages > 0 ? ElapsedMs(StartTime) / NumPages : 0.0;
+
+		UE_LOG(LogSF, Display, TEXT("SF.SessionBrowser.Benchmark: cache only, %d sessions, page size %d"), NumSessions, PageSize);
+		UE_LOG(LogSF, Display, TEXT("  Cold merge      : %8.3f ms"), ColdMergeMs);
+		UE_LOG(LogSF, Display, TEXT("  Warm merge      : %8.3f ms (%d added, %d updated, %d unchanged, %d removed)"),
+			WarmMergeMs, Stats.Added, Stats.Updated, Stats.Unchanged, Stats.Removed);
+		UE_LOG(LogSF, Display, TEXT("  Filter rebuild  : %8.3f ms (%d of %d shown without private/full rooms)"), FilterMs, NumFiltered, Browser.GetNumCached());
+		UE_LOG(LogSF, Display, TEXT("  Page fetch      : %8.4f ms/page over %d pages"), PageMs, NumPages);
+	}
+
+	/**
+	 * GameInstance 경로로 검색 결과를 넣고 그 프레임이 끝날 때까지 시간 측정 (검색 완료 → 화면 반영)
+	 * - 측정 프레임과 빈 프레임을 번갈아 돌려 평소 프레임 시간을 기준값으로 같이 기록
+	 * - 로비 위젯이 열려 있으면 리스트 갱신/행 생성 비용이 포함됨
+	 */
+	class FRunner : public TSharedFromThis<FRunner>
+	{
+	public:
+		void Start(USFOSSGameInstance* InGameInstance, int32 NumSessions, int32 InRuns);
+
+	private:
+		void OnBeginFrame();
+		void OnEndFrame();
+		void Report() const;
+		void Finish();
+
+	private:
+		TWeakObjectPtr<USFOSSGameInstance> GameInstance;
+		TUniquePtr<FMockPool> Pool;
+
+		FDelegateHandle BeginFrameHandle;
+		FDelegateHandle EndFrameHandle;
+
+		int32 Runs = 0;
+		int32 RunsDone = 0;
+		bool bMeasureFrame = false;
+		bool bFrameStarted = false;
+		double FrameStartTime = 0.0;
+		double ApplyMs = 0.0;
+
+		double TotalApplyMs = 0.0;
+		double TotalRenderMs = 0.0;
+		double MaxRenderMs = 0.0;
+		double TotalBaselineMs = 0.0;
+		int32 BaselineFrames = 0;
+	};
+
+	static TSharedPtr<FRunner> ActiveRunner;
+
+	void FRunner::Start(USFOSSGameInstance* InGameInstance, int32 NumSessions, int32 InRuns)
+	{
+		GameInstance = InGameInstance;
+		Runs = InRuns;
+		Pool = MakeUnique<FMockPool>(NumSessions, 11);
+
+		BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddSP(this, &FRunner::OnBeginFrame);
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddSP(this, &FRunner::OnEndFrame);
+
+		UE_LOG(LogSF, Display, TEXT("SF.SessionBrowser.Benchmark: %d mock sessions, %d runs, lobby UI %s"),
+			NumSessions, Runs, InGameInstance->OnSessionsUpdated.IsBound() ? TEXT("bound") : TEXT("not open (cache + delegate only)"));
+	}
+
+	void FRunner::OnBeginFrame()
+	{
+		USFOSSGameInstance* LocalGameInstance = GameInstance.Get();
+		if (!LocalGameInstance)
+		{
+			Finish();
+			return;
+		}
+
+		bFrameStarted = true;
+		FrameStartTime = FPlatformTime::Seconds();
+		if (!bMeasureFrame)
+		{
+			return;
+		}
+
+		// 첫 측정은 빈 캐시에 전부 추가, 이후는 일부만 바뀐 결과 병합
+		if (RunsDone > 0)
+		{
+			Pool->Advance();
+		}
+		LocalGameInstance->ApplySearchResults(Pool->Results);
+		ApplyMs = ElapsedMs(FrameStartTime);
+	}
+
+	void FRunner::OnEndFrame()
+	{
+		if (!bFrameStarted)
+		{
+			return;
+		}
+		bFrameStarted = false;
+
+		const double FrameMs = ElapsedMs(FrameStartTime);
+		if (!bMeasureFrame)
+		{
+			TotalBaselineMs += FrameMs;
+			++BaselineFrames;
+			bMeasureFrame = true;
+			return;
+		}
+
+		UE_LOG(LogSF, Log, TEXT("SF.SessionBrowser.Benchmark: run %d apply %.3f ms, search-to-render %.3f ms"), RunsDone, ApplyMs, FrameMs);
+		TotalApplyMs += ApplyMs;
+		TotalRenderMs += FrameMs;
+		MaxRenderMs = FMath::Max(MaxRenderMs, FrameMs);
+		bMeasureFrame = false;
+
+		if (++RunsDone >= Runs)
+		{
+			Report();
+			Finish();
+		}
+	}
+
+	void FRunner::Report() const
+	{
+		const double AverageRenderMs = TotalRenderMs / Runs;
+		const double AverageBaselineMs = BaselineFrames > 0 ? TotalBaselineMs / BaselineFrames : 0.0;
+
+		UE_LOG(LogSF, Display, TEXT("SF.SessionBrowser.Benchmark: search results → rendered frame over %d runs"), Runs);
+		UE_LOG(LogSF, Display, TEXT("  Merge + UI update : avg %8.3f ms"), TotalApplyMs / Runs);
+		UE_LOG(LogSF, Display, TEXT("  Search-to-render  : avg %8.3f ms, max %8.3f ms (idle frame %8.3f ms, +%.3f ms)"),
+			AverageRenderMs, MaxRenderMs, AverageBaselineMs, AverageRenderMs - AverageBaselineMs);
+	}
+
+	void FRunner::Finish()
+	{
+		FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+		// 가짜 방이 실제 로비 목록에 남지 않도록
+		if (USFOSSGameInstance* LocalGameInstance = GameInstance.Get())
+		{
+			LocalGameInstance->ClearSessionSearch();
+		}
+
+		// 브로드캐스트 중일 수 있으므로 다음 틱에 해제
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+		{
+			ActiveRunner.Reset();
+			return false;
+		}));
+	}
+
+	static USFOSSGameInstance* GetGameInstance(UWorld* World, const TCHAR* CommandName)
+	{
+		USFOSSGameInstance* GameInstance = World ? World->GetGameInstance<USFOSSGameInstance>() : nullptr;
+		if (!GameInstance)
+		{
+			UE_LOG(LogSF, Warning, TEXT("%s: requires USFOSSGameInstance"), CommandName);
+		}
+		return GameInstance;
+	}
+}
+
+// 사용법: SF.SessionBrowser.SeedMock [Sessions] [Seed]
+// 가짜 방 목록을 세션 검색 완료와 같은 경로로 넣음 (로비 UI 스크롤/필터 확인용, 입장은 거부됨)
+static FAutoConsoleCommandWithWorldAndArgs CVarSFSessionBrowserSeedMock(
+	TEXT("SF.SessionBrowser.SeedMock"),
+	TEXT("Feed mock search results into the session browser cache through the find-sessions path. Args: [Sessions=2000] [Seed=0]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		using namespace SFSessionBrowserBenchmark;
+
+		USFOSSGameInstance* GameInstance = GetGameInstance(World, TEXT("SF.SessionBrowser.SeedMock"));
+		if (!GameInstance)
+		{
+			return;
+		}
+
+		const int32 NumSessions = Args.Num() > 0 ? FMath::Max(0, FCString::Atoi(*Args[0])) : 2000;
+		const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 0;
+
+		const FMockPool Pool(NumSessions, Seed);
+		GameInstance->ApplySearchResults(Pool.Results);
+	}));
+
+// 사용법: SF.SessionBrowser.Benchmark [Sessions] [Runs]
+// 캐시 병합/필터/페이지 비용과 검색 완료 → 화면 반영까지의 프레임 시간을 측정 (로비 위젯을 연 상태에서 실행 권장)
+static FAutoConsoleCommandWithWorldAndArgs CVarSFSessionBrowserBenchmark(
+	TEXT("SF.SessionBrowser.Benchmark"),
+	TEXT("Measure session cache merge/filter/page cost and search-to-render latency with mock sessions. Args: [Sessions=5000] [Runs=20]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		using namespace SFSessionBrowserBenchmark;
+
+		USFOSSGameInstance* GameInstance = GetGameInstance(World, TEXT("SF.SessionBrowser.Benchmark"));
+		if (!GameInstance)
+		{
+			return;
+		}
+
+		if (ActiveRunner.IsValid())
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.SessionBrowser.Benchmark: already running"));
+			return;
+		}
+
+		const int32 NumSessions = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 5000;
+		const int32 Runs = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 20;
+
+		MeasureBrowser(NumSessions, GameInstance->GetSessionPageSize());
+
+		ActiveRunner = MakeShared<FRunner>();
+		ActiveRunner->Start(GameInstance, NumSessions, Runs);
+	}));
+
+#endif
@@ -0,0 +1,424 @@
+#include "SFSpatialHashSubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "SFLogChannels.h"
+#include "Team/SFTeamInfoStatics.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SFSpatialHashSubsystem)
+
+DECLARE_STATS_GROUP(TEXT("SF Spatial"), STATGROUP_SFSpatial, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("SpatialHash Tick"), STAT_SFSpatialHash_Tick, STATGROUP_SFSpatial);
+DECLARE_CYCLE_STAT(TEXT("SpatialHash Query"), STAT_SFSpatialHash_Query, STATGROUP_SFSpatial);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Actors"), STAT_SFSpatialHash_NumEntries, STATGROUP_SFSpatial);
+
+USFSpatialHashSubsystem* USFSpatialHashSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<USFSpatialHashSubsystem>() : nullptr;
+}
+
+void USFSpatialHashSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(CellSize, 100.f);
+	Entries.Reset();
+	EntryIndexMap.Reset();
+	Cells.Reset();
+}
+
+void USFSpatialHashSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndexMap.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+bool USFSpatialHashSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId USFSpatialHashSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USFSpatialHashSubsystem, STATGROUP_Tickables);
+}
+
+void USFSpatialHashSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SFSpatialHash_Tick);
+
+	// 뒤에서부터 순회해야 RemoveAtSwap 시 아직 안 본 엔트리가 당겨오지 않음
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		FSpatialEntry& Entry = Entries[Index];
+
+		const AActor* Actor = Entry.Actor.Get();
+		if (!IsValid(Actor))
+		{
+			RemoveEntryAt(Index);
+			continue;
+		}
+
+		Entry.Location = Actor->GetActorLocation();
+
+		const FIntPoint NewCell = ToCell(Entry.Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(Entry.Cell, Index);
+			Entry.Cell = NewCell;
+			AddToCell(NewCell, Index);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_SFSpatialHash_NumEntries, Entries.Num());
+}
+
+void USFSpatialHashSubsystem::RegisterActor(AActor* Actor, ESFSpatialCategory Category)
+{
+	if (!IsValid(Actor) || Category == ESFSpatialCategory::None)
+	{
+		return;
+	}
+
+	// 이미 등록된 경우 카테고리만 갱신
+	if (const int32* ExistingIndex = EntryIndexMap.Find(Actor))
+	{
+		Entries[*ExistingIndex].Category = Category;
+		return;
+	}
+
+	FSpatialEntry& NewEntry = Entries.AddDefaulted_GetRef();
+	NewEntry.Actor = Actor;
+	NewEntry.Key = Actor;
+	NewEntry.Location = Actor->GetActorLocation();
+	NewEntry.Cell = ToCell(NewEntry.Location);
+	NewEntry.Category = Category;
+
+	const int32 NewIndex = Entries.Num() - 1;
+	EntryIndexMap.Add(Actor, NewIndex);
+	AddToCell(NewEntry.Cell, NewIndex);
+}
+
+void USFSpatialHashSubsystem::UnregisterActor(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	if (const int32* IndexPtr = EntryIndexMap.Find(Actor))
+	{
+		RemoveEntryAt(*IndexPtr);
+	}
+}
+
+bool USFSpatialHashSubsystem::IsRegistered(const AActor* Actor) const
+{
+	return Actor && EntryIndexMap.Contains(Actor);
+}
+
+void USFSpatialHashSubsystem::UpdateActorLocation(const AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	const int32* IndexPtr = EntryIndexMap.Find(Actor);
+	if (!IndexPtr)
+	{
+		return;
+	}
+
+	const int32 Index = *IndexPtr;
+	FSpatialEntry& Entry = Entries[Index];
+	Entry.Location = Actor->GetActorLocation();
+
+	const FIntPoint NewCell = ToCell(Entry.Location);
+	if (NewCell != Entry.Cell)
+	{
+		RemoveFromCell(Entry.Cell, Index);
+		Entry.Cell = NewCell;
+		AddToCell(NewCell, Index);
+	}
+}
+
+template<typename FuncType>
+void USFSpatialHashSubsystem::ForEachEntryInRadius(const FVector& Origin, float Radius, const FSFSpatialQueryParams& Params, FuncType&& Visitor) const
+{
+	const float RadiusSq = Radius * Radius;
+
+	auto VisitEntry = [&](const FSpatialEntry& Entry)
+	{
+		if (FVector::DistSquared(Origin, Entry.Location) <= RadiusSq && PassesFilter(Entry, Params))
+		{
+			Visitor(Entry);
+		}
+	};
+
+	const FIntPoint MinCell = ToCell(Origin - FVector(Radius));
+	const FIntPoint MaxCell = ToCell(Origin + FVector(Radius));
+	const int64 NumCellsInRange = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+	// 반경이 매우 커서 셀 범위가 실제 사용 중인 셀보다 많으면 밀집 배열을 그대로 순회
+	if (NumCellsInRange > Cells.Num())
+	{
+		for (const FSpatialEntry& Entry : Entries)
+		{
+			VisitEntry(Entry);
+		}
+		return;
+	}
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			if (const TArray<int32>* CellEntries = Cells.Find(FIntPoint(CellX, CellY)))
+			{
+				for (const int32 EntryIndex : *CellEntries)
+				{
+					VisitEntry(Entries[EntryIndex]);
+				}
+			}
+		}
+	}
+}
+
+void USFSpatialHashSubsystem::QueryRadius(const FVector& Origin, float Radius, const FSFSpatialQueryParams& Params, TArray<AActor*>& OutActors) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SFSpatialHash_Query);
+
+	ForEachEntryInRadius(Origin, Radius, Params, [&OutActors](const FSpatialEntry& Entry)
+	{
+		OutActors.Add(Entry.Actor.Get());
+	});
+}
+
+void USFSpatialHashSubsystem::QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, const FSFSpatialQueryParams& Params, TArray<AActor*>& OutActors) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SFSpatialHash_Query);
+
+	const FVector ConeDir = Direction.GetSafeNormal();
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.f, 180.f)));
+
+	ForEachEntryInRadius(Origin, Radius, Params, [&](const FSpatialEntry& Entry)
+	{
+		const FVector ToEntry = (Entry.Location - Origin).GetSafeNormal();
+
+		// Origin과 같은 위치면 원뿔 안으로 간주
+		if (ToEntry.IsNearlyZero() || FVector::DotProduct(ConeDir, ToEntry) >= CosHalfAngle)
+		{
+			OutActors.Add(Entry.Actor.Get());
+		}
+	});
+}
+
+void USFSpatialHashSubsystem::GetActorsOfCategory(const FSFSpatialQueryParams& Params, TArray<AActor*>& OutActors) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SFSpatialHash_Query);
+
+	for (const FSpatialEntry& Entry : Entries)
+	{
+		if (PassesFilter(Entry, Params))
+		{
+			OutActors.Add(Entry.Actor.Get());
+		}
+	}
+}
+
+TArray<AActor*> USFSpatialHashSubsystem::K2_QueryRadius(FVector Origin, float Radius, int32 CategoryMask) const
+{
+	TArray<AActor*> Result;
+	QueryRadius(Origin, Radius, FSFSpatialQueryParams(static_cast<ESFSpatialCategory>(CategoryMask)), Result);
+	return Result;
+}
+
+FIntPoint USFSpatialHashSubsystem::ToCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void USFSpatialHashSubsystem::AddToCell(const FIntPoint& Cell, int32 EntryIndex)
+{
+	Cells.FindOrAdd(Cell).Add(EntryIndex);
+}
+
+void USFSpatialHashSubsystem::RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex)
+{
+	if (TArray<int32>* CellEntries = Cells.Find(Cell))
+	{
+		CellEntries->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+		if (CellEntries->IsEmpty())
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void USFSpatialHashSubsystem::RemoveEntryAt(int32 EntryIndex)
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	const FSpatialEntry& Removed = Entries[EntryIndex];
+	RemoveFromCell(Removed.Cell, EntryIndex);
+	EntryIndexMap.Remove(Removed.Key);
+
+	const int32 LastIndex = Entries.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		// 마지막 엔트리를 빈 자리로 옮기고 셀/맵의 인덱스를 보정
+		const FSpatialEntry& Moved = Entries[LastIndex];
+		if (TArray<int32>* CellEntries = Cells.Find(Moved.Cell))
+		{
+			const int32 SlotIndex = CellEntries->Find(LastIndex);
+			if (SlotIndex != INDEX_NONE)
+			{
+				(*CellEntries)[SlotIndex] = EntryIndex;
+			}
+		}
+		EntryIndexMap.Add(Moved.Key, EntryIndex);
+	}
+
+	Entries.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+}
+
+bool USFSpatialHashSubsystem::PassesFilter(const FSpatialEntry& Entry, const FSFSpatialQueryParams& Params) const
+{
+	if (!EnumHasAnyFlags(Params.CategoryMask, Entry.Category))
+	{
+		return false;
+	}
+
+	const AActor* Actor = Entry.Actor.Get();
+	if (!IsValid(Actor) || Actor == Params.IgnoreActor)
+	{
+		return false;
+	}
+
+	switch (Params.TeamFilter)
+	{
+	case ESFSpatialTeamFilter::Ally:
+		return USFTeamInfoStatics::AreAlly(Params.TeamReference, Actor);
+	case ESFSpatialTeamFilter::Hostile:
+		return USFTeamInfoStatics::AreHostile(Params.TeamReference, Actor);
+	default:
+		return true;
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+// 사용법: SF.Spatial.Benchmark [Iterations]
+// 50/200/1000개의 더미 액터를 스폰하여 공간 해시 반경 쿼리와 기존 GetAllActorsOfClass 스캔 비용을 비교
+static FAutoConsoleCommandWithWorldAndArgs CVarSFSpatialBenchmark(
+	TEXT("SF.Spatial.Benchmark"),
+	TEXT("Compare spatial hash radius queries against GetAllActorsOfClass scans at 50/200/1000 actors. Args: [Iterations=1000]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		USFSpatialHashSubsystem* SpatialHash = World ? World->GetSubsystem<USFSpatialHashSubsystem>() : nullptr;
+		if (!SpatialHash)
+		{
+			UE_LOG(LogSF, Warning, TEXT("SF.Spatial.Benchmark: no spatial hash subsystem in this world"));
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const float QueryRadius = 600.f;
+		const float HalfExtent = 10000.f;
+		const int32 ActorCounts[] = { 50, 200, 1000 };
+
+		FRandomStream Random(1337);
+
+		for (const int32 ActorCount : ActorCounts)
+		{
+			TArray<AActor*> SpawnedActors;
+			SpawnedActors.Reserve(ActorCount);
+
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			for (int32 i = 0; i < ActorCount; ++i)
+			{
+				const FVector Location(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), 0.f);
+				AActor* Dummy = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), SpawnParams);
+				if (!Dummy)
+				{
+					continue;
+				}
+
+				USceneComponent* Root = NewObject<USceneComponent>(Dummy, TEXT("Root"));
+				Dummy->SetRootComponent(Root);
+				Root->RegisterComponent();
+				Dummy->SetActorLocation(Location);
+
+				SpatialHash->RegisterActor(Dummy, ESFSpatialCategory::Enemy);
+				SpawnedActors.Add(Dummy);
+			}
+
+			TArray<FVector> Origins;
+			Origins.Reserve(Iterations);
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				Origins.Add(FVector(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), 0.f));
+			}
+
+			// 기존 방식: 월드 전체 스캔 후 거리 필터
+			int32 ScanHits = 0;
+			const double ScanStart = FPlatformTime::Seconds();
+			for (const FVector& Origin : Origins)
+			{
+				TArray<AActor*> Candidates;
+				UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), Candidates);
+				for (const AActor* Candidate : Candidates)
+				{
+					if (FVector::DistSquared(Origin, Candidate->GetActorLocation()) <= QueryRadius * QueryRadius)
+					{
+						++ScanHits;
+					}
+				}
+			}
+			const double ScanMs = (FPlatformTime::Seconds() - ScanStart) * 1000.0;
+
+			// 공간 해시 쿼리
+			int32 HashHits = 0;
+			TArray<AActor*> Results;
+			const double HashStart = FPlatformTime::Seconds();
+			for (const FVector& Origin : Origins)
+			{
+				Results.Reset();
+				SpatialHash->QueryRadius(Origin, QueryRadius, FSFSpatialQueryParams(ESFSpatialCategory::Enemy), Results);
+				HashHits += Results.Num();
+			}
+			const double HashMs = (FPlatformTime::Seconds() - HashStart) * 1000.0;
+
+			UE_LOG(LogSF, Display, TEXT("[SpatialBenchmark] Actors=%4d Iter=%d | Scan: %8.3f ms (%.3f us/query, hits %d) | Hash: %8.3f ms (%.3f us/query, hits %d)"),
+				ActorCount, Iterations,
+				ScanMs, ScanMs * 1000.0 / Iterations, ScanHits,
+				HashMs, HashMs * 1000.0 / Iterations, HashHits);
+
+			for (AActor* Dummy : SpawnedActors)
+			{
+				SpatialHash->UnregisterActor(Dummy);
+				Dummy->Destroy();
+			}
+		}
+	}));
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SFSpatialHashSubsystem.generated.h"
+
+/**
+ * 공간 해시에 등록되는 대상 분류 (쿼리 시 마스크로 사용)
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ESFSpatialCategory : uint8
+{
+	None			= 0 UMETA(Hidden),
+	Hero			= 1 << 0,
+	Enemy			= 1 << 1,
+	Pickup			= 1 << 2,
+	Interactable	= 1 << 3,
+
+	Character		= Hero | Enemy UMETA(Hidden),
+	All				= Hero | Enemy | Pickup | Interactable UMETA(Hidden)
+};
+ENUM_CLASS_FLAGS(ESFSpatialCategory);
+
+/**
+ * 쿼리 시 팀 필터
+ */
+UENUM(BlueprintType)
+enum class ESFSpatialTeamFilter : uint8
+{
+	Any,		// 팀 무시
+	Ally,		// TeamReference와 같은 팀만
+	Hostile		// TeamReference와 적대 관계만
+};
+
+/**
+ * 공간 쿼리 공통 파라미터
+ */
+struct FSFSpatialQueryParams
+{
+	FSFSpatialQueryParams() = default;
+	FSFSpatialQueryParams(ESFSpatialCategory InCategoryMask, const AActor* InIgnoreActor = nullptr)
+		: CategoryMask(InCategoryMask), IgnoreActor(InIgnoreActor)
+	{
+	}
+
+	// 검색할 카테고리 마스크
+	ESFSpatialCategory CategoryMask = ESFSpatialCategory::All;
+
+	// 결과에서 제외할 액터 (보통 자기 자신)
+	const AActor* IgnoreActor = nullptr;
+
+	// 팀 필터 기준 액터 (TeamFilter가 Any가 아닐 때만 사용)
+	const AActor* TeamReference = nullptr;
+	ESFSpatialTeamFilter TeamFilter = ESFSpatialTeamFilter::Any;
+};
+
+/**
+ * USFSpatialHashSubsystem
+ * 영웅/적/픽업/상호작용 대상을 균일 격자(XY) 공간 해시로 관리하는 월드 서브시스템
+ * - 매 프레임 등록된 액터의 위치를 갱신하고, 셀이 바뀐 경우에만 버킷을 이동
+ * - 반경/원뿔/팀 필터 쿼리를 제공하여 GetAllActorsOfClass 기반 월드 전체 스캔을 대체
+ * - 서버/클라이언트 모두 생성됨 (각자 BeginPlay 시점에 등록)
+ */
+UCLASS(Config = Game)
+class SF_API USFSpatialHashSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFSpatialHashSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of UTickableWorldSubsystem interface
+
+	// 등록/해제
+	void RegisterActor(AActor* Actor, ESFSpatialCategory Category);
+	void UnregisterActor(const AActor* Actor);
+	bool IsRegistered(const AActor* Actor) const;
+
+	// 텔레포트 등 즉시 반영이 필요한 경우 (일반 이동은 Tick에서 갱신)
+	void UpdateActorLocation(const AActor* Actor);
+
+	// 반경 내 대상 검색 (2D 셀 + 3D 거리 검사)
+	void QueryRadius(const FVector& Origin, float Radius, const FSFSpatialQueryParams& Params, TArray<AActor*>& OutActors) const;
+
+	// 원뿔(Direction 기준 HalfAngleDegrees) 내 대상 검색
+	void QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, const FSFSpatialQueryParams& Params, TArray<AActor*>& OutActors) const;
+
+	// 반경 제한 없이 카테고리 전체 반환 (팀원 인디케이터 등)
+	void GetActorsOfCategory(const FSFSpatialQueryParams& Params, TArray<AActor*>& OutActors) const;
+
+	int32 GetNumRegistered() const { return Entries.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "SF|Spatial", meta = (DisplayName = "Query Radius"))
+	TArray<AActor*> K2_QueryRadius(FVector Origin, float Radius, UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/SF.ESFSpatialCategory")) int32 CategoryMask) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FSpatialEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<AActor> Key; // 액터 파괴 후에도 맵에서 제거할 수 있도록 보관
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		ESFSpatialCategory Category = ESFSpatialCategory::None;
+	};
+
+	FIntPoint ToCell(const FVector& Location) const;
+
+	void AddToCell(const FIntPoint& Cell, int32 EntryIndex);
+	void RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex);
+	void RemoveEntryAt(int32 EntryIndex);
+
+	// 셀 범위를 순회하며 반경 안의 엔트리에 대해 Visitor 호출
+	template<typename FuncType>
+	void ForEachEntryInRadius(const FVector& Origin, float Radius, const FSFSpatialQueryParams& Params, FuncType&& Visitor) const;
+
+	bool PassesFilter(const FSpatialEntry& Entry, const FSFSpatialQueryParams& Params) const;
+
+private:
+	// 셀 한 변의 길이 (cm). 쿼리 반경의 평균 정도가 적당
+	UPROPERTY(Config)
+	float CellSize = 1000.f;
+
+	// 밀집 배열 + 액터 → 인덱스
+	TArray<FSpatialEntry> Entries;
+	TMap<TObjectKey<AActor>, int32> EntryIndexMap;
+
+	// 셀 → 엔트리 인덱스 목록
+	TMap<FIntPoint, TArray<int32>> Cells;
+};
@@ -2,6 +2,7 @@
 
 #include "SFAssetManager.h"
 #include "SFLogChannels.h"
+#include "SFOSSGameInstance.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
 
@@ -71,6 +72,12 @@ void USFStageSubsystem::SetCurrentStageInfo(const FSFStageInfo& NewStageInfo)
     if (CurrentStageInfo != NewStageInfo)
     {
         CurrentStageInfo = NewStageInfo;
+
+        // 호스트 중이면 세션 검색 필터용 스테이지도 갱신
+        if (USFOSSGameInstance* GameInstance = Cast<USFOSSGameInstance>(GetGameInstance()))
+        {
+            GameInstance->UpdateAdvertisedStage(CurrentStageInfo.StageIndex);
+        }
     }
 }
 
@@ -15,26 +15,41 @@ void USFMiniMapIcon::SetTarget(TScriptInterface<ISFMiniMapTrackable> InTarget)
     UObject* TargetObj = TrackedTarget.GetObject();
     
     EMiniMapIconType Type = ISFMiniMapTrackable::Execute_GetMiniMapIconType(TargetObj);
-    
-    if (UTexture2D** FoundTexture = IconTextures.Find(Type))
+
+    FSlateBrush Brush;
+    FLinearColor Color;
+    float Scale = 1.0f;
+    GetIconStyle(Type, Brush, Color, Scale);
+
+    IconImage->SetBrush(Brush);
+    SetRenderScale(FVector2D(Scale, Scale));
+    IconImage->SetColorAndOpacity(Color);
+}
+
+void USFMiniMapIcon::GetIconStyle(EMiniMapIconType Type, FSlateBrush& OutBrush, FLinearColor& OutColor, float& OutScale) const
+{
+    if (IconImage)
+    {
+        OutBrush = IconImage->GetBrush();
+    }
+
+    if (UTexture2D* const* FoundTexture = IconTextures.Find(Type))
     {
-       IconImage->SetBrushFromTexture(*FoundTexture);
+       OutBrush.SetResourceObject(*FoundTexture);
     }
     
-    float Scale = (Type == EMiniMapIconType::Boss) ? BossSizeMultiplier : 1.0f;
-    SetRenderScale(FVector2D(Scale, Scale));
+    OutScale = (Type == EMiniMapIconType::Boss) ? BossSizeMultiplier : 1.0f;
     
-    FLinearColor Color = FLinearColor::White;
+    OutColor = FLinearColor::White;
     switch (Type)
     {
         case EMiniMapIconType::Player: 
-            Color = PlayerColor; 
+            OutColor = PlayerColor; 
             break;
-        case EMiniMapIconType::Enemy:  Color = EnemyColor; break;
-        case EMiniMapIconType::Boss:   Color = BossColor; break;
+        case EMiniMapIconType::Enemy:  OutColor = EnemyColor; break;
+        case EMiniMapIconType::Boss:   OutColor = BossColor; break;
         default: break;
     }
-    IconImage->SetColorAndOpacity(Color);
 }
 
 void USFMiniMapIcon::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
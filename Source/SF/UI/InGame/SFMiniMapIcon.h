@@ -21,6 +21,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MiniMap")
 	void SetTarget(TScriptInterface<ISFMiniMapTrackable> InTarget);
 
+	// 타입별 아이콘 모양 (IconImage 브러시 + 타입 텍스처, 색, 크기 배율). USFMinimapWidget이 직접 그릴 때 사용
+	void GetIconStyle(EMiniMapIconType Type, FSlateBrush& OutBrush, FLinearColor& OutColor, float& OutScale) const;
+
 protected:
 	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 	
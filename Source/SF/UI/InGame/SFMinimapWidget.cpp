@@ -1,7 +1,7 @@
 ﻿#include "SFMinimapWidget.h"
 #include "SFMiniMapIcon.h"
 #include "Components/CanvasPanel.h"
-#include "Components/CanvasPanelSlot.h"
+#include "Rendering/DrawElements.h"
 #include "System/SFMinimapSubsystem.h"
 
 void USFMinimapWidget::NativeOnInitialized()
@@ -25,130 +25,142 @@ void USFMinimapWidget::NativeOnInitialized()
     if (World)
     {
         MiniMapSubsystem = World->GetSubsystem<USFMinimapSubsystem>();
-        if (MiniMapSubsystem)
-        {
-            MiniMapSubsystem->OnTargetRegistered.AddDynamic(this, &USFMinimapWidget::OnTargetRegistered);
-            MiniMapSubsystem->OnTargetUnregistered.AddDynamic(this, &USFMinimapWidget::OnTargetUnregistered);
-            
-            const TArray<TScriptInterface<ISFMiniMapTrackable>>& ExistingTargets = MiniMapSubsystem->GetAllTargets();
-            
-            for (const auto& Target : ExistingTargets)
-            {
-                OnTargetRegistered(Target);
-            }
-        }
     }
+
+    BuildIconStyles();
+
+    // 매 프레임 아이콘 위치가 바뀌므로 캐싱하지 않음
+    ForceVolatile(true);
 }
 
-void USFMinimapWidget::NativeDestruct()
+void USFMinimapWidget::BuildIconStyles()
 {
-    if (MiniMapSubsystem)
+    const UEnum* IconTypeEnum = StaticEnum<EMiniMapIconType>();
+    const int32 NumIconTypes = IconTypeEnum->NumEnums() - 1;
+
+    IconBrushes.SetNum(NumIconTypes);
+    IconStyles.SetNum(NumIconTypes);
+
+    // 아이콘 위젯은 모양(브러시/색/크기)을 읽을 때만 한 번 생성
+    USFMiniMapIcon* StyleSource = IconWidgetClass ? CreateWidget<USFMiniMapIcon>(this, IconWidgetClass) : nullptr;
+
+    for (int32 TypeIndex = 0; TypeIndex < NumIconTypes; ++TypeIndex)
     {
-        MiniMapSubsystem->OnTargetRegistered.RemoveAll(this);
-        MiniMapSubsystem->OnTargetUnregistered.RemoveAll(this);
+        const EMiniMapIconType Type = static_cast<EMiniMapIconType>(IconTypeEnum->GetValueByIndex(TypeIndex));
+        FIconStyle& Style = IconStyles[TypeIndex];
+
+        float Scale = 1.0f;
+        if (StyleSource)
+        {
+            StyleSource->GetIconStyle(Type, IconBrushes[TypeIndex], Style.Color, Scale);
+        }
+
+        Style.Size = FVector2f(IconBrushes[TypeIndex].GetImageSize()) * Scale;
+        Style.bPinToEdge = EdgePinnedIconTypes.Contains(Type);
     }
-    Super::NativeDestruct();
 }
 
 void USFMinimapWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
     Super::NativeTick(MyGeometry, InDeltaTime);
-    UpdateIconPositions();
+
+    bHasView = false;
+
+    APlayerController* PC = GetOwningPlayer();
+    if (!PC || !MiniMapSubsystem) return;
+
+    APawn* PlayerPawn = PC->GetPawn();
+    if (!PlayerPawn) return;
+
+    MiniMapSubsystem->RefreshTargets();
+
+    ViewPawn = PlayerPawn;
+    ViewOrigin = PlayerPawn->GetActorLocation();
+    ViewYaw = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetCameraRotation().Yaw : PlayerPawn->GetActorRotation().Yaw;
+    bHasView = true;
 }
 
-void USFMinimapWidget::OnTargetRegistered(TScriptInterface<ISFMiniMapTrackable> Target)
+int32 USFMinimapWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+    FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
-    if (!Target.GetObject() && !MiniMapCanvas) return;
+    int32 MaxLayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
 
-    if (APawn* MyPawn = GetOwningPlayerPawn())
+    if (!bHasView || !MiniMapSubsystem || MiniMapSubsystem->GetNumTargets() == 0)
     {
-        if (Target.GetObject() == MyPawn)
-        {
-            return;
-        }
+        return MaxLayerId;
     }
 
-    if (TargetIcons.Contains(Target.GetObject())) return;
+    // 아이콘은 캔버스(지도) 위에 그림
+    const int32 IconLayerId = MaxLayerId + 1;
 
-    USFMiniMapIcon* NewIcon = CreateWidget<USFMiniMapIcon>(this, IconWidgetClass);
-    if (NewIcon)
+    FVector2f Center = FVector2f(AllottedGeometry.GetLocalSize()) * 0.5f;
+    if (MiniMapCanvas)
     {
-        NewIcon->SetTarget(Target);
+        const FGeometry& CanvasGeometry = MiniMapCanvas->GetCachedGeometry();
+        Center = FVector2f(AllottedGeometry.AbsoluteToLocal(CanvasGeometry.GetAbsolutePositionAtCoordinates(FVector2D(0.5f, 0.5f))));
+    }
 
-        UPanelSlot* PanelSlot = MiniMapCanvas->AddChild(NewIcon);
+    // 반경 밖 판정은 회전 전 월드 거리로 먼저 수행
+    const double CullRadiusSq = FMath::Square(static_cast<double>(MapRadius) * MiniMapScale);
+    const float InvMiniMapScale = MiniMapScale > 0.f ? 1.f / MiniMapScale : 1.f;
 
-        if (UCanvasPanelSlot* CanvasSlot = Cast<UCanvasPanelSlot>(PanelSlot))
-        {
-            CanvasSlot->SetAnchors(FAnchors(0.5f));
-            CanvasSlot->SetAlignment(FVector2D(0.5f, 0.5f));
-            CanvasSlot->SetAutoSize(true);
-            CanvasSlot->SetPosition(FVector2D::ZeroVector);
-            CanvasSlot->SetZOrder(10);
-        }
+    double SinYaw, CosYaw;
+    FMath::SinCos(&SinYaw, &CosYaw, FMath::DegreesToRadians(ViewYaw));
 
-        TargetIcons.Add(Target.GetObject(), NewIcon);
-    }
-}
+    // 다운 상태 깜빡임 (0.5초 간격)
+    const float DownedOpacity = FMath::Fmod(Args.GetCurrentTime(), 1.0) < 0.5 ? 1.0f : 0.3f;
 
-void USFMinimapWidget::OnTargetUnregistered(TScriptInterface<ISFMiniMapTrackable> Target)
-{
-    if (!Target.GetObject()) return;
+    const UObject* SelfPawn = ViewPawn.Get();
+    const TArray<FVector>& Positions = MiniMapSubsystem->GetTargetPositions();
+    const TArray<EMiniMapIconType>& Types = MiniMapSubsystem->GetTargetTypes();
+    const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint();
 
-    if (USFMiniMapIcon** FoundIcon = TargetIcons.Find(Target.GetObject()))
+    for (int32 Index = 0; Index < Positions.Num(); ++Index)
     {
-        if (*FoundIcon)
+        const int32 TypeIndex = static_cast<int32>(Types[Index]);
+        if (!IconStyles.IsValidIndex(TypeIndex))
         {
-            (*FoundIcon)->RemoveFromParent();
+            continue;
         }
-        TargetIcons.Remove(Target.GetObject());
-    }
-}
 
-void USFMinimapWidget::UpdateIconPositions()
-{
-    APlayerController* PC = GetOwningPlayer();
-    if (!PC) return;
+        const FIconStyle& Style = IconStyles[TypeIndex];
+        const double RelX = Positions[Index].X - ViewOrigin.X;
+        const double RelY = Positions[Index].Y - ViewOrigin.Y;
+        const bool bOutside = (RelX * RelX + RelY * RelY) > CullRadiusSq;
 
-    APawn* PlayerPawn = PC->GetPawn();
-    if (!PlayerPawn) return;
+        if ((bOutside && !Style.bPinToEdge) || MiniMapSubsystem->GetTargetObject(Index) == SelfPawn)
+        {
+            continue;
+        }
 
-    FVector PlayerLoc = PlayerPawn->GetActorLocation();
-    
-    FRotator ViewRot = FRotator::ZeroRotator;
-    if (PC->PlayerCameraManager)
-    {
-        ViewRot = PC->PlayerCameraManager->GetCameraRotation();
-    }
-    else
-    {
-        ViewRot = PlayerPawn->GetActorRotation();
-    }
-    
-    for (auto It = TargetIcons.CreateIterator(); It; ++It)
-    {
-        UObject* TargetObj = It->Key;
-        USFMiniMapIcon* IconWidget = It->Value;
-
-        if (!IsValid(TargetObj) || !IsValid(IconWidget)) continue;
-        
-        FVector TargetLoc = ISFMiniMapTrackable::Execute_GetMiniMapWorldPosition(TargetObj);
-        FVector RelativeLoc = TargetLoc - PlayerLoc;
-        FVector UnrotatedLoc = RelativeLoc.RotateAngleAxis(-ViewRot.Yaw, FVector::UpVector);
-        
-        FVector2D FinalPos;
-        FinalPos.X = UnrotatedLoc.Y / MiniMapScale; 
-        FinalPos.Y = -UnrotatedLoc.X / MiniMapScale;
-        
-        if (FinalPos.Size() > MapRadius)
+        // 카메라 Yaw 기준으로 회전 (위쪽 = 카메라 정면)
+        const double ViewX = RelX * CosYaw + RelY * SinYaw;
+        const double ViewY = -RelX * SinYaw + RelY * CosYaw;
+        FVector2f IconPos(static_cast<float>(ViewY * InvMiniMapScale), static_cast<float>(-ViewX * InvMiniMapScale));
+
+        float Opacity = 1.0f;
+        if (bOutside)
         {
-            FinalPos = FinalPos.GetSafeNormal() * MapRadius;
-            IconWidget->SetRenderOpacity(0.5f);
+            IconPos = IconPos.GetSafeNormal() * MapRadius;
+            Opacity = EdgePinnedOpacity;
         }
-        else
+
+        if (MiniMapSubsystem->IsTargetDowned(Index))
         {
-            IconWidget->SetRenderOpacity(1.0f);
+            Opacity *= DownedOpacity;
         }
-        
-        IconWidget->SetRenderTranslation(FinalPos);
+
+        FLinearColor Color = Style.Color;
+        Color.A *= Opacity;
+
+        FSlateDrawElement::MakeBox(
+            OutDrawElements,
+            IconLayerId,
+            AllottedGeometry.ToPaintGeometry(Style.Size, FSlateLayoutTransform(Center + IconPos - Style.Size * 0.5f)),
+            &IconBrushes[TypeIndex],
+            ESlateDrawEffect::None,
+            Tint * Color);
     }
-}
\ No newline at end of file
+
+    return FMath::Max(MaxLayerId, IconLayerId);
+}
@@ -10,6 +10,12 @@ class UCanvasPanel;
 class USFMinimapSubsystem;
 class UImage;
 
+/**
+ * USFMinimapWidget
+ * USFMinimapSubsystem의 대상 배열을 NativePaint 한 번에 박스 요소로 그림 (대상별 아이콘 위젯/캔버스 슬롯 없음)
+ * - 아이콘 모양은 IconWidgetClass(USFMiniMapIcon) 인스턴스 하나에서 타입별로 한 번만 가져옴
+ * - MapRadius 밖의 대상은 그리지 않음 (EdgePinnedIconTypes만 가장자리에 반투명으로 고정)
+ */
 UCLASS()
 class SF_API USFMinimapWidget : public UUserWidget
 {
@@ -18,14 +24,9 @@ class SF_API USFMinimapWidget : public UUserWidget
 protected:
 	
 	virtual void NativeOnInitialized() override;
-	virtual void NativeDestruct() override;
 	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
-
-	UFUNCTION()
-	void OnTargetRegistered(TScriptInterface<ISFMiniMapTrackable> Target);
-
-	UFUNCTION()
-	void OnTargetUnregistered(TScriptInterface<ISFMiniMapTrackable> Target);
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
 
 protected:
 	
@@ -41,12 +42,36 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "MiniMap")
 	float MapRadius = 125.0f;
 
+	// 반경 밖에 있어도 가장자리에 표시할 타입
+	UPROPERTY(EditAnywhere, Category = "MiniMap")
+	TArray<EMiniMapIconType> EdgePinnedIconTypes = { EMiniMapIconType::Player, EMiniMapIconType::Boss };
+
+	UPROPERTY(EditAnywhere, Category = "MiniMap")
+	float EdgePinnedOpacity = 0.5f;
+
 private:
-	UPROPERTY()
-	TMap<UObject*, USFMiniMapIcon*> TargetIcons;
+	void BuildIconStyles();
+
+private:
+	struct FIconStyle
+	{
+		FLinearColor Color = FLinearColor::White;
+		FVector2f Size = FVector2f::ZeroVector;
+		bool bPinToEdge = false;
+	};
 
 	UPROPERTY()
-	USFMinimapSubsystem* MiniMapSubsystem;
+	TObjectPtr<USFMinimapSubsystem> MiniMapSubsystem;
+
+	// EMiniMapIconType 인덱스
+	UPROPERTY(Transient)
+	TArray<FSlateBrush> IconBrushes;
+
+	TArray<FIconStyle> IconStyles;
 
-	void UpdateIconPositions();
-};
\ No newline at end of file
+	// NativeTick에서 계산한 이번 프레임 시점 (NativePaint에서 사용)
+	TWeakObjectPtr<const APawn> ViewPawn;
+	FVector ViewOrigin = FVector::ZeroVector;
+	double ViewYaw = 0.0;
+	bool bHasView = false;
+};
@@ -62,8 +62,8 @@ void USFPasswordInputWidget::OnConfirmButtonClicked()
     }
     
     //실제 세션 비밀번호 읽기
-    const TArray<FSessionInfo>& Sessions = GameInstance->GetAvailableSessions();
-    if (!Sessions.IsValidIndex(SessionIndex))
+    FSessionInfo SessionInfo;
+    if (!GameInstance->FindSessionInfo(SessionId, SessionInfo))
     {
         if (ErrorMessageText)
         {
@@ -73,8 +73,8 @@ void USFPasswordInputWidget::OnConfirmButtonClicked()
     }
 
     FString RealPassword;
-    Sessions[SessionIndex].SearchResult.Session.SessionSettings.Get(
-        TEXT("PASSWORD"),
+    SessionInfo.SearchResult.Session.SessionSettings.Get(
+        SFSessionKeys::Password,
         RealPassword
     );
     
@@ -89,7 +89,7 @@ void USFPasswordInputWidget::OnConfirmButtonClicked()
     }
     
     //성공할 경우 JoinSession
-    GameInstance->JoinGameSession(SessionIndex, InputPassword);
+    GameInstance->JoinGameSessionById(SessionId, InputPassword);
 }
 
 void USFPasswordInputWidget::OnCancelButtonClicked()
@@ -115,10 +115,10 @@ void USFPasswordInputWidget::OnJoinSessionComplete(bool bWasSuccessful, const FS
 }
 //=========================================================================
 
-//==============================세션 인덱스 설정==============================
-void USFPasswordInputWidget::SetSessionIndex(int32 InSessionIndex)
+//==============================세션 ID 설정==============================
+void USFPasswordInputWidget::SetSessionId(const FString& InSessionId)
 {
-    SessionIndex = InSessionIndex;
+    SessionId = InSessionId;
 }
 //=========================================================================
 
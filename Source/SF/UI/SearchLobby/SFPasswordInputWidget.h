@@ -17,7 +17,7 @@ class SF_API USFPasswordInputWidget : public UUserWidget
 public:
 	virtual void NativeConstruct() override;
 
-	void SetSessionIndex(int32 InSessionIndex); //입장 시도할 세션 인덱스 설정
+	void SetSessionId(const FString& InSessionId); //입장 시도할 세션 ID 설정
 
 protected:
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
@@ -49,7 +49,7 @@ public:
 	//================================================================================
 
 private:
-	int32 SessionIndex; //입장할 세션 인덱스
+	FString SessionId; //입장할 세션 ID
 
 	UPROPERTY()
 	USFOSSGameInstance* GameInstance; //세션 입장 처리를 수행하는 GameInstance
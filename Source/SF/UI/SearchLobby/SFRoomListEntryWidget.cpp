@@ -72,7 +72,7 @@ void USFRoomListEntryWidget::OnJoinButtonClicked()
     }
     else
     {
-        GameInstance->JoinGameSession(SessionIndex, TEXT("")); //일반 방 입장
+        GameInstance->JoinGameSessionById(SessionInfo.SessionId, TEXT("")); //일반 방 입장
     }
 }
 
@@ -95,7 +95,7 @@ void USFRoomListEntryWidget::ShowPasswordDialog()
     USFPasswordInputWidget* PW = CreateWidget<USFPasswordInputWidget>(GetOwningPlayer(), PasswordInputWidgetClass);
     if (PW)
     {
-        PW->SetSessionIndex(SessionIndex);
+        PW->SetSessionId(SessionInfo.SessionId);
         PW->AddToViewport(100);
     }
 }
@@ -49,7 +49,7 @@ public:
 
 private:
     FSessionInfo SessionInfo; //현재 표시 중인 세션 정보
-    int32 SessionIndex; //Join 시 사용할 세션 인덱스
+    int32 SessionIndex; //리스트 내 인덱스 (-1 = 빈칸)
 
     UPROPERTY()
     USFOSSGameInstance* GameInstance; //세션 처리 GameInstance 참조
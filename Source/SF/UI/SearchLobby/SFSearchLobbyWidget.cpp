@@ -27,6 +27,7 @@ void USFSearchLobbyWidget::NativeConstruct()
 
     //============================세션 업데이트 바인딩==========================
     GameInstance->OnSessionsUpdated.AddUObject(this, &USFSearchLobbyWidget::OnSessionsUpdated);
+    if (SessionListView) SessionListView->OnListViewScrolled().AddUObject(this, &USFSearchLobbyWidget::OnSessionListScrolled);
     //=======================================================================
 
     RefreshSessionList(); //초기 세션 업데이트 요청
@@ -40,6 +41,11 @@ void USFSearchLobbyWidget::NativeDestruct()
         GameInstance->OnSessionsUpdated.RemoveAll(this); //델리게이트 정리
     }
 
+    if (SessionListView)
+    {
+        SessionListView->OnListViewScrolled().RemoveAll(this);
+    }
+
     Super::NativeDestruct();
 }
 //=========================================================================
@@ -67,38 +73,114 @@ void USFSearchLobbyWidget::OnPasswordFilterChanged(bool bIsChecked)
 //===========================================================================
 
 //==============================세션 리스트 갱신==============================
-void USFSearchLobbyWidget::OnSessionsUpdated(const TArray<FSessionInfo>& Sessions)
+void USFSearchLobbyWidget::OnSessionsUpdated()
+{
+    RebuildSessionList();
+
+    if (StatusText && GameInstance)
+    {
+        const int32 NumSessions = GameInstance->GetNumFilteredSessions();
+        StatusText->SetText(
+            NumSessions == 0 ?
+            FText::FromString(TEXT("검색된 방이 없습니다.")) :
+            FText::FromString(FString::Printf(TEXT("검색된 방: %d"), NumSessions))
+        );
+    }
+}
+
+void USFSearchLobbyWidget::RebuildSessionList()
 {
-    if (!SessionListView) return;
+    if (!SessionListView || !GameInstance) return;
+
+    const FSFSessionBrowser& Browser = GameInstance->GetSessionBrowser();
+    const int32 PageSize = GameInstance->GetSessionPageSize();
+    LoadedPageCount = FMath::Clamp(LoadedPageCount, 1, FMath::Max(1, Browser.GetNumPages(PageSize)));
 
-    SessionListView->ClearListItems(); //기존 리스트 비우기
+    TArray<UObject*> Items;
+    Items.Reserve(FMath::Max(LoadedPageCount * PageSize, MinSlots));
 
-    // 1. 진짜 방 데이터 목록 추가
-    for (int32 i = 0; i < Sessions.Num(); ++i) //Index 포함하여 전달
+    // 1. 불러온 페이지까지의 진짜 방 (같은 세션은 기존 아이템 재사용 → 보이는 행만 다시 그림)
+    bool bDataChanged = false;
+    TArray<const FSessionInfo*> Page;
+    for (int32 PageIndex = 0; PageIndex < LoadedPageCount; ++PageIndex)
     {
-        SessionListView->AddItem(USFSessionListItem::Make(this, Sessions[i], i)); //리스트 아이템 추가
+        Browser.GetPage(PageIndex, PageSize, Page);
+        for (const FSessionInfo* Info : Page)
+        {
+            Items.Add(GetOrUpdateItem(*Info, Items.Num(), bDataChanged));
+        }
     }
+    NumListedSessions = Items.Num();
 
-    // 2. 모자란 만큼 빈칸(Dummy) 데이터 추가
-    int32 CurrentCount = Sessions.Num();
-    if (CurrentCount < MinSlots)
+    // 캐시에서 빠진 세션 아이템 정리
+    for (auto It = SessionItems.CreateIterator(); It; ++It)
     {
-        for (int32 i = 0; i < (MinSlots - CurrentCount); ++i)
+        if (!Browser.Find(It.Key()))
         {
-            FSessionInfo EmptyInfo; // 빈 정보
+            It.RemoveCurrent();
+        }
+    }
 
-            // 빈방(가짜 방 목록) 데이터 시-> -1 인덱스 전달 
-            SessionListView->AddItem(USFSessionListItem::Make(this, EmptyInfo, -1));
+    // 2. 모자란 만큼 빈칸(Dummy) 데이터 추가
+    for (int32 i = 0; i < MinSlots - NumListedSessions; ++i)
+    {
+        if (!DummyItems.IsValidIndex(i))
+        {
+            // 빈방(가짜 방 목록) 데이터 시-> -1 인덱스 전달
+            DummyItems.Add(USFSessionListItem::Make(this, FSessionInfo(), -1));
         }
+        Items.Add(DummyItems[i]);
+    }
+
+    SessionListView->SetListItems(Items);
+
+    // 같은 아이템 객체는 Entry에 다시 세팅되지 않으므로 내용이 바뀐 경우만 보이는 행 재생성
+    if (bDataChanged)
+    {
+        SessionListView->RegenerateAllEntries();
     }
+}
 
-    if (StatusText)
+USFSessionListItem* USFSearchLobbyWidget::GetOrUpdateItem(const FSessionInfo& Info, int32 Index, bool& bOutDataChanged)
+{
+    USFSessionListItem*& Item = SessionItems.FindOrAdd(Info.SessionId);
+    if (!Item)
     {
-        StatusText->SetText(
-            Sessions.Num() == 0 ?
-            FText::FromString(TEXT("검색된 방이 없습니다.")) :
-            FText::FromString(FString::Printf(TEXT("검색된 방: %d"), Sessions.Num()))
-        );
+        Item = USFSessionListItem::Make(this, Info, Index);
+        return Item;
+    }
+
+    if (!Item->Data.HasSameDisplayData(Info))
+    {
+        Item->Data = Info;
+        bOutDataChanged = true;
+    }
+    Item->SessionIndex = Index;
+    return Item;
+}
+
+void USFSearchLobbyWidget::OnSessionListScrolled(float ItemOffset, float DistanceRemaining)
+{
+    if (!SessionListView || !GameInstance || DistanceRemaining > LoadMoreDistance) return;
+
+    const FSFSessionBrowser& Browser = GameInstance->GetSessionBrowser();
+    const int32 PageSize = GameInstance->GetSessionPageSize();
+    if (LoadedPageCount >= Browser.GetNumPages(PageSize)) return;
+
+    // 빈칸이 섞여 있으면 전체 재구성, 아니면 다음 페이지만 뒤에 추가
+    if (NumListedSessions < MinSlots)
+    {
+        ++LoadedPageCount;
+        RebuildSessionList();
+        return;
+    }
+
+    bool bDataChanged = false;
+    TArray<const FSessionInfo*> Page;
+    Browser.GetPage(LoadedPageCount++, PageSize, Page);
+    for (const FSessionInfo* Info : Page)
+    {
+        SessionListView->AddItem(GetOrUpdateItem(*Info, NumListedSessions++, bDataChanged));
     }
 }
 //===========================================================================
@@ -108,6 +190,8 @@ void USFSearchLobbyWidget::RefreshSessionList()
 {
     if (GameInstance)
     {
+        LoadedPageCount = 1; //새로고침 시 첫 페이지부터
+
         bool bShowPassword = PasswordProtectedCheckBox && PasswordProtectedCheckBox->IsChecked();
         GameInstance->FindSessions(bShowPassword); //필터 값과 함께 세션 검색 요청
     }
@@ -4,6 +4,8 @@
 #include "SFSearchLobbyWidget.generated.h"
 
 class USFOSSGameInstance;
+class USFSessionListItem;
+struct FSessionInfo;
 class UListView;
 class UTextBlock;
 class UCheckBox;
@@ -60,9 +62,13 @@ public:
     void OnPasswordFilterChanged(bool bIsChecked); //비밀번호 필터 변경
 
     UFUNCTION()
-    void OnSessionsUpdated(const TArray<FSessionInfo>& Sessions); //세션 리스트 업데이트
+    void OnSessionsUpdated(); //세션 리스트 업데이트
+
+    void OnSessionListScrolled(float ItemOffset, float DistanceRemaining); //스크롤 끝 근처에서 다음 페이지 추가
     //====================================================================
 
+    int32 GetNumListedSessions() const { return NumListedSessions; }
+
 private:
     UPROPERTY()
     USFOSSGameInstance* GameInstance; //GameInstance 참조
@@ -70,8 +76,24 @@ private:
     void RefreshSessionList(); //세션 검색 요청
     void CreateRoomUI(); //방 생성 UI 표시
 
+    void RebuildSessionList(); //불러온 페이지 + 빈칸으로 리스트 구성
+    USFSessionListItem* GetOrUpdateItem(const FSessionInfo& Info, int32 Index, bool& bOutDataChanged); //세션 ID 기준 아이템 재사용
+
+    UPROPERTY()
+    TMap<FString, USFSessionListItem*> SessionItems; //세션 ID → 리스트 아이템
+
+    UPROPERTY()
+    TArray<USFSessionListItem*> DummyItems; //빈칸 아이템 풀
+
+    int32 LoadedPageCount = 1; //리스트에 올라간 페이지 수
+    int32 NumListedSessions = 0; //리스트에 올라간 실제 방 수
+
 public:
     // 최소 슬롯 개수 Ex) 화면에 표시될 최소 방 목록 = 가짜 방 목록 포함
     UPROPERTY(BlueprintReadWrite, Category = "UI")
     int32 MinSlots = 10;
+
+    // 남은 스크롤 거리(행 수)가 이 값 이하가 되면 다음 페이지 추가
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
+    float LoadMoreDistance = 3.f;
 };
\ No newline at end of file
@@ -13,7 +13,7 @@ public:
 	UPROPERTY(BlueprintReadOnly)
 	FSessionInfo Data; //세션 정보 전체 보관
 
-	int32 SessionIndex; //리스트 내 세션 인덱스
+	int32 SessionIndex = -1; //리스트 내 세션 인덱스 (-1 = 빈칸). 입장은 Data.SessionId 사용
 
 	//====================================생성 함수====================================
 	static USFSessionListItem* Make(UObject* Outer, const FSessionInfo& In, int32 Index)
@@ -0,0 +1,61 @@
+#include "SFDamageTextLayer.h"
+
+#include "System/SFDamageTextSubSystem.h"
+
+void SSFDamageTextLayer::Construct(const FArguments& InArgs)
+{
+	DamageTextSubsystem = InArgs._DamageTextSubsystem;
+
+	// 매 프레임 내용이 바뀌므로 캐싱하지 않음
+	SetVisibility(EVisibility::HitTestInvisible);
+	ForceVolatile(true);
+}
+
+int32 SSFDamageTextLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+	bool bParentEnabled) const
+{
+	const USFDamageTextSubSystem* Subsystem = DamageTextSubsystem.Get();
+	if (!Subsystem)
+	{
+		return LayerId;
+	}
+
+	const FSlateFontInfo& Font = Subsystem->GetDamageTextFont();
+	const FLinearColor& NormalColor = Subsystem->GetNormalColor();
+	const FLinearColor& CriticalColor = Subsystem->GetCriticalColor();
+
+	// 서브시스템의 화면 좌표는 뷰포트 픽셀 기준 → 레이어 로컬(DPI 적용) 좌표로 변환
+	const float InvScale = AllottedGeometry.Scale > 0.f ? 1.f / AllottedGeometry.Scale : 1.f;
+
+	for (const FSFDamageTextRecord& Record : Subsystem->GetActiveRecords())
+	{
+		if (!Record.bOnScreen || Record.Opacity <= 0.f)
+		{
+			continue;
+		}
+
+		const float Scale = Record.bCritical ? Record.Scale * Subsystem->GetCriticalScale() : Record.Scale;
+		const FVector2f LocalCenter = FVector2f(Record.ScreenPosition) * InvScale;
+		const FVector2f Offset = LocalCenter - Record.TextSize * (0.5f * Scale);
+
+		FLinearColor Color = Record.bCritical ? CriticalColor : NormalColor;
+		Color.A *= Record.Opacity;
+
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(FVector2f(Record.TextSize), FSlateLayoutTransform(Scale, Offset)),
+			Record.Text,
+			Font,
+			ESlateDrawEffect::None,
+			InWidgetStyle.GetColorAndOpacityTint() * Color);
+	}
+
+	return LayerId;
+}
+
+FVector2D SSFDamageTextLayer::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D::ZeroVector;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class USFDamageTextSubSystem;
+
+/**
+ * 활성 데미지 텍스트를 한 번에 그리는 뷰포트 레이어
+ * 위치/스케일/투명도는 USFDamageTextSubSystem이 프레임당 한 번 계산하고, 여기서는 그리기만 수행
+ */
+class SF_API SSFDamageTextLayer : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSFDamageTextLayer)
+	{
+	}
+
+	SLATE_ARGUMENT(TWeakObjectPtr<const USFDamageTextSubSystem>, DamageTextSubsystem)
+SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+		bool bParentEnabled) const override;
+
+protected:
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+	TWeakObjectPtr<const USFDamageTextSubSystem> DamageTextSubsystem;
+};
@@ -0,0 +1,71 @@
+#include "SFEnemyHealthBarLayer.h"
+
+#include "Styling/CoreStyle.h"
+#include "System/SFEnemyHealthBarSubsystem.h"
+
+void SSFEnemyHealthBarLayer::Construct(const FArguments& InArgs)
+{
+	HealthBarSubsystem = InArgs._HealthBarSubsystem;
+	BarBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
+
+	// 매 프레임 내용이 바뀌므로 캐싱하지 않음
+	SetVisibility(EVisibility::HitTestInvisible);
+	ForceVolatile(true);
+}
+
+int32 SSFEnemyHealthBarLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+	bool bParentEnabled) const
+{
+	const USFEnemyHealthBarSubsystem* Subsystem = HealthBarSubsystem.Get();
+	if (!Subsystem || !BarBrush)
+	{
+		return LayerId;
+	}
+
+	const TArray<FSFEnemyHealthBarRecord>& Records = Subsystem->GetActiveRecords();
+	const FVector2f BarSize = Subsystem->GetBarSize();
+	const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint();
+
+	// 서브시스템의 화면 좌표는 뷰포트 픽셀 기준 → 레이어 로컬(DPI 적용) 좌표로 변환
+	const float InvScale = AllottedGeometry.Scale > 0.f ? 1.f / AllottedGeometry.Scale : 1.f;
+
+	auto DrawBar = [&](const FVector2f& Offset, float Percent, const FLinearColor& Color, float Opacity)
+	{
+		if (Percent <= 0.f)
+		{
+			return;
+		}
+
+		FLinearColor FinalColor = Color;
+		FinalColor.A *= Opacity;
+
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			LayerId,
+			AllottedGeometry.ToPaintGeometry(FVector2f(BarSize.X * Percent, BarSize.Y), FSlateLayoutTransform(Offset)),
+			BarBrush,
+			ESlateDrawEffect::None,
+			Tint * FinalColor);
+	};
+
+	// 인덱스는 먼 순서로 정렬되어 있으므로 같은 레이어에서 가까운 바가 위에 그려짐
+	for (const int32 Index : Subsystem->GetVisibleRecordIndices())
+	{
+		const FSFEnemyHealthBarRecord& Record = Records[Index];
+
+		// 바 상단 중앙이 앵커 위치
+		const FVector2f Offset = FVector2f(Record.ScreenPosition) * InvScale - FVector2f(BarSize.X * 0.5f, 0.f);
+
+		DrawBar(Offset, 1.f, Subsystem->GetBackgroundColor(), Record.Opacity);
+		DrawBar(Offset, Record.DelayedPercent, Subsystem->GetDelayedColor(), Record.Opacity);
+		DrawBar(Offset, Record.CurrentPercent, Record.FillColor, Record.Opacity);
+	}
+
+	return LayerId;
+}
+
+FVector2D SSFEnemyHealthBarLayer::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D::ZeroVector;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class USFEnemyHealthBarSubsystem;
+struct FSlateBrush;
+
+/**
+ * 표시 중인 적 체력바를 한 번에 그리는 뷰포트 레이어
+ * 투영/페이드/표시 개수 제한은 USFEnemyHealthBarSubsystem이 프레임당 한 번 계산하고, 여기서는 그리기만 수행
+ */
+class SF_API SSFEnemyHealthBarLayer : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SSFEnemyHealthBarLayer)
+	{
+	}
+
+	SLATE_ARGUMENT(TWeakObjectPtr<const USFEnemyHealthBarSubsystem>, HealthBarSubsystem)
+SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+		bool bParentEnabled) const override;
+
+protected:
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+	TWeakObjectPtr<const USFEnemyHealthBarSubsystem> HealthBarSubsystem;
+
+	const FSlateBrush* BarBrush = nullptr;
+};